@@ -12,12 +12,19 @@ test specifically from the pytest command line. [This is perhaps because
 the modifyitems hook is only called after test selection.]
 
 *pytest_ignore_collect* skips kernelcl.py if pyopencl cannot be imported.
+
+The numba tests run in the same process as the batch and shared memory
+tests, which fork worker processes, so the fork-safe numba threading layer
+is selected unless one is given in the environment.
 """
 from __future__ import print_function
 
+import os
 import os.path
 import inspect
 
+os.environ.setdefault("NUMBA_THREADING_LAYER", "workqueue")
+
 import pytest
 from _pytest.unittest import TestCaseFunction
 
@@ -57,6 +57,9 @@ def genfiles(package, package_name, modules, dir='api'):
 modules = [
     ('__init__', 'Sasmodels package'),
     #('alignment', 'GPU data alignment [unused]'),
+    ('analytic', 'Closed form size dispersity'),
+    ('batch', 'Batch fitting'),
+    ('bench', 'Benchmark suite'),
     ('bumps_model', 'Bumps interface'),
     ('compare', 'Compare models on different compute engines'),
     ('compare_many', 'Batch compare models on different compute engines'),
@@ -76,8 +79,10 @@ modules = [
     ('kernelcl', 'OpenCL model evaluator'),
     ('kernelcuda', 'CUDA model evaluator'),
     ('kerneldll', 'Ctypes model evaluator'),
+    ('kernelnumba', 'Numba model evaluator'),
     ('kernelpy', 'Python model evaluator'),
     ('list_pars', 'Identify all parameters in all models'),
+    ('logfft', 'Size dispersity by FFT'),
     ('mixture', 'Mixture model evaluator'),
     # Docs for models are generated by Makefile + genmodel.py, and don't
     # need to be managed by autodoc.
@@ -91,7 +96,9 @@ modules = [
     ('rst2html', 'Convert doc strings the web pages'),
     ('sasview_model', 'Sasview interface'),
     ('sesans', 'SESANS calculation routines'),
+    ('sharedmem', 'Shared memory evaluation service'),
     ('special', 'Special functions library'),
+    ('trace', 'Evaluation pipeline tracing'),
     ('weights', 'Distribution functions'),
 ]
 package = 'sasmodels'
@@ -37,6 +37,10 @@ batch_fit.csv in the current directory.
 
 Finally the fitted parameters are plotted for the full series.
 
+Each fit runs in a separate bumps process, which regenerates the model for
+every file.  For long series, :func:`sasmodels.batch.batch_fit` fits the
+files in a pool of workers sharing one compiled model.
+
 Example::
 
     python batch_fit.py model_ellipsoid_hayter_msa.py 93191 93195 201
@@ -1,6 +1,7 @@
 from bumps.names import *
 from sasmodels.core import load_model
 from sasmodels.bumps_model import Model, Experiment
+from sasmodels.direct_model import share_kernel
 from sasmodels.data import load_data, plot_data
 
 # latex data, same sample usans and sans
@@ -58,4 +59,8 @@ free.background.range(-inf, inf)
 # Setup the experiments, sharing the same model across all datasets.
 M = [Experiment(data=data, model=model, name=data.run[0]) for data in datasets]
 
+# Only scale and background differ between the datasets, so evaluate the
+# sphere once on the combined q vector rather than once per dataset.
+share_kernel(M)
+
 problem = FitProblem(M, freevars=free)
\ No newline at end of file
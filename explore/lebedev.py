@@ -0,0 +1,185 @@
+#!/usr/bin/env python
+"""
+Generate sasmodels/models/lib/lebedev.c from the Lebedev-Laikov rules.
+
+The 1D orientation average of a shape with D2h symmetry, such as a
+parallelepiped or triaxial ellipsoid, only needs the points in the positive
+octant of the sphere.  Points on the coordinate planes are shared between
+octants, so each octant point is given the total weight of its mirror
+images, with the weights normalized to sum to one.
+
+For each rule we find the largest q R_max for which the average of
+
+    |sinc(q R_a u_a) sinc(q R_b u_b) sinc(q R_c u_c)|^2
+    |2 J1(q sqrt(R_a^2 u_a^2 + R_b^2 u_b^2))/(...) sinc(q R_c u_c)|^2
+    |3 j1(q sqrt(R_a^2 u_a^2 + R_b^2 u_b^2 + R_c^2 u_c^2))/(...)|^2
+
+matches a dense Gauss-Legendre product rule to better than TOLERANCE for a
+range of aspect ratios, with R_max the largest of the half dimensions.
+Models use the lowest order rule which covers q R_max, and fall back to
+their Gauss-Legendre product rule above the limit for the highest order.
+
+Needs scipy 1.15 or later for scipy.integrate.lebedev_rule.
+"""
+from __future__ import print_function
+
+import os
+
+import numpy as np
+from numpy.polynomial.legendre import leggauss
+from scipy.integrate import lebedev_rule
+from scipy.special import j1
+
+ORDERS = (17, 41, 65, 89, 131)
+TOLERANCE = 1e-7
+# Safety factor applied to the measured q R_max limits.
+MARGIN = 0.95
+
+SHAPES = [
+    (1, 1, 1), (1, 2, 3), (1, 10, 20), (1, 1, 20), (20, 20, 1), (1, 5, 5),
+    (3, 7, 40), (0.1, 1, 1), (1, 1, 0.05), (1, 1, 0.3), (0.3, 1, 0.6),
+]
+
+TARGET = os.path.join(os.path.dirname(__file__), "..", "sasmodels",
+                      "models", "lib", "lebedev.c")
+
+
+def octant(order):
+    """
+    Return points (3 x n) and weights for the positive octant of the Lebedev
+    rule of the given *order*, with the weights summing to one.
+    """
+    x, w = lebedev_rule(order)
+    keep = (x >= -1e-14).all(axis=0)
+    x, w = abs(x[:, keep]), w[keep]
+    x[x < 1e-14] = 0.
+    images = 2.0**np.sum(x > 0, axis=0)
+    return x, w*images/np.sum(w*images)
+
+
+def gauss_octant(n):
+    """Gauss-Legendre product rule in (cos theta, phi) on the octant."""
+    z, w = leggauss(n)
+    u, phi = 0.5*(z + 1), 0.25*np.pi*(z + 1)
+    U, P = np.meshgrid(u, phi, indexing='ij')
+    S = np.sqrt(1 - U**2)
+    x = np.array([S*np.cos(P), S*np.sin(P), U]).reshape(3, -1)
+    return x, np.outer(w, w).ravel()/4
+
+
+def _sinc(x):
+    return np.sinc(x/np.pi)
+
+def _bessel(x):
+    x = np.where(x == 0, 1e-300, x)
+    return 2*j1(x)/x
+
+def _sph_bessel(x):
+    x = np.where(x == 0, 1e-300, x)
+    return np.where(x < 1e-3, 1., 3*(np.sin(x) - x*np.cos(x))/x**3)
+
+def _box(x, R):
+    return (_sinc(R[0]*x[0])*_sinc(R[1]*x[1])*_sinc(R[2]*x[2]))**2
+
+def _cylinder(x, R):
+    return (_bessel(np.sqrt((R[0]*x[0])**2 + (R[1]*x[1])**2))
+            * _sinc(R[2]*x[2]))**2
+
+def _ellipsoid(x, R):
+    return _sph_bessel(np.sqrt(np.sum((R[:, None]*x)**2, axis=0)))**2
+
+
+def qr_limit(order, step=0.5):
+    """Largest q R_max for which the rule meets TOLERANCE."""
+    x, w = octant(order)
+    x_ref, w_ref = gauss_octant(300)
+    shapes = [np.array(v, 'd')/max(v) for v in SHAPES]
+    limit = 0.
+    for qr in np.arange(step, 200, step):
+        for fn in (_box, _cylinder, _ellipsoid):
+            for R in shapes:
+                target = np.sum(w_ref*fn(x_ref, qr*R))
+                if abs(np.sum(w*fn(x, qr*R))/target - 1) > TOLERANCE:
+                    return limit
+        limit = qr
+    return limit
+
+
+def _table(name, ctype, values, fmt):
+    lines = ["constant %s %s[%d] = {" % (ctype, name, len(values))]
+    lines.extend("    " + fmt % v + "," for v in values)
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def generate():
+    """Return the C source for lebedev.c."""
+    rules = [octant(order) for order in ORDERS]
+    limits = [MARGIN*qr_limit(order) for order in ORDERS]
+    start = np.cumsum([0] + [len(w) for _, w in rules])
+    x = np.hstack([x for x, _ in rules])
+    w = np.hstack([w for _, w in rules])
+    rows = ", ".join("%d (%d points)" % (order, len(wk))
+                     for order, (_, wk) in zip(ORDERS, rules))
+    parts = [HEADER % {"orders": rows},
+             "#define LEBEDEV_ORDERS %d" % len(ORDERS),
+             "",
+             _table("LebedevStart", "int", start, "%d"),
+             "",
+             "// Largest q R_max for each rule.",
+             _table("LebedevQrMax", "double", limits, "%.1f"),
+             "",
+             _table("LebedevX", "double", x[0], "%.17g"),
+             _table("LebedevY", "double", x[1], "%.17g"),
+             _table("LebedevZ", "double", x[2], "%.17g"),
+             _table("LebedevW", "double", w, "%.17g"),
+             FOOTER]
+    return "\n".join(parts)
+
+
+HEADER = """\
+// Lebedev quadrature on the positive octant of the unit sphere.
+//
+// Generated by explore/lebedev.py; do not edit.
+//
+// Orientation averages for shapes whose |F(q)| is unchanged when any of
+// qa, qb, qc changes sign need only the points with ua, ub, uc >= 0.  Points
+// on the coordinate planes carry the weight of their mirror images, and the
+// weights for each rule sum to one, so that
+//
+//     <f> = sum_k LebedevW[k] f(LebedevX[k], LebedevY[k], LebedevZ[k])
+//
+// for k in [start, end) returned by lebedev_octant.
+//
+// Orders: %(orders)s.
+"""
+
+FOOTER = """
+// Select the lowest order rule accurate to about 1e-7 for a form factor
+// with largest half dimension R_max at qr = q R_max.  Sets the range of
+// points to use, returning zero if qr is beyond the highest order rule, in
+// which case the model should fall back to its Gauss-Legendre integral.
+static int
+lebedev_octant(double qr, int *start, int *end)
+{
+    for (int k=0; k < LEBEDEV_ORDERS; k++) {
+        if (qr <= LebedevQrMax[k]) {
+            *start = LebedevStart[k];
+            *end = LebedevStart[k+1];
+            return 1;
+        }
+    }
+    return 0;
+}
+"""
+
+
+def main():
+    source = generate()
+    with open(TARGET, "w") as fid:
+        fid.write(source)
+    print("wrote", os.path.abspath(TARGET))
+
+
+if __name__ == "__main__":
+    main()
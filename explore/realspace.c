@@ -0,0 +1,172 @@
+// Pair distance histograms for realspace.py.
+//
+// Compiled with kerneldll.compile_model(..., openmp=True) and called through
+// ctypes.  Points are passed as separate x, y, z arrays so that the distance
+// calculation for a block of points vectorizes.  The pairs are processed in
+// square tiles of BLOCK x BLOCK points so that both blocks stay in cache,
+// with each thread accumulating into its own histogram.
+//
+// The pair weight matches _calc_Pr_uniform in realspace.py:
+//
+//     w_ij = (rho_i rho_j + 2/3 m_i.m_j) (V_i + V_j)
+//
+// where the magnetic term is the orientation average of |M_perp|^2 for
+// unpolarized neutrons, and is skipped if the magnetization is NULL.
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if defined(_MSC_VER)
+#define EXPORT __declspec(dllexport)
+#else
+#define EXPORT
+#endif
+
+#define BLOCK 512
+
+typedef struct {
+    int n;
+    const double *x, *y, *z;
+    const double *rho, *volume;
+    const double *mx, *my, *mz;  // NULL if not magnetic
+} Cloud;
+
+static void
+pr_tile(const Cloud *a, int a_start, int a_end,
+        const Cloud *b, int b_start, int b_end,
+        int triangle, double inv_dr, int nbins, double *Pr)
+{
+    double d[BLOCK], w[BLOCK];
+    const int magnetic = (a->mx != NULL && b->mx != NULL);
+    for (int i=a_start; i < a_end; i++) {
+        const double xi=a->x[i], yi=a->y[i], zi=a->z[i];
+        const double rho_i=a->rho[i], vol_i=a->volume[i];
+        const int start = triangle ? (i+1 > b_start ? i+1 : b_start) : b_start;
+        const int n = b_end - start;
+        if (n <= 0) continue;
+        const double *bx=b->x+start, *by=b->y+start, *bz=b->z+start;
+        const double *brho=b->rho+start, *bvol=b->volume+start;
+        #ifdef _OPENMP
+        #pragma omp simd
+        #endif
+        for (int j=0; j < n; j++) {
+            const double dx=xi-bx[j], dy=yi-by[j], dz=zi-bz[j];
+            d[j] = sqrt(dx*dx + dy*dy + dz*dz)*inv_dr;
+            w[j] = rho_i*brho[j]*(vol_i + bvol[j]);
+        }
+        if (magnetic) {
+            const double mxi=a->mx[i], myi=a->my[i], mzi=a->mz[i];
+            const double *bmx=b->mx+start, *bmy=b->my+start, *bmz=b->mz+start;
+            #ifdef _OPENMP
+            #pragma omp simd
+            #endif
+            for (int j=0; j < n; j++) {
+                w[j] += (2./3.)*(mxi*bmx[j] + myi*bmy[j] + mzi*bmz[j])
+                    *(vol_i + bvol[j]);
+            }
+        }
+        // The scatter into the histogram doesn't vectorize.
+        for (int j=0; j < n; j++) {
+            const int k = (int)d[j];
+            if (k < nbins) Pr[k] += w[j];
+        }
+    }
+}
+
+// Accumulate the pair distance histogram between clouds a and b into Pr,
+// with bin k holding distances in [k dr, (k+1) dr).  If same is nonzero
+// then b is the same cloud as a, and each pair is counted once.
+static void
+pr_pairs(const Cloud *a, const Cloud *b, int same,
+         double dr, int nbins, double *Pr)
+{
+    const int na = (a->n + BLOCK - 1)/BLOCK;
+    const int nb = (b->n + BLOCK - 1)/BLOCK;
+    const long ntiles = (long)na*nb;
+    const double inv_dr = 1.0/dr;
+    int nthreads = 1;
+    #ifdef _OPENMP
+    nthreads = omp_get_max_threads();
+    #endif
+    double *partial = (double *)calloc((size_t)nthreads*nbins, sizeof(double));
+    if (partial == NULL) return;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 1)
+    #endif
+    for (long tile=0; tile < ntiles; tile++) {
+        const int ta = (int)(tile / nb), tb = (int)(tile % nb);
+        if (same && tb < ta) continue;
+        int thread = 0;
+        #ifdef _OPENMP
+        thread = omp_get_thread_num();
+        #endif
+        const int a_start = ta*BLOCK;
+        const int a_end = a_start+BLOCK < a->n ? a_start+BLOCK : a->n;
+        const int b_start = tb*BLOCK;
+        const int b_end = b_start+BLOCK < b->n ? b_start+BLOCK : b->n;
+        pr_tile(a, a_start, a_end, b, b_start, b_end, same && ta == tb,
+                inv_dr, nbins, partial + (size_t)thread*nbins);
+    }
+
+    for (int t=0; t < nthreads; t++) {
+        const double *p = partial + (size_t)t*nbins;
+        for (int k=0; k < nbins; k++) Pr[k] += p[k];
+    }
+    free(partial);
+}
+
+// Python interface.  Each cloud is described by pointers to x, y, z, rho,
+// volume and, if magnetic, mx, my, mz, each of length n.  Set same=1 to
+// compute the histogram of a cloud with itself, in which case the b
+// arguments are ignored.
+EXPORT void
+calc_pr(int na, const double *ax, const double *ay, const double *az,
+        const double *arho, const double *avol,
+        const double *amx, const double *amy, const double *amz,
+        int nb, const double *bx, const double *by, const double *bz,
+        const double *brho, const double *bvol,
+        const double *bmx, const double *bmy, const double *bmz,
+        int same, double dr, int nbins, double *Pr)
+{
+    const Cloud a = {na, ax, ay, az, arho, avol, amx, amy, amz};
+    const Cloud b = {nb, bx, by, bz, brho, bvol, bmx, bmy, bmz};
+    pr_pairs(&a, same ? &a : &b, same, dr, nbins, Pr);
+}
+
+// I(q) = sum_k weight_k P(r_k) sin(q r_k)/(q r_k), where weight holds the
+// integration weights for the r mesh.
+EXPORT void
+calc_iq_from_pr(int nq, const double *q, int nr, const double *r,
+                const double *weight, const double *Pr, double *Iq)
+{
+    #ifdef _OPENMP
+    #pragma omp parallel for
+    #endif
+    for (int i=0; i < nq; i++) {
+        double total = 0.;
+        #ifdef _OPENMP
+        #pragma omp simd reduction(+:total)
+        #endif
+        for (int k=0; k < nr; k++) {
+            const double qr = q[i]*r[k];
+            total += weight[k]*Pr[k]*(qr == 0. ? 1.0 : sin(qr)/qr);
+        }
+        Iq[i] = total;
+    }
+}
+
+// Number of threads used by the engine.
+EXPORT int
+num_threads(void)
+{
+    #ifdef _OPENMP
+    return omp_get_max_threads();
+    #else
+    return 1;
+    #endif
+}
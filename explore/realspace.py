@@ -14,7 +14,6 @@ import numpy as np
 from numpy import pi, radians, sin, cos, sqrt, clip
 from numpy.random import poisson, uniform, randn, rand
 from numpy.polynomial.legendre import leggauss
-from scipy.integrate import simps
 from scipy.special import j1 as J1
 from scipy.special import gamma
 
@@ -799,14 +798,134 @@ if USE_NUMBA:
         return Pr
 
 
-def calc_Pr(r, rho, points, volume):
+# Native engine in realspace.c, compiled with OpenMP on first use.
+# SAS_REALSPACE_C: 0=numba/numpy only, 1=use C engine if it compiles.
+USE_NATIVE = os.environ.get("SAS_REALSPACE_C", "1") != "0"
+_NATIVE = None
+
+def _load_native():
+    import ctypes as ct
+    from os.path import dirname, realpath, join as joinpath
+    from sasmodels import generate, kerneldll
+
+    source_path = joinpath(dirname(realpath(__file__)), "realspace.c")
+    with open(source_path) as fid:
+        source = fid.read()
+    # Tag with the source hash so edits to realspace.c are recompiled.
+    output = joinpath(kerneldll.SAS_DLL_PATH, "realspace_%s%s.so"
+                      % (generate.tag_source(source), kerneldll.ARCH))
+    if not os.path.exists(output):
+        os.makedirs(os.path.abspath(kerneldll.SAS_DLL_PATH), exist_ok=True)
+        kerneldll.compile_model(source_path, output, openmp=True)
+    dll = ct.CDLL(output)
+    cloud = [ct.c_int] + [ct.c_void_p]*8
+    dll.calc_pr.argtypes = cloud + cloud + [
+        ct.c_int, ct.c_double, ct.c_int, ct.c_void_p]
+    dll.calc_pr.restype = None
+    dll.calc_iq_from_pr.argtypes = [
+        ct.c_int, ct.c_void_p, ct.c_int, ct.c_void_p,
+        ct.c_void_p, ct.c_void_p, ct.c_void_p]
+    dll.calc_iq_from_pr.restype = None
+    dll.num_threads.restype = ct.c_int
+    return dll
+
+def native():
+    """
+    Return the compiled engine from realspace.c, or None if it is disabled
+    or could not be compiled.
+    """
+    global _NATIVE
+    if _NATIVE is None:
+        _NATIVE = False
+        if USE_NATIVE:
+            try:
+                _NATIVE = _load_native()
+            except Exception as exc:
+                print("realspace.c not available: %s" % exc)
+    return _NATIVE if _NATIVE else None
+
+def _cloud_args(rho, points, volume, rho_m=None):
+    # Convert a point cloud to the (n, x, y, z, rho, V, mx, my, mz) arguments
+    # of calc_pr, returning the arrays as well to keep them alive.
+    points = np.asarray(points, 'd')
+    n = points.shape[0]
+    arrays = [np.ascontiguousarray(v) for v in points.T]
+    arrays.append(np.ascontiguousarray(np.broadcast_to(np.asarray(rho, 'd'), n)))
+    arrays.append(np.ascontiguousarray(np.broadcast_to(np.asarray(volume, 'd'), n)))
+    if rho_m is not None:
+        rho_m = np.asarray(rho_m, 'd')
+        arrays.extend(np.ascontiguousarray(np.broadcast_to(v, n)) for v in rho_m)
+    pointers = [v.ctypes.data for v in arrays] + [None]*(8 - len(arrays))
+    return [n] + pointers, arrays
+
+def calc_Pr_native(r, clouds, partial=False):
+    """
+    Compute P(r) for a set of point clouds using the C engine.
+
+    *r* are the uniformly spaced bin centers from :func:`r_bins`.
+    *clouds* is a list of (rho, points, volume) or (rho, points, volume, rho_m)
+    tuples, one for each shape, where *rho_m* (3 x n) is the magnetic sld.
+    Pairs are weighted by $(\rho_i \rho_j + 2/3\, m_i\cdot m_j)(V_i + V_j)$,
+    the orientation average for unpolarized neutrons, as in the numpy version
+    of :func:`calc_Pr`.  The magnetic term is only included for pairs of
+    magnetic clouds.  This is only exact for isotropic samples, so the
+    magnetic shapes are checked against the models with
+    :func:`check_shape_mag` instead.
+
+    If *partial* is True, return an array *Pr[i, j]* with the contribution
+    of the pairs between clouds *i* and *j* for $i \le j$, otherwise return
+    the total.  The total is the same as for the combined point cloud.
+    """
+    dll = native()
+    if dll is None:
+        raise RuntimeError("realspace.c engine is not available")
+    r = np.asarray(r, 'd')
+    dr, nbins = r[0], len(r)
+    args = [_cloud_args(*cloud) for cloud in clouds]
+    Pr = np.zeros((len(clouds), len(clouds), nbins), 'd')
+    for i, (a, _) in enumerate(args):
+        for j, (b, _) in enumerate(args[i:], start=i):
+            dll.calc_pr(*a, *b, int(i == j), dr, nbins, Pr[i, j].ctypes.data)
+    # Note: 1e-4 because (1e-6 rho)^2 = 1e-12 rho^2 time 1e-8 for 1/A to 1/cm
+    Pr *= 1e-4
+    return Pr if partial else Pr.sum(axis=(0, 1))
+
+def _calc_Pr_magnetic(r, rho, rho_m, points, volume):
+    # Numpy version of the pair weight in realspace.c for magnetic points,
+    # with the orientation averaged 2/3 m_i.m_j term for unpolarized neutrons.
+    dr, n_max = r[0], len(r)
+    extended_Pr = np.zeros(n_max+1, 'd')
+    t_next = timer() + 3
+    for k, rho_k in enumerate(rho[:-1]):
+        distance = np.linalg.norm(points[k] - points[k+1:], axis=1)
+        contrast = rho_k*rho[k+1:] + 2/3*np.dot(rho_m[:, k], rho_m[:, k+1:])
+        weights = contrast * (volume[k] + volume[k+1:])
+        index = np.minimum(np.asarray(distance/dr, 'i'), n_max)
+        # Note: indices may be duplicated, so "Pr[index] += w" will not work!!
+        extended_Pr += np.bincount(index, weights, n_max+1)
+        t = timer()
+        if t > t_next:
+            t_next = t + 3
+            print("processing %d of %d"%(k, len(rho)-1))
+    return extended_Pr[:-1]
+
+def calc_Pr(r, rho, points, volume, rho_m=None):
     # P(r) with uniform steps in r is 3x faster; check if we are uniform
     # before continuing
     r, points = [np.asarray(v, 'd') for v in (r, points)]
     npoints = points.shape[0]
     rho = np.broadcast_to(np.asarray(rho, 'd'), npoints)
     volume = np.broadcast_to(np.asarray(volume, 'd'), npoints)
-    if np.max(np.abs(np.diff(r) - r[0])) > r[0]*0.01:
+    uniform_r = np.max(np.abs(np.diff(r) - r[0])) <= r[0]*0.01
+    if uniform_r and native() is not None:
+        return calc_Pr_native(r, [(rho, points, volume, rho_m)])
+    if rho_m is not None:
+        if not uniform_r:
+            raise ValueError("magnetic P(r) needs uniform r steps")
+        rho_m = np.broadcast_to(np.asarray(rho_m, 'd').reshape(3, -1),
+                                (3, npoints))
+        Pr = _calc_Pr_magnetic(r, rho, rho_m, points, volume)
+    elif not uniform_r:
         Pr = _calc_Pr_nonuniform(r, rho, points, volume)
     else:
         Pr = _calc_Pr_uniform(r, rho, points, volume)
@@ -827,9 +946,47 @@ def j0(x):
     return np.sinc(x/np.pi)
 
 
+def simpson_weights(r):
+    """
+    Return the composite Simpson's rule weights for integrating over *r*.
+
+    The mesh need not be uniform.  For an even number of points the final
+    interval uses the quadratic through the last three points, the same
+    as scipy.integrate.simpson.
+    """
+    r = np.asarray(r, 'd')
+    n = len(r)
+    weight = np.zeros(n)
+    if n < 3:
+        h = np.diff(r)
+        weight[1:] += 0.5*h
+        weight[:-1] += 0.5*h
+        return weight
+    m = n - 1 if n % 2 == 0 else n
+    h0, h1 = r[1:m-1:2] - r[0:m-2:2], r[2:m:2] - r[1:m-1:2]
+    hsum = h0 + h1
+    weight[0:m-2:2] += hsum/6*(2 - h1/h0)
+    weight[1:m-1:2] += hsum**3/(6*h0*h1)
+    weight[2:m:2] += hsum/6*(2 - h0/h1)
+    if m < n:
+        h0, h1 = r[-2] - r[-3], r[-1] - r[-2]
+        weight[-1] += (2*h1**2 + 3*h0*h1)/(6*(h0 + h1))
+        weight[-2] += (h1**2 + 3*h0*h1)/(6*h0)
+        weight[-3] -= h1**3/(6*h0*(h0 + h1))
+    return weight
+
+
 def calc_Iq_from_Pr(q, r, Pr):
-    Iq = np.array([simps(Pr * j0(qk*r), r) for qk in q])
-    #Iq = np.array([np.trapz(Pr * j0(qk*r), r) for qk in q])
+    # Both the native and the numpy versions use Simpson's rule.
+    q, r, Pr = [np.ascontiguousarray(v, 'd') for v in (q, r, Pr)]
+    weight = simpson_weights(r)
+    dll = native()
+    if dll is not None:
+        Iq = np.empty_like(q)
+        dll.calc_iq_from_pr(len(q), q.ctypes.data, len(r), r.ctypes.data,
+                            weight.ctypes.data, Pr.ctypes.data, Iq.ctypes.data)
+        return Iq
+    Iq = np.array([np.sum(weight * Pr * j0(qk*r)) for qk in q])
     #Iq /= Iq[0]
     return Iq
 
@@ -0,0 +1,285 @@
+r"""
+Closed form size dispersity for concentric spheres
+
+For a sphere built from concentric shells of uniform density, with the
+interfaces at radii $R + t_j$ and contrast $\Delta\rho_j$ across each
+interface, the amplitude is
+
+.. math::
+
+    F(q; R) = \sum_j \Delta\rho_j V(R + t_j) \frac{3 j_1(q(R + t_j))}{q(R + t_j)}
+            = \frac{4\pi}{q^3}\,\text{Im}\left[(a_0 + a_1 R) e^{iqR}\right]
+
+with $a_0 = \sum_j \Delta\rho_j (1 - iqt_j) e^{iqt_j}$ and
+$a_1 = -iq \sum_j \Delta\rho_j e^{iqt_j}$.  The averages of $F$ and $F^2$
+over a distribution in $R$ then only need $E[R^n e^{ikR}]$ for $n \le 2$
+and $k = q, 2q$, which have closed forms for the Gaussian and Schulz
+distributions:
+
+.. math::
+
+    \text{Gaussian:}\quad & E[e^{ikR}] = e^{ik\mu - \sigma^2k^2/2} \\
+    \text{Schulz:}\quad & E[R^n e^{ikR}] = \theta^n z(z+1)\cdots(z+n-1)
+        (1 - ik\theta)^{-(z+n)}
+
+For $q (\bar R + t_\max) < 1$ the closed form loses precision to
+cancellation, so $j_1$ is expanded as a power series and averaged using the
+polynomial moments of the distribution.
+
+The distribution is the one declared for the *radius* parameter, which
+:func:`.details.make_kernel_args` records as *call_details.dispersion*.
+Gaussian distributions are truncated at $R = 0$, as in the dispersity
+mesh.  The closed form is the average over the whole distribution, whereas
+the dispersity loop truncates the distribution at *nsigmas* and samples it
+at *npts* points.  The two agree when the weight beyond the ends of the
+mesh is negligible (Gaussian with *nsigmas* of about 6.5 or more, or Schulz
+with *nsigmas* of 8 and polydispersity up to about 0.12), but at the
+default *nsigmas* of 3 the loop misses a few tenths of a percent of the
+distribution, changing $I(q)$ by up to about a percent, and by more near
+the minima.
+
+Since the closed form doesn't reproduce the loop at the user's *npts* and
+*nsigmas*, it is off by default.  Models opt in by defining
+*concentric_shells*, with the dispersity in the *radius* parameter, and
+:meth:`.kernel.Kernel.Fq` then uses the closed form if *analytic* is set on
+the kernel, or for all kernels if the environment variable *SAS_ANALYTIC=1*
+is set.
+"""
+from __future__ import division, print_function
+
+from math import factorial, erfc, exp, pi, sqrt
+
+import numpy as np  # type: ignore
+from numpy.polynomial import polynomial as P  # type: ignore
+from scipy.special import comb, wofz  # type: ignore
+
+from . import trace
+from .kernel import KernelStats
+
+# pylint: disable=unused-import
+try:
+    from typing import List, Optional, Tuple
+    from .details import CallDetails
+    from .kernel import Kernel
+except ImportError:
+    pass
+# pylint: enable=unused-import
+
+#: Use the power series below this value of $q (\bar R + t_\max)$.
+SERIES_LIMIT = 1.0
+#: Number of terms in the power series for $3 j_1(x)/x$.
+SERIES_TERMS = 16
+
+# Series coefficients (-1)^n (2n+2)/(2n+3)! and the binomial coefficients
+# for expanding (R + t)^(2n+3).
+_SERIES_COEF = np.array([(-1)**n*(2*n+2)/factorial(2*n+3)
+                         for n in range(SERIES_TERMS)])
+_BINOMIAL = np.array([[comb(n, k, exact=True) for k in range(2*SERIES_TERMS+2)]
+                      for n in range(2*SERIES_TERMS+2)], 'd')
+
+
+class Gaussian(object):
+    r"""
+    Gaussian distribution with center *mu* and width *sigma*, truncated
+    to $R > 0$ in the same way as the dispersity mesh drops negative radii.
+    """
+    def __init__(self, mu, sigma):
+        # type: (float, float) -> None
+        self.mu, self.sigma = mu, sigma
+        # Weight above R = 0 and the normalized density at R = 0.
+        self._norm = 1. - 0.5*erfc(mu/(sigma*sqrt(2)))
+        self._g0 = exp(-0.5*(mu/sigma)**2)/(sigma*sqrt(2*pi))/self._norm
+        self.mean = self.moments(1)[1]
+
+    def moments(self, n):
+        # type: (int) -> np.ndarray
+        """Return $E[R^k]$ for $k$ in $0 \ldots n$."""
+        m = np.empty(max(n+1, 2))
+        m[0], m[1] = 1., self.mu + self.sigma**2*self._g0
+        for k in range(2, n+1):
+            m[k] = self.mu*m[k-1] + (k-1)*self.sigma**2*m[k-2]
+        return m[:n+1]
+
+    def phase_moments(self, k):
+        # type: (np.ndarray) -> Tuple[np.ndarray, np.ndarray, np.ndarray]
+        """Return $E[R^n e^{ikR}]$ for $n = 0, 1, 2$."""
+        mu, sigma = self.mu, self.sigma
+        s2 = sigma**2
+        # Full distribution less the part below R = 0, using the Faddeeva
+        # function to avoid overflow in erfc of the complex argument.
+        cut = 0.5*exp(-0.5*(mu/sigma)**2)*wofz((1j*mu - s2*k)/(sigma*sqrt(2)))
+        M0 = (np.exp(1j*mu*k - 0.5*s2*k**2) - cut)/self._norm
+        b = mu + 1j*s2*k
+        M1 = b*M0 + s2*self._g0
+        return M0, M1, b*M1 + s2*M0
+
+
+class Schulz(object):
+    r"""
+    Schulz distribution $R^{z-1} e^{-R/\theta}$ with shape *z* and scale
+    *theta*, having mean $z\theta$.
+    """
+    def __init__(self, z, theta):
+        # type: (float, float) -> None
+        self.z, self.theta = z, theta
+        self.mean = z*theta
+
+    def moments(self, n):
+        # type: (int) -> np.ndarray
+        """Return $E[R^k]$ for $k$ in $0 \\ldots n$."""
+        return np.cumprod(np.hstack((1., self.theta*(self.z + np.arange(n)))))
+
+    def phase_moments(self, k):
+        # type: (np.ndarray) -> Tuple[np.ndarray, np.ndarray, np.ndarray]
+        """Return $E[R^n e^{ikR}]$ for $n = 0, 1, 2$."""
+        z, theta = self.z, self.theta
+        u = 1 - 1j*k*theta
+        M0 = np.exp(-z*np.log(u))
+        M1 = theta*z*M0/u
+        M2 = theta*(z + 1)*M1/u
+        return M0, M1, M2
+
+
+def declared(pd_type, center, width):
+    # type: (str, float, float) -> Optional[object]
+    """
+    Return the :class:`Gaussian` or :class:`Schulz` distribution for the
+    dispersity *pd_type* with standard deviation *width* about *center*,
+    or None if there is no closed form for it.
+    """
+    if center <= 0 or width <= 0:
+        return None
+    if pd_type == 'gaussian':
+        return Gaussian(center, width)
+    if pd_type == 'schulz':
+        z = (center/width)**2
+        return Schulz(z, center/z)
+    return None
+
+
+def average(pd, q, contrast, offset):
+    # type: (object, np.ndarray, List[float], List[float]) -> Tuple[np.ndarray, np.ndarray]
+    r"""
+    Return $\langle F \rangle$ and $\langle F^2 \rangle$ for the concentric
+    spheres with *contrast* at each interface and interfaces at *offset*
+    from the radius, for radius distribution *pd*.  Contrast is in units
+    of $10^{-6}/\AA^2$, and $F$ is in units of $10^{-2}\ \text{cm}^{-1/2}$
+    as in the C kernels.
+    """
+    contrast = np.asarray(contrast, 'd')
+    offset = np.asarray(offset, 'd')
+    q = np.asarray(q, 'd')
+    F1, F2 = np.empty_like(q), np.empty_like(q)
+    scale = pd.mean + max(np.max(offset), 0.)
+    small = q*scale < SERIES_LIMIT
+    if small.any():
+        F1[small], F2[small] = _series(pd, q[small], contrast, offset, scale)
+
+    q = q[~small]
+    phase = np.exp(1j*np.outer(q, offset))
+    a0 = np.dot((1 - 1j*np.outer(q, offset))*phase, contrast)
+    a1 = -1j*q*np.dot(phase, contrast)
+    M0, M1, M2 = pd.phase_moments(q)
+    N0, N1, N2 = pd.phase_moments(2*q)
+    m = pd.moments(2)
+    A = 1e-2*4*np.pi/q**3
+    F1[~small] = A*np.imag(a0*M0 + a1*M1)
+    F2[~small] = 0.5*A**2*(
+        abs(a0)**2 + 2*np.real(a0*np.conj(a1))*m[1] + abs(a1)**2*m[2]
+        - np.real(a0**2*N0 + 2*a0*a1*N1 + a1**2*N2))
+    return F1, F2
+
+
+def _series(pd, q, contrast, offset, scale):
+    # type: (object, np.ndarray, np.ndarray, np.ndarray, float) -> Tuple[np.ndarray, np.ndarray]
+    r"""
+    Power series for $\langle F \rangle$ and $\langle F^2 \rangle$, using
+
+    .. math::
+
+        V(r) \frac{3 j_1(qr)}{qr} = 4\pi \sum_n (-1)^n \frac{2n+2}{(2n+3)!}
+            q^{2n} r^{2n+3}
+
+    with lengths scaled by *scale* to keep the moments in range.
+    """
+    N = SERIES_TERMS
+    c = _SERIES_COEF
+    # Row n holds the coefficients of the polynomial in R/scale for
+    # sum_j contrast_j (R + t_j)^(2n+3)/scale^(2n+3), expanded using the
+    # binomial theorem.
+    L = 2*N + 2
+    power = 2*np.arange(N)[:, None] + 3
+    a = np.arange(L)[None, :]
+    poly = np.zeros((N, L))
+    for dr, t in zip(contrast, offset):
+        poly += dr*_BINOMIAL[power[:, 0]]*(t/scale)**np.maximum(power - a, 0)
+    # E[p_n(R) p_k(R)] = p_n^T H p_k with H[a, b] = E[R^(a+b)]
+    moments = _scaled_moments(pd, scale, 2*L)
+    H = moments[np.add.outer(np.arange(L), np.arange(L))]
+    F1_coef = c*np.dot(poly, moments[:L])
+    cross = c[:, None]*c[None, :]*np.dot(np.dot(poly, H), poly.T)
+    index = np.add.outer(np.arange(N), np.arange(N))
+    F2_coef = np.bincount(index.ravel(), cross.ravel())
+    x2 = (q*scale)**2
+    A = 1e-2*4*np.pi*scale**3
+    return A*P.polyval(x2, F1_coef), A**2*P.polyval(x2, F2_coef)
+
+
+def _scaled_moments(pd, scale, n):
+    # type: (object, float, int) -> np.ndarray
+    """Return $E[(R/scale)^k]$ for $k$ in $0 \\ldots n$."""
+    if isinstance(pd, Gaussian):
+        return Gaussian(pd.mu/scale, pd.sigma/scale).moments(n)
+    return Schulz(pd.z, pd.theta/scale).moments(n)
+
+
+def Fq(kernel, call_details, values, cutoff, magnetic, radius_effective_mode):
+    # type: (Kernel, CallDetails, np.ndarray, float, bool, int) -> Optional[Tuple[np.ndarray, np.ndarray, float, float, float]]
+    """
+    Return the result of *kernel.Fq* in closed form, or None if the model,
+    the dispersity or the q range does not allow it.
+    """
+    info = kernel.info
+    if (info.concentric_shells is None or kernel.dim != '1d' or magnetic
+            or call_details.num_active != 1):
+        return None
+    partable = info.parameters
+    names = [p.id for p in partable.kernel_parameters]
+    if ('radius' not in names
+            or any(p.length != 1 for p in partable.kernel_parameters)
+            or call_details.pd_par[0] != names.index('radius')):
+        return None
+
+    dispersion = call_details.dispersion
+    if dispersion is None or 'radius' not in dispersion:
+        return None
+    index = names.index('radius')
+    pars = [float(v) for v in values[2:2+len(names)]]
+    pd_type, width = dispersion['radius']
+    if partable.kernel_parameters[index].relative_pd:
+        width *= pars[index]
+    pd = declared(pd_type, pars[index], width)
+    q = np.asarray(kernel.q_input.q[:kernel.q_input.nq], 'd')
+    if pd is None or len(q) == 0:
+        return None
+
+    nvalues = partable.nvalues
+    start = nvalues + call_details.pd_offset[0]
+    n = call_details.pd_length[0]
+    w = np.asarray(values[start+call_details.num_weights:
+                          start+call_details.num_weights+n], 'd')
+    keep = w > cutoff
+    contrast, offset, radius_offset = info.concentric_shells(*pars)
+    with trace.span("analytic", info.id,
+                    details=lambda: {'nq': len(q), 'npd': n}):
+        F1, F2 = average(pd, q, contrast, offset)
+    outer = pd.moments(3)
+    t = max(np.max(offset), 0.)
+    volume = 4*np.pi/3*(outer[3] + 3*t*outer[2] + 3*t**2*outer[1] + t**3)
+    if radius_effective_mode > 0:
+        radius_effective = pd.mean + radius_offset[radius_effective_mode-1]
+    else:
+        radius_effective = 0.
+    kernel.stats = KernelStats(np.sum(keep), np.sum(~keep), 0)
+    return (F1 if info.have_Fq else None), F2, radius_effective, volume, 1.0
+
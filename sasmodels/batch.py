@@ -0,0 +1,441 @@
+#!/usr/bin/env python
+r"""
+Batch fitting
+=============
+
+Fit the same model independently to each file in a series.
+
+Unlike *example/batch_fit.py*, which starts a new python process for each
+file, :func:`batch_fit` builds the model once and fits the files across a
+pool of worker processes.  The compiled model is loaded by each worker
+when the pool starts, so there is no per-file cost for generating and
+compiling the source or for reloading the DLL.  Files which share the
+same instrument settings (the same *q* points and resolution) also share
+the resolution calculator and the kernel, so the *q* inputs are only
+prepared once per worker.
+
+Results are streamed to a comma separated value (CSV) file as the fits
+complete, one row per file, with the fitted value and uncertainty for
+each fitted parameter, the final $\chi^2$ and whether the fit succeeded.
+
+Fits use the bumps optimizer, which must be installed.  For example::
+
+    from sasmodels.batch import batch_fit
+    results = batch_fit(
+        "ellipsoid@hayter_msa", ["093191_201.dat", "093192_202.dat"],
+        pars=dict(scale=6.4, background=0.06, sld=0.33, sld_solvent=2.15,
+                  radius_polar=14.0, radius_equatorial=24.0,
+                  volfraction=0.075, charge=66.373),
+        fit=dict(scale=(0, inf), background=(-inf, inf),
+                 sld_solvent=(-inf, inf)),
+        output="batch_fit.csv")
+
+From the command line this becomes::
+
+    python -m sasmodels.batch ellipsoid@hayter_msa 0931*.dat \
+        --output=batch_fit.csv --fit=scale:0:inf --fit=background \
+        scale=6.4 background=0.06 ...
+"""
+from __future__ import print_function
+
+import sys
+import os
+from hashlib import sha1
+from collections import OrderedDict
+import multiprocessing
+
+import numpy as np  # type: ignore
+
+from . import core
+from .data import load_data
+from .direct_model import DirectModel
+
+# pylint: disable=unused-import
+try:
+    from typing import Any, Callable, Dict, Iterator, List, Optional, Tuple
+    from .data import Data
+    from .kernel import KernelModel
+except ImportError:
+    pass
+# pylint: enable=unused-import
+
+#: Fields in the data object that determine the kernel inputs and the
+#: resolution calculator.  Files which agree on all of these, and have
+#: missing values in the same places (see :data:`MEASURED_FIELDS`), share
+#: them.
+INSTRUMENT_FIELDS = (
+    'x', 'dx', 'dxl', 'dxw', 'qmin', 'qmax', 'mask',
+    'qx_data', 'qy_data', 'dqx_data', 'dqy_data', 'accuracy',
+    )
+
+#: Measured values for 1D and 2D data.  Points where these are NaN are
+#: dropped from the kernel inputs, so the NaN pattern is part of the key.
+MEASURED_FIELDS = ('y', 'data')
+
+# State for each worker in the pool, set by _init_worker.  The model is
+# loaded once per worker and reused for every file.
+_WORKER = {}  # type: Dict[str, Any]
+
+
+def instrument_key(data):
+    # type: (Data) -> str
+    """
+    Return a digest of the instrument settings for *data*.
+
+    Datasets with the same key will produce identical kernel inputs and
+    resolution calculators.
+    """
+    digest = sha1(type(data).__name__.encode('utf8'))
+    for field in INSTRUMENT_FIELDS:
+        value = getattr(data, field, None)
+        digest.update(field.encode('utf8'))
+        if value is not None:
+            digest.update(np.ascontiguousarray(value).tobytes())
+    for field in MEASURED_FIELDS:
+        value = getattr(data, field, None)
+        if value is not None:
+            digest.update(field.encode('utf8'))
+            digest.update(np.isnan(value).tobytes())
+    return digest.hexdigest()
+
+
+def _init_worker(model_name, dtype, platform, pars, fit, cutoff,
+                 fitter, fit_options):
+    # type: (str, Optional[str], str, Dict[str, Any], Dict[str, Tuple[float, float]], float, Optional[Callable], Dict[str, Any]) -> None
+    """
+    Load the model and the DLL for the worker.
+    """
+    model = core.load_model(model_name, dtype=dtype, platform=platform)
+    # Preload the compiled kernel by instantiating it at a single q.  The
+    # DLL model is lazy loaded on the first call to make_kernel.
+    model.make_kernel([np.array([0.1])]).release()
+    _WORKER.clear()
+    _WORKER.update(
+        model=model, pars=pars, fit=fit, cutoff=cutoff,
+        fitter=fitter if fitter is not None else bumps_fit,
+        fit_options=fit_options,
+        inputs={},  # instrument key => (resolution, kernel)
+        )
+
+
+class BatchProblem(DirectModel):
+    """
+    Model evaluator for one file in the batch.
+
+    *data* and *model* are as for :class:`.direct_model.DirectModel`.
+    *pars* holds the initial parameter values and *fit* maps fitted
+    parameter names to their *(low, high)* range.
+
+    *shared* is an optional *(resolution, kernel)* pair from an earlier
+    problem with the same instrument settings, which is reused rather
+    than creating a new kernel for the same *q* points.
+    """
+    def __init__(self, data, model, pars, fit, cutoff=1e-5, shared=None):
+        # type: (Data, KernelModel, Dict[str, Any], Dict[str, Tuple[float, float]], float, Optional[Tuple[Any, Any]]) -> None
+        resolution, kernel = shared if shared is not None else (None, None)
+        DirectModel.__init__(self, data, model, cutoff=cutoff,
+                             resolution=resolution)
+        self.pars = pars
+        self.fit = fit
+        if kernel is None:
+            kernel = model.make_kernel(self._kernel_inputs())
+        self._kernel = kernel
+
+    def shared(self):
+        # type: () -> Tuple[Any, Any]
+        """Return the *(resolution, kernel)* pair to share with other files."""
+        return self.resolution, self._kernel
+
+    def experiment(self):
+        # type: () -> "Experiment"
+        """
+        Return a bumps experiment for the problem, using the shared kernel.
+        """
+        from .bumps_model import Model, Experiment
+
+        model = Model(self._model, **self.pars)
+        for name, limits in self.fit.items():
+            getattr(model, name).range(*limits)
+        experiment = Experiment(data=self._data, model=model,
+                                cutoff=self.cutoff, resolution=self.resolution)
+        # The experiment creates its kernel on first use, so give it ours.
+        experiment._kernel = self._kernel
+        return experiment
+
+
+def _problem(data):
+    # type: (Data) -> BatchProblem
+    """
+    Build the problem for *data* using the worker model, sharing the
+    resolution and kernel with any previous data from the same instrument
+    configuration.
+    """
+    key = instrument_key(data)
+    shared = _WORKER['inputs'].get(key, None)
+    problem = BatchProblem(
+        data, _WORKER['model'], _WORKER['pars'], _WORKER['fit'],
+        cutoff=_WORKER['cutoff'], shared=shared)
+    if shared is None:
+        _WORKER['inputs'][key] = problem.shared()
+    return problem
+
+
+def _fit_one(task):
+    # type: (Tuple[int, Any]) -> Tuple[int, Dict[str, Any]]
+    """
+    Fit a single file in the worker, returning the index of the file
+    and a dictionary of results.
+    """
+    index, source = task
+    name = source if isinstance(source, str) else getattr(source, 'filename', str(index))
+    try:
+        data = load_data(source) if isinstance(source, str) else source
+        problem = _problem(data)
+        result = _WORKER['fitter'](problem, **_WORKER['fit_options'])
+        result['filename'] = name
+    except Exception as exc:
+        result = {'filename': name, 'success': False, 'message': str(exc)}
+    return index, result
+
+
+def bumps_fit(problem, method='lm', **options):
+    # type: (BatchProblem, str, **Any) -> Dict[str, Any]
+    """
+    Fit *problem* with bumps using the fit *method* and *options*.
+
+    Returns a dictionary with the fitted *values* and *errors* keyed by
+    parameter name, the reduced *chisq* and the *success* flag.
+    """
+    from bumps.names import FitProblem
+    from bumps.fitters import fit
+
+    fitproblem = FitProblem(problem.experiment())
+    result = fit(fitproblem, method=method, verbose=False, **options)
+    fitproblem.setp(result.x)
+    labels = fitproblem.labels()
+    dx = getattr(result, 'dx', None)
+    return {
+        'values': OrderedDict(zip(labels, result.x)),
+        'errors': OrderedDict(zip(labels, dx if dx is not None
+                                  else [np.nan]*len(labels))),
+        'chisq': fitproblem.chisq(),
+        'success': bool(getattr(result, 'success', True)),
+        }
+
+
+class CsvWriter(object):
+    """
+    Write batch results to *path* one row at a time.
+
+    The header is determined from the first result, with columns for the
+    file name, success flag, $\\chi^2$ and then the value and uncertainty
+    of each fitted parameter.  Failed fits are written with empty values.
+    """
+    def __init__(self, path, parameters):
+        # type: (str, List[str]) -> None
+        self.parameters = parameters
+        self._fid = open(path, 'w')
+        columns = ['filename', 'success', 'chisq']
+        for p in parameters:
+            columns.extend((p, p + '_err'))
+        self._write(columns)
+
+    def _write(self, columns):
+        # type: (List[str]) -> None
+        self._fid.write(','.join(columns) + '\n')
+        self._fid.flush()
+
+    def write(self, result):
+        # type: (Dict[str, Any]) -> None
+        """Add a row for *result*."""
+        values = result.get('values', {})
+        errors = result.get('errors', {})
+        columns = [result['filename'], str(int(result['success'])),
+                   _fmt(result.get('chisq', None))]
+        for p in self.parameters:
+            columns.extend((_fmt(values.get(p, None)), _fmt(errors.get(p, None))))
+        self._write(columns)
+
+    def close(self):
+        # type: () -> None
+        """Close the output file."""
+        self._fid.close()
+
+
+def _fmt(value):
+    # type: (Optional[float]) -> str
+    return "" if value is None else repr(float(value))
+
+
+def batch_fit(model, files, pars=None, fit=None, output=None,
+              processes=None, dtype=None, platform='dll', cutoff=1e-5,
+              fitter=None, **fit_options):
+    # type: (str, List[Any], Optional[Dict[str, Any]], Optional[Dict[str, Tuple[float, float]]], Optional[str], Optional[int], Optional[str], str, float, Optional[Callable], **Any) -> List[Dict[str, Any]]
+    """
+    Fit *model* independently to each file in *files*.
+
+    *model* is a model name or model expression as accepted by
+    :func:`.core.load_model_info`.
+
+    *files* is a list of file names to load with :func:`.data.load_data`,
+    or data objects which have already been loaded.
+
+    *pars* gives the initial parameter values, and *fit* maps the names
+    of the fitted parameters to their *(low, high)* range.
+
+    *output* is the CSV file which receives the results as each fit
+    completes.  Results are written in file order.
+
+    *processes* is the size of the worker pool, which defaults to the
+    number of CPUs.  Use *processes=0* to fit in the current process.
+
+    *dtype*, *platform* and *cutoff* control the model evaluation, as
+    for :func:`.core.load_model` and :class:`.bumps_model.Experiment`.
+
+    *fitter(problem, \\*\\*fit_options)* performs the fit on a
+    :class:`BatchProblem`, returning a dictionary of *values* and *errors* keyed by parameter name along
+    with *chisq* and *success*.  The default is :func:`bumps_fit`, with
+    the remaining keyword arguments, such as *method='lm'* or *steps=200*,
+    passed to the bumps fitter.
+
+    Returns the list of result dictionaries, one for each file.
+    """
+    pars = dict(pars) if pars is not None else {}
+    fit = dict(fit) if fit is not None else {}
+    parameters = list(fit.keys())
+
+    # Build the model in the parent so that the DLL is compiled once, and
+    # not by each of the workers as they start.
+    core.load_model(model, dtype=dtype, platform=platform)
+
+    init_args = (model, dtype, platform, pars, fit, cutoff, fitter, fit_options)
+    tasks = list(enumerate(files))
+    writer = CsvWriter(output, parameters) if output is not None else None
+    results = []
+    try:
+        if processes == 0:
+            _init_worker(*init_args)
+            stream = map(_fit_one, tasks)
+            pool = None
+        else:
+            pool = multiprocessing.Pool(
+                processes=processes, initializer=_init_worker,
+                initargs=init_args)
+            stream = pool.imap(_fit_one, tasks)
+        for _, result in stream:
+            if writer is not None:
+                writer.write(result)
+            results.append(result)
+    finally:
+        if processes == 0:
+            _WORKER.clear()
+        elif pool is not None:
+            pool.close()
+            pool.join()
+        if writer is not None:
+            writer.close()
+    return results
+
+
+def _parse_value(value):
+    # type: (str) -> Any
+    try:
+        return float(value)
+    except ValueError:
+        return value
+
+
+def main(argv=None):
+    # type: (Optional[List[str]]) -> None
+    """
+    Run a batch fit from the command line.
+    """
+    argv = sys.argv[1:] if argv is None else argv
+    opts = [v for v in argv if v.startswith('--')]
+    args = [v for v in argv if not v.startswith('--')]
+    if len(args) < 2:
+        print("usage: python -m sasmodels.batch model file... [par=value...]"
+              " [--fit=par:low:high...] [--output=batch_fit.csv]"
+              " [--processes=n] [--method=lm] [--steps=n]")
+        sys.exit(1)
+
+    model = args[0]
+    files = [v for v in args[1:] if '=' not in v]
+    pars = dict((k, _parse_value(v))
+                for k, v in (pair.split('=', 1) for pair in args[1:] if '=' in pair))
+    fit = {}
+    output, processes, fit_options = 'batch_fit.csv', None, {}
+    for opt in opts:
+        key, _, value = opt[2:].partition('=')
+        if key == 'fit':
+            name, *limits = value.split(':')
+            low, high = ([float(v) for v in limits] if limits
+                         else (-np.inf, np.inf))
+            fit[name] = (low, high)
+        elif key == 'output':
+            output = value
+        elif key == 'processes':
+            processes = int(value)
+        else:
+            fit_options[key] = _parse_value(value)
+
+    missing = [f for f in files if not os.path.isfile(f)]
+    if missing:
+        print("Missing data files: %s" % ", ".join(missing))
+        sys.exit(1)
+    batch_fit(model, files, pars=pars, fit=fit, output=output,
+              processes=processes, **fit_options)
+
+
+def test_batch_fit():
+    # type: () -> None
+    """Check that shared kernels are reused within the batch"""
+    import tempfile
+    from scipy.optimize import least_squares
+    from .data import empty_data1D
+
+    kernels = []
+    def fitter(problem):
+        # Fit the scale with scipy so that the test does not need bumps.
+        kernels.append(problem._kernel)
+        def residuals(p):
+            theory = problem(**dict(problem.pars, scale=p[0]))
+            return (theory - problem.Iq)/problem.dIq
+        result = least_squares(residuals, [1.0])
+        return {'values': {'scale': result.x[0]}, 'errors': {},
+                'chisq': 2*result.cost/len(problem.Iq),
+                'success': result.success}
+
+    q = np.logspace(-3, -1, 20)
+    model = core.load_model('sphere', dtype='double', platform='dll')
+    datasets = []
+    for scale in (0.5, 1.5, 3.0, 2.0):
+        data = empty_data1D(q)
+        DirectModel(data, model).simulate_data(noise=1, scale=scale, radius=50)
+        datasets.append(data)
+    # A missing point changes the kernel inputs, so it needs its own kernel.
+    datasets[-1].y[3] = np.nan
+
+    fid, path = tempfile.mkstemp(suffix='.csv')
+    os.close(fid)
+    try:
+        results = batch_fit(
+            'sphere', datasets, pars=dict(radius=50), fit=dict(scale=(0, 10)),
+            output=path, processes=0, dtype='double', fitter=fitter)
+        with open(path) as fid:
+            lines = fid.read().splitlines()
+    finally:
+        os.unlink(path)
+    assert all(r['success'] for r in results)
+    for r, scale in zip(results, (0.5, 1.5, 3.0, 2.0)):
+        assert abs(r['values']['scale'] - scale) < 0.05*scale
+    assert lines[0] == 'filename,success,chisq,scale,scale_err'
+    assert len(lines) == 5
+    # Datasets with the same q and no missing values share one kernel.
+    assert all(k is kernels[0] for k in kernels[:3])
+    assert kernels[3] is not kernels[0]
+    assert kernels[3].q_input.nq == len(q) - 1
+
+
+if __name__ == "__main__":
+    main()
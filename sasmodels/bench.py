@@ -0,0 +1,428 @@
+#!/usr/bin/env python
+"""
+Benchmark the model kernels and track performance regressions.
+
+Each builtin model is timed over a matrix of cases, varying
+
+* *nq*, the number of $q$ points,
+* *dim*, whether the model is evaluated for 1-D or 2-D data,
+* *pd*, the number of active polydispersity loops,
+* *magnetic*, whether magnetism is on (2-D only), and
+* *engine*, the computational backend: *python* for models written
+  in python, *dll* for compiled C models, *opencl* for the default OpenCL
+  device or *opencl-cpu* for OpenCL pinned to a CPU device.
+
+The throughput for each case is reported as the number of $q$ points times
+the number of polydispersity points evaluated per second.  Only the kernel
+call is timed, so the parameter packing and the resolution calculation are
+not included.  Cases that do not apply, such as magnetism for a model
+without magnetic parameters, or more polydispersity loops than the model
+has, are skipped.
+
+The results are written as JSON, which can be stored as a baseline for a
+later run.  When comparing against a baseline, any case whose throughput
+has dropped by more than the threshold fraction is reported as a
+regression, and the program exits with a non-zero status.
+
+Usage::
+
+    python -m sasmodels.bench [options] [model ...]
+
+Options:
+
+    --nq=10,1000,100000   number of q points
+    --dim=1d,2d           dimension
+    --pd=0,1,2,3,4        number of polydisperse parameters
+    --npts=10             points in each polydispersity loop
+    --magnetic            include magnetic cases
+    --engine=python,dll,opencl-cpu
+                          computational engines
+    --dtype=double        precision
+    --time=0.2            target time in seconds for each case
+    --out=bench.json      output file
+    --baseline=file.json  compare against stored results
+    --threshold=0.1       allowed fractional drop in throughput
+    --threshold=model:0.2 threshold for a particular model
+
+The default is all models with nq=10,1000,100000, 1-D and 2-D, pd=0 to 4
+and the python, dll and opencl-cpu engines, without magnetism.  The CPU
+OpenCL device is chosen independently of *SAS_OPENCL*, so the timings are
+comparable between machines with and without a GPU; cases for the
+*opencl-cpu* engine are skipped if there is no CPU OpenCL driver.  Throughput in a
+shared environment can vary by 10% or more, so thresholds below that will
+give false alarms.
+"""
+from __future__ import print_function, division
+
+import os
+import sys
+import json
+import time
+import platform as _platform
+from collections import OrderedDict
+from contextlib import contextmanager
+from itertools import product
+
+import numpy as np  # type: ignore
+
+from . import core
+from . import kernelcl
+from .compare import get_pars
+from .direct_model import get_mesh
+from .details import make_kernel_args
+
+# pylint: disable=unused-import
+try:
+    from typing import Any, Dict, Iterator, List, Optional, Sequence, Tuple
+    from .kernel import KernelModel
+    from .modelinfo import ModelInfo
+except ImportError:
+    pass
+# pylint: enable=unused-import
+
+#: Default benchmark matrix.
+DEFAULTS = dict(
+    nq=[10, 1000, 100000],
+    dim=['1d', '2d'],
+    pd=[0, 1, 2, 3, 4],
+    magnetic=[False],
+    engine=['python', 'dll', 'opencl-cpu'],
+    npts=10,
+    dtype='double',
+    time=0.2,
+    )
+
+#: Default allowed fractional drop in throughput.
+THRESHOLD = 0.1
+
+
+def case_key(case):
+    # type: (Dict[str, Any]) -> str
+    """
+    Return a string key identifying the benchmark *case*.
+    """
+    return "%s nq=%d %s pd=%d%s %s[%s]" % (
+        case['model'], case['nq'], case['dim'], case['pd'],
+        " magnetic" if case['magnetic'] else "",
+        case['engine'], case['dtype'])
+
+
+def _q_vectors(nq, dim):
+    # type: (int, str) -> List[np.ndarray]
+    if dim == '1d':
+        return [np.logspace(-3, -0.3, nq)]
+    # Points on a square detector, truncated to nq.
+    n = int(np.ceil(np.sqrt(nq)))
+    qx, qy = np.meshgrid(*[np.linspace(-0.3, 0.3, n)]*2)
+    return [qx.flatten()[:nq], qy.flatten()[:nq]]
+
+
+def _bench_pars(model_info, dim, pd, magnetic, npts):
+    # type: (ModelInfo, str, int, bool, int) -> Optional[Dict[str, Any]]
+    """
+    Return the parameters for the case, or None if the case does not apply.
+    """
+    pars = get_pars(model_info)
+    table = model_info.parameters
+    candidates = table.pd_2d if dim == '2d' else table.pd_1d
+    # Use the polydisperse parameters in table order, skipping any vector
+    # parameters which get_pars does not expand.
+    pd_names = [p.id for p in table.call_parameters
+                if p.id in candidates and p.id + '_pd' in pars][:pd]
+    if len(pd_names) < pd:
+        return None
+    for name in pd_names:
+        pars[name + '_pd'] = 0.1 if pars[name] else 10.
+        pars[name + '_pd_n'] = npts
+    if magnetic:
+        if dim != '2d' or not table.magnetism_index:
+            return None
+        for k in table.magnetism_index:
+            pars[table.call_parameters[k].id] = 1.0
+        pars.update(up_frac_i=0.1, up_frac_f=0.9)
+    return pars
+
+
+def _cpu_environment():
+    # type: () -> Optional[kernelcl.GpuEnvironment]
+    """
+    Return an OpenCL environment on a CPU device, or None if there is none.
+    """
+    if not kernelcl.use_opencl():
+        return None
+    for platform_index, platform in enumerate(kernelcl.cl.get_platforms()):
+        for device_index, device in enumerate(platform.get_devices()):
+            if device.type != kernelcl.cl.device_type.CPU:
+                continue
+            # GpuEnvironment selects the device from SAS_OPENCL, and copies
+            # it to PYOPENCL_CTX, so restore both when done.
+            saved = dict((k, os.environ.get(k))
+                         for k in ('SAS_OPENCL', 'PYOPENCL_CTX'))
+            os.environ['SAS_OPENCL'] = "%d:%d" % (platform_index, device_index)
+            try:
+                return kernelcl.GpuEnvironment()
+            finally:
+                for k, v in saved.items():
+                    if v is None:
+                        os.environ.pop(k, None)
+                    else:
+                        os.environ[k] = v
+    return None
+
+
+@contextmanager
+def _opencl_environment(env):
+    # type: (Optional[kernelcl.GpuEnvironment]) -> Iterator[None]
+    """
+    Use *env* as the OpenCL environment within the block, or the default
+    environment if *env* is None.
+    """
+    if env is None:
+        yield
+        return
+    saved, kernelcl.ENV = kernelcl.ENV, env
+    try:
+        yield
+    finally:
+        kernelcl.ENV = saved
+
+
+def _engine_available(engine, model_info, cpu_env=None):
+    # type: (str, ModelInfo, Optional[kernelcl.GpuEnvironment]) -> bool
+    is_python = callable(model_info.Iq)
+    if engine == 'python':
+        return is_python
+    if is_python:
+        return False
+    if engine == 'opencl':
+        return kernelcl.use_opencl()
+    if engine == 'opencl-cpu':
+        return cpu_env is not None
+    return engine == 'dll'
+
+
+def time_kernel(kernel, pars, target=0.2):
+    # type: (Any, Dict[str, Any], float) -> Tuple[float, int]
+    """
+    Time a call to *kernel* with parameters *pars*.
+
+    The kernel is called repeatedly for at least *target* seconds, and
+    the best time for a single call is returned along with the number of
+    polydispersity points evaluated per *q* point.
+    """
+    mesh = get_mesh(kernel.info, pars, dim=kernel.dim)
+    call_details, values, is_magnetic = make_kernel_args(kernel, mesh)
+    kernel(call_details, values, 0., is_magnetic)  # warm up
+    best, total = np.inf, 0.
+    while total < target or not np.isfinite(best):
+        start = time.perf_counter()
+        kernel(call_details, values, 0., is_magnetic)
+        elapsed = time.perf_counter() - start
+        best, total = min(best, elapsed), total + elapsed
+    return best, max(int(call_details.num_eval), 1)
+
+
+def cases(models, opts):
+    # type: (Sequence[str], Dict[str, Any]) -> Iterator[Dict[str, Any]]
+    """
+    Generate the benchmark cases for *models* given the options in *opts*.
+    """
+    for name, engine, nq, dim, pd, magnetic in product(
+            models, opts['engine'], opts['nq'], opts['dim'], opts['pd'],
+            opts['magnetic']):
+        yield OrderedDict((
+            ('model', name), ('nq', nq), ('dim', dim), ('pd', pd),
+            ('magnetic', magnetic), ('engine', engine),
+            ('dtype', opts['dtype']),
+            ))
+
+
+def run(models=None, progress=None, **kw):
+    # type: (Optional[Sequence[str]], Optional[Any], **Any) -> Dict[str, Any]
+    """
+    Run the benchmark for *models*, which defaults to all builtin models.
+
+    Keyword arguments override the options in :data:`DEFAULTS`.  If
+    *progress* is a file, one line is written to it for each case.
+
+    Returns a dictionary with a *meta* section describing the machine and a
+    *results* list with the timing for each case.
+    """
+    opts = dict(DEFAULTS, **kw)
+    if models is None:
+        models = core.list_models()
+    cpu_env = _cpu_environment() if 'opencl-cpu' in opts['engine'] else None
+    results = []
+    built = {}  # type: Dict[Tuple[str, str], KernelModel]
+    for case in cases(models, opts):
+        model_info = core.load_model_info(case['model'])
+        if not _engine_available(case['engine'], model_info, cpu_env):
+            continue
+        # The python kernels do not implement magnetism.
+        if case['magnetic'] and case['engine'] == 'python':
+            continue
+        pars = _bench_pars(model_info, case['dim'], case['pd'],
+                           case['magnetic'], opts['npts'])
+        if pars is None:
+            continue
+        key = (case['model'], case['engine'])
+        env = cpu_env if case['engine'] == 'opencl-cpu' else None
+        with _opencl_environment(env):
+            if key not in built:
+                platform = ('ocl' if case['engine'].startswith('opencl')
+                            else 'dll')
+                built[key] = core.build_model(
+                    model_info, dtype=opts['dtype'], platform=platform)
+            kernel = built[key].make_kernel(
+                _q_vectors(case['nq'], case['dim']))
+            try:
+                seconds, points = time_kernel(
+                    kernel, pars, target=opts['time'])
+            finally:
+                kernel.release()
+        case['seconds'] = seconds
+        case['points'] = points
+        case['throughput'] = case['nq']*points/seconds
+        results.append(case)
+        if progress is not None:
+            print("%-50s %10.3g points/s" % (case_key(case), case['throughput']),
+                  file=progress)
+    meta = OrderedDict((
+        ('time', time.strftime('%Y-%m-%dT%H:%M:%S')),
+        ('machine', _platform.machine()),
+        ('processor', _platform.processor()),
+        ('system', _platform.platform()),
+        ('python', _platform.python_version()),
+        ('numpy', np.__version__),
+        ('npts', opts['npts']),
+        ))
+    return OrderedDict((('meta', meta), ('results', results)))
+
+
+def compare(current, baseline, threshold=THRESHOLD):
+    # type: (Dict[str, Any], Dict[str, Any], Any) -> List[Tuple[str, float, float]]
+    """
+    Compare *current* benchmark results against *baseline*.
+
+    *threshold* is the allowed fractional drop in throughput.  It may be
+    a number or a dictionary mapping model names to thresholds, with the
+    default for other models given by the key *None*.
+
+    Returns a list of *(case, baseline, current)* throughput for each case
+    which has regressed.  Cases which are not in both sets are ignored.
+    """
+    if not isinstance(threshold, dict):
+        threshold = {None: threshold}
+    default = threshold.get(None, THRESHOLD)
+    reference = dict((case_key(case), case['throughput'])
+                     for case in baseline['results'])
+    regressions = []
+    for case in current['results']:
+        key = case_key(case)
+        if key not in reference:
+            continue
+        limit = threshold.get(case['model'], default)
+        if case['throughput'] < reference[key]*(1 - limit):
+            regressions.append((key, reference[key], case['throughput']))
+    return regressions
+
+
+def _parse_list(value, convert=str):
+    return [convert(v) for v in value.split(',')]
+
+
+def main(argv=None):
+    # type: (Optional[List[str]]) -> int
+    """
+    Run the benchmark from the command line.
+    """
+    argv = sys.argv[1:] if argv is None else argv
+    opts = {}  # type: Dict[str, Any]
+    thresholds = {None: THRESHOLD}  # type: Dict[Optional[str], float]
+    out, baseline = None, None
+    models = [v for v in argv if not v.startswith('--')]
+    for arg in argv:
+        if not arg.startswith('--'):
+            continue
+        key, _, value = arg[2:].partition('=')
+        if key == 'nq':
+            opts['nq'] = _parse_list(value, lambda v: int(float(v)))
+        elif key == 'dim':
+            opts['dim'] = _parse_list(value)
+        elif key == 'pd':
+            opts['pd'] = _parse_list(value, int)
+        elif key == 'npts':
+            opts['npts'] = int(value)
+        elif key == 'magnetic':
+            opts['magnetic'] = [False, True]
+        elif key == 'engine':
+            opts['engine'] = _parse_list(value)
+        elif key == 'dtype':
+            opts['dtype'] = value
+        elif key == 'time':
+            opts['time'] = float(value)
+        elif key == 'out':
+            out = value
+        elif key == 'baseline':
+            baseline = value
+        elif key == 'threshold':
+            model, _, limit = value.rpartition(':')
+            thresholds[model if model else None] = float(limit)
+        else:
+            print("unknown option --%s" % key, file=sys.stderr)
+            return 2
+
+    results = run(models if models else None, progress=sys.stdout, **opts)
+    if out is not None:
+        with open(out, 'w') as fid:
+            json.dump(results, fid, indent=2)
+    if baseline is not None:
+        with open(baseline) as fid:
+            reference = json.load(fid)
+        regressions = compare(results, reference, thresholds)
+        for key, old, new in regressions:
+            print("REGRESSION %s: %.3g => %.3g points/s (%+.1f%%)"
+                  % (key, old, new, 100*(new/old - 1)))
+        if regressions:
+            return 1
+    return 0
+
+
+def test_bench():
+    # type: () -> None
+    """Check that the benchmark runs and detects regressions"""
+    results = run(['sphere', 'cylinder', '_spherepy'], nq=[10],
+                  dim=['1d', '2d'], pd=[0, 1, 4], magnetic=[False, True],
+                  engine=['dll', 'python', 'opencl-cpu'], npts=5, time=0.)
+    keys = [case_key(case) for case in results['results']]
+    # sphere has no 2-D parameters, but can still be evaluated for 2-D data.
+    assert "sphere nq=10 1d pd=1 dll[double]" in keys
+    assert "cylinder nq=10 2d pd=1 magnetic dll[double]" in keys
+    assert "sphere nq=10 1d pd=0 magnetic dll[double]" not in keys
+    # Only the python model runs on the python engine, and only it.
+    assert "_spherepy nq=10 1d pd=1 python[double]" in keys
+    assert "_spherepy nq=10 2d pd=1 magnetic python[double]" not in keys
+    assert not any('python' in key for key in keys
+                   if not key.startswith('_spherepy'))
+    assert not any(key.startswith('_spherepy') and 'dll' in key
+                   for key in keys)
+    # cylinder has four 2-D polydisperse parameters but only two in 1-D.
+    assert "cylinder nq=10 2d pd=4 dll[double]" in keys
+    assert "cylinder nq=10 1d pd=4 dll[double]" not in keys
+    if _cpu_environment() is None:
+        assert not any('opencl-cpu' in key for key in keys)
+    points = dict(zip(keys, (case['points'] for case in results['results'])))
+    assert points["cylinder nq=10 2d pd=1 dll[double]"] == 5
+    assert points["cylinder nq=10 2d pd=4 dll[double]"] == 5**4
+    assert points["_spherepy nq=10 1d pd=1 python[double]"] == 5
+
+    # JSON round trip, then slow one case down by half.
+    baseline = json.loads(json.dumps(results))
+    assert compare(results, baseline) == []
+    results['results'][0]['throughput'] *= 0.5
+    assert len(compare(results, baseline)) == 1
+    assert compare(results, baseline, {None: 0.1, 'sphere': 0.6}) == []
+
+
+if __name__ == "__main__":
+    sys.exit(main())
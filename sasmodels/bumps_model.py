@@ -18,7 +18,7 @@ __all__ = ["Model", "Experiment", "BumpsParameter"]
 import numpy as np  # type: ignore
 
 from .data import plot_theory
-from .direct_model import DataMixin
+from .direct_model import DataMixin, DispersityConvergence
 
 # pylint: disable=unused-import
 try:
@@ -136,11 +136,19 @@ class Experiment(DataMixin):
     *cutoff* is the integration cutoff, which avoids computing the
     the SAS model where the polydispersity weight is low.
 
+    *pd_tolerance*, if given, selects the number of dispersity points
+    automatically.  See :class:`.direct_model.DispersityConvergence`.
+
+    *resolution*, if given, is the resolution calculator from another
+    experiment on the same q points, which is used rather than building a
+    new one for *data*.
+
     The resulting model can be used directly in a Bumps FitProblem call.
     """
     _cache = None # type: Dict[str, np.ndarray]
-    def __init__(self, data, model, cutoff=1e-5, name=None, extra_pars=None):
-        # type: (Data, Model, float, Optional[str], Optional[Dict[str, BumpsParameter]]) -> None
+    def __init__(self, data, model, cutoff=1e-5, name=None, extra_pars=None,
+                 pd_tolerance=None, resolution=None):
+        # type: (Data, Model, float, Optional[str], Optional[Dict[str, BumpsParameter]], Optional[float], Optional[Resolution]) -> None
         # Allow resolution function to define fittable parameters.  We do this
         # by creating reference parameters within the resolution object rather
         # than modifying the object itself to use bumps parameters.  We need
@@ -157,7 +165,10 @@ class Experiment(DataMixin):
         self.name = data.filename if name is None else name
         self.model = model
         self.cutoff = cutoff
-        self._interpret_data(data, model.sasmodel)
+        if pd_tolerance is not None:
+            self.dispersity = DispersityConvergence(pd_tolerance)
+        self._interpret_data(data, model.sasmodel,
+                             shared_resolution=resolution)
         self._cache = {}
         # CRUFT: no longer need extra parameters
         # Multiple scattering probability is now retrieved directly from the
@@ -289,6 +300,7 @@ class Experiment(DataMixin):
         # Can't pickle gpu functions, so instead make them lazy
         state = self.__dict__.copy()
         state['_kernel'] = None
+        state['_refine_kernels'] = None
         return state
 
     def __setstate__(self, state):
@@ -4,9 +4,10 @@
 Program to compare models using different compute engines.
 
 This program lets you compare results between OpenCL and DLL versions
-of the code and between precision (half, fast, single, double, quad),
+of the code and between precision (half, fast, single, mixed, double, quad),
 where fast precision is single precision using native functions for
-trig, etc., and may not be completely IEEE 754 compliant.  This lets
+trig, etc., and may not be completely IEEE 754 compliant, and mixed
+precision is single precision with the sums accumulated in double.  This lets
 make sure that the model calculations are stable, or if you need to
 tag the model as double precision only.
 
@@ -102,8 +103,8 @@ Options (* for default):
 
     === precision options ===
     -engine=default uses the default calcution precision
-    -single/-double/-half/-fast sets an OpenCL calculation engine
-    -single!/-double!/-quad! sets an OpenMP calculation engine
+    -single/-double/-half/-fast/-mixed sets an OpenCL calculation engine
+    -single!/-double!/-quad!/-mixed! sets an OpenMP calculation engine
 
     === plotting ===
     -plot*/-noplot plots or suppress the plot of the model
@@ -737,7 +738,9 @@ def make_engine(
     calculator = DirectModel(data, model, cutoff=cutoff)
     engine_type = calculator._model.__class__.__name__.replace('Model', '').upper()
     bits = calculator._model.dtype.itemsize*8
-    precision = "fast" if getattr(calculator._model, 'fast', False) else str(bits)
+    precision = ("fast" if getattr(calculator._model, 'fast', False)
+                 else "mixed" if getattr(calculator._model, 'mixed', False)
+                 else str(bits))
     calculator.engine = "%s[%s]" % (engine_type, precision)
     return calculator
 
@@ -1042,7 +1045,8 @@ OPTIONS = [
 
     # Precision options
     'engine=',
-    'half', 'fast', 'single', 'double', 'single!', 'double!', 'quad!',
+    'half', 'fast', 'single', 'mixed', 'double',
+    'single!', 'mixed!', 'double!', 'quad!',
 
     # Output options
     'help', 'html', 'edit',
@@ -1265,7 +1269,9 @@ def parse_opts(argv):
         elif arg == '-fast':    opts['engine'] = 'fast'
         elif arg == '-single':  opts['engine'] = 'single'
         elif arg == '-double':  opts['engine'] = 'double'
+        elif arg == '-mixed':   opts['engine'] = 'mixed'
         elif arg == '-single!': opts['engine'] = 'single!'
+        elif arg == '-mixed!':  opts['engine'] = 'mixed!'
         elif arg == '-double!': opts['engine'] = 'double!'
         elif arg == '-quad!':   opts['engine'] = 'quad!'
         elif arg == '-edit':    opts['explore'] = True
@@ -87,8 +87,10 @@ PRECISION = {
     'fast': 1e-3,
     'half': 1e-3,
     'single': 5e-5,
+    'mixed': 5e-5,
     'double': 5e-14,
     'single!': 5e-5,
+    'mixed!': 5e-5,
     'double!': 5e-14,
     'quad!': 5e-18,
 }
@@ -233,7 +235,7 @@ is set in compare.py defaults for each model.
 
 PRECISION is the floating point precision to use for comparisons.  If two
 precisions are given, then compare one to the other.  Precision is one of
-fast, single, double for GPU or single!, double!, quad! for DLL.  If no
+fast, single, mixed, double for GPU or single!, mixed!, double!, quad! for DLL.  If no
 precision is given, then use single and double! respectively.
 """)
 
@@ -12,6 +12,7 @@ import os
 from os.path import basename, join as joinpath
 from glob import glob
 import re
+import logging
 import copy
 
 import numpy as np # type: ignore
@@ -308,11 +309,14 @@ def build_model(model_info, dtype=None, platform="ocl"):
 
     *dtype* indicates whether the model should use single or double precision
     for the calculation.  Choices are 'single', 'double', 'quad', 'half',
-    or 'fast'.  If *dtype* ends with '!', then force the use of the DLL rather
-    than OpenCL for the calculation.
+    'fast' or 'mixed'.  If *dtype* ends with '!', then force the use of the
+    DLL rather than OpenCL for the calculation.
 
     *platform* should be "dll" to force the dll to be used for C models,
-    otherwise it uses the default "ocl".
+    otherwise it uses the default "ocl".  Use "numba" to compile pure python
+    models with numba, falling back to the default for C models.  Set the
+    environment variable SAS_NUMBA=1 to use numba for python models by
+    default.
     """
     composition = model_info.composition
     if composition is not None:
@@ -322,28 +326,73 @@ def build_model(model_info, dtype=None, platform="ocl"):
             return mixture.MixtureModel(model_info, models)
         elif composition_type == 'product':
             P, S = models
+            P = _fuse_product(model_info, P, S)
             return product.ProductModel(model_info, P, S)
         else:
             raise ValueError('unknown mixture type %s'%composition_type)
 
     # If it is a python model, return it immediately
     if callable(model_info.Iq):
+        from . import kernelnumba
+        if kernelnumba.HAVE_NUMBA and (
+                platform == "numba" or kernelnumba.use_numba()):
+            return kernelnumba.NumbaModel(model_info)
         from . import kernelpy
         return kernelpy.PyModel(model_info)
 
-    numpy_dtype, fast, platform = parse_dtype(model_info, dtype, platform)
+    numpy_dtype, fast, mixed, platform = parse_dtype(
+        model_info, dtype, platform)
     source = generate.make_source(model_info)
     if platform == "dll":
         from . import kerneldll
         #print("building dll", numpy_dtype)
-        return kerneldll.load_dll(source['dll'], model_info, numpy_dtype)
+        model = kerneldll.load_dll(source['dll'], model_info, numpy_dtype,
+                                   mixed=mixed)
     elif platform == "cuda":
         from . import kernelcuda
-        return kernelcuda.GpuModel(source, model_info, numpy_dtype, fast=fast)
+        model = kernelcuda.GpuModel(source, model_info, numpy_dtype,
+                                    fast=fast, mixed=mixed)
     else:
         from . import kernelcl
         #print("building ocl", numpy_dtype)
-        return kernelcl.GpuModel(source, model_info, numpy_dtype, fast=fast)
+        model = kernelcl.GpuModel(source, model_info, numpy_dtype,
+                                  fast=fast, mixed=mixed)
+
+    # Size dispersity for models with a single length scale by FFT.
+    if model_info.scale_invariant:
+        from . import logfft
+        model = logfft.LogFFTModel(model_info, model)
+    return model
+
+def _fuse_product(model_info, P, S):
+    # type: (ModelInfo, KernelModel, KernelModel) -> KernelModel
+    """
+    Return the form factor for the product *model_info*, built from a dll
+    with the fused P@S kernel if P and S are both double precision dlls.
+    Otherwise return *P* unchanged, and the product will be computed from
+    separate P and S kernels.
+    """
+    from . import kerneldll
+    from . import logfft
+    form = P._model if isinstance(P, logfft.LogFFTModel) else P
+    if not (isinstance(form, kerneldll.DllModel)
+            and isinstance(S, kerneldll.DllModel)
+            and form.dtype == S.dtype == generate.F64):
+        return P
+    try:
+        source = generate.make_product_source(model_info)
+    except ValueError:
+        # Structure factor can't be fused.
+        return P
+    try:
+        fused = kerneldll.load_product_dll(source['dll'], model_info)
+    except (RuntimeError, OSError) as exc:
+        logging.warning("using separate P and S kernels for %s: %s",
+                        model_info.id, exc)
+        return P
+    if form is not P:
+        fused = logfft.LogFFTModel(P.info, fused)
+    return fused
 
 def precompile_dlls(path, dtype="double"):
     # type: (str, str) -> List[str]
@@ -377,18 +426,23 @@ def precompile_dlls(path, dtype="double"):
     return compiled_dlls
 
 def parse_dtype(model_info, dtype=None, platform=None):
-    # type: (ModelInfo, str, str) -> Tuple[np.dtype, bool, str]
+    # type: (ModelInfo, str, str) -> Tuple[np.dtype, bool, bool, str]
     """
-    Interpret dtype string, returning np.dtype, fast flag and platform.
+    Interpret dtype string, returning np.dtype, fast flag, mixed flag and
+    platform.
 
     Possible types include 'half', 'single', 'double' and 'quad'.  If the
     type is 'fast', then this is equivalent to dtype 'single' but using
     fast native functions rather than those with the precision level
-    guaranteed by the OpenCL standard.  'default' will choose the appropriate
-    default for the model and platform.
+    guaranteed by the OpenCL standard.  If the type is 'mixed', then it is
+    single precision but with the dispersity and orientation sums accumulated
+    in double precision (see :func:`.generate.convert_type`).  'default' will
+    choose the appropriate default for the model and platform.
 
     Platform preference can be specfied ("ocl", "cuda", "dll"), with the
-    default being OpenCL or CUDA if available, otherwise DLL.  If the dtype
+    default being OpenCL or CUDA if available, otherwise DLL.  Platform
+    "numba" only applies to python models, so it is treated as the default
+    for C models.  If the dtype
     name ends with '!' then platform is forced to be DLL rather than GPU.
     The default platform is set by the environment variable SAS_OPENCL,
     SAS_OPENCL=driver:device for OpenCL, SAS_OPENCL=cuda:device for CUDA
@@ -402,7 +456,7 @@ def parse_dtype(model_info, dtype=None, platform=None):
     """
     # Assign default platform, overriding ocl with dll if OpenCL is unavailable
     # If opencl=False OpenCL is switched off
-    if platform is None:
+    if platform is None or platform == "numba":
         platform = "ocl"
 
     # Check if type indicates dll regardless of which platform is given
@@ -421,9 +475,10 @@ def parse_dtype(model_info, dtype=None, platform=None):
             from . import kernelcuda
             platform = "cuda" if kernelcuda.use_cuda() else "dll"
 
-    # Convert special type names "half", "fast", and "quad"
+    # Convert special type names "half", "fast", "mixed" and "quad"
     fast = (dtype == "fast")
-    if fast:
+    mixed = (dtype == "mixed")
+    if fast or mixed:
         dtype = "single"
     elif dtype == "quad":
         dtype = "longdouble"
@@ -447,12 +502,14 @@ def parse_dtype(model_info, dtype=None, platform=None):
         env = kernelcuda.environment()
     else:
         env = None
-    if env is not None and not env.has_type(numpy_dtype):
+    # Mixed precision also needs double precision for the accumulators.
+    if env is not None and (not env.has_type(numpy_dtype)
+                            or (mixed and not env.has_type(generate.F64))):
         platform = "dll"
         if dtype is None:
             numpy_dtype = generate.F64
 
-    return numpy_dtype, fast, platform
+    return numpy_dtype, fast, mixed, platform
 
 def test_composite_order():
     """
@@ -508,6 +565,33 @@ def test_composite_order():
         "barbell+cylinder@hardsphere*sphere",
         "sphere*cylinder@hardsphere+barbell")
 
+def test_fused_product():
+    # type: () -> None
+    """Check the fused P@S dll against separate P and S kernels"""
+    from .data import empty_data1D
+    from .direct_model import DirectModel
+    data = empty_data1D(np.logspace(-3, -0.5, 50))
+    for name, pars in (
+            ("sphere@hayter_msa", dict(radius=20, radius_pd=0.1)),
+            ("vesicle@squarewell", dict(radius=40, radius_pd=0.1)),
+            ("ellipsoid@stickyhardsphere", dict(radius_polar=20))):
+        info = load_model_info(name)
+        fused = build_model(info, dtype="double", platform="dll")
+        kernel = fused.make_kernel([data.x])
+        assert kernel._fused is not None, name
+        kernel.release()
+        parts = [build_model(p, dtype="double", platform="dll")
+                 for p in info.composition[1]]
+        separate = product.ProductModel(info, *parts)
+        for beta, er_mode in ((0, 0), (1, 1)):
+            args = dict(pars, structure_factor_mode=beta,
+                        radius_effective_mode=er_mode)
+            calculator = DirectModel(data, fused)
+            actual = calculator(**args)
+            assert calculator._kernel._fused.product_result is not None
+            target = DirectModel(data, separate)(**args)
+            assert np.allclose(actual, target, rtol=1e-12, atol=0), name
+
 def test_composite():
     # type: () -> None
     """Check that model load works"""
@@ -521,6 +605,22 @@ def test_composite():
     target = [*(f"A_{p}" for p in a_parts), *(f"B_{p}" for p in b_parts)]
     assert target == actual, "%s != %s"%(target, actual)
 
+def test_mixed_precision():
+    # type: () -> None
+    """Check that mixed precision dlls accumulate in double"""
+    from .data import empty_data1D
+    from .direct_model import DirectModel
+    data = empty_data1D(np.logspace(-3, -1, 50))
+    pars = dict(radius=50, length=2000, radius_pd=0.1, radius_pd_n=35)
+    target = DirectModel(data, load_model("cylinder", dtype="double!"))(**pars)
+    model = load_model("cylinder", dtype="mixed!")
+    assert model.dtype == generate.F32 and model.mixed
+    kernel = model.make_kernel([data.x])
+    assert kernel.result.dtype == generate.F64
+    kernel.release()
+    actual = DirectModel(data, model)(**pars)
+    assert np.all(abs(actual - target) < 5e-5*abs(target))
+
 
 def list_models_main():
     # type: () -> int
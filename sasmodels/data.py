@@ -9,7 +9,8 @@ Plotting functions for data sets:
 
 Wrappers for the sasview data loader and data manipulations:
 
-    :func:`load_data` loads a sasview data file.
+    :func:`load_data` loads a sasview data file, optionally through a cache
+    of the loaded arrays.
 
     :func:`set_beam_stop` masks the beam stop from the data.
 
@@ -32,7 +33,12 @@ objects so that models can be run without SasView on the path.  You could
 also use these for your own data loader.
 
 """
+import os
+import json
+import shutil
+import tempfile
 import traceback
+from hashlib import sha1
 from functools import wraps
 
 import numpy as np  # type: ignore
@@ -49,20 +55,45 @@ except ImportError:
     pass
 # pylint: enable=unused-import
 
-def load_data(filename, index=0):
-    # type: (str, int) -> Data
+#: Directory for the cache of loaded data files, or None for no cache.  Set
+#: from the environment variable SAS_DATA_CACHE.
+DATA_CACHE_PATH = os.environ.get("SAS_DATA_CACHE", None) or None
+
+def load_data(filename, index=0, cache=None):
+    # type: (str, int, Union[None, bool, str]) -> Data
     """
     Load data using a sasview loader.
+
+    If *cache* is a directory, or if *cache* is None and *DATA_CACHE_PATH*
+    is set, the loaded 1D and 2D arrays are saved there as .npy files keyed
+    by the file path, size and modification time.  Later loads of the same
+    file are memory mapped from the cache without calling the loader,
+    returning :class:`Data1D` and :class:`Data2D` objects rather than the
+    sasview classes.  The arrays are copy on write, so masks can still be
+    updated in place.  Files containing SESANS data are not cached.  Use
+    *cache=False* to bypass the cache.
     """
+    # Allow for one part in multipart file
+    if '[' in filename:
+        filename, indexstr = filename[:-1].split('[')
+        index = int(indexstr)
+    if cache is None:
+        cache = DATA_CACHE_PATH
+    cache_dir = _cache_dir(cache, filename) if cache else None
+    datasets = _load_cache(cache_dir) if cache_dir else None
+    if datasets is None:
+        datasets = _load_sasdata(filename)
+        if cache_dir:
+            _save_cache(cache_dir, datasets)
+    return datasets[index] if index != 'all' else datasets
+
+def _load_sasdata(filename):
+    # type: (str) -> List[Data]
     try:
         from sasdata.dataloader.loader import Loader  # type: ignore
     except ImportError as ie:
         raise ImportError(f"{ie.name} is not available. Add sasdata to the python path.")
     loader = Loader()
-    # Allow for one part in multipart file
-    if '[' in filename:
-        filename, indexstr = filename[:-1].split('[')
-        index = int(indexstr)
     datasets = loader.load(filename)
     if not datasets:  # None or []
         raise IOError("Data %r could not be loaded" % filename)
@@ -77,8 +108,105 @@ def load_data(filename, index=0):
                          else np.zeros_like(data.x, dtype='bool'))
         elif hasattr(data, 'qx_data'):
             data.mask = ~data.mask
-    return datasets[index] if index != 'all' else datasets
+    return datasets
+
+# Version of the cache layout, part of the cache key.
+_CACHE_VERSION = 1
+# Fields saved in the data cache.
+_CACHE_ARRAYS = {
+    '1d': ('x', 'y', 'dx', 'dy', 'dxl', 'dxw', 'mask'),
+    '2d': ('qx_data', 'qy_data', 'dqx_data', 'dqy_data', 'data', 'err_data',
+           'q_data', 'mask', 'x_bins', 'y_bins'),
+}
+_CACHE_ATTRS = (
+    'qmin', 'qmax', 'filename', 'title', 'oriented', 'accuracy', 'Q_unit',
+    'I_unit', '_xaxis', '_xunit', '_yaxis', '_yunit', '_zaxis', '_zunit',
+)
+
+def _cache_dir(cache, filename):
+    # type: (str, str) -> Optional[str]
+    """
+    Return the cache directory for *filename*, or None if it doesn't exist.
+    """
+    path = os.path.abspath(filename)
+    try:
+        stat = os.stat(path)
+    except OSError:
+        return None
+    key = "%d %s %d %d" % (_CACHE_VERSION, path, stat.st_size, stat.st_mtime_ns)
+    name = os.path.basename(path) + "_" + sha1(key.encode('utf8')).hexdigest()
+    return os.path.join(cache, name)
+
+def _save_cache(cache_dir, datasets):
+    # type: (str, List[Data]) -> None
+    """
+    Save the arrays and attributes of *datasets* into *cache_dir*.
+
+    The cache is written to a temporary directory and renamed into place so
+    that concurrent fits never see a partial entry.  Failures are ignored.
+    """
+    entries = []
+    for data in datasets:
+        if getattr(data, 'isSesans', False):
+            return
+        kind = '2d' if hasattr(data, 'qx_data') else '1d'
+        arrays = {name: np.asarray(getattr(data, name))
+                  for name in _CACHE_ARRAYS[kind]
+                  if getattr(data, name, None) is not None}
+        if any(value.dtype.hasobject for value in arrays.values()):
+            return
+        attrs = {}
+        for name in _CACHE_ATTRS:
+            value = getattr(data, name, None)
+            if isinstance(value, (np.generic,)):
+                value = value.item()
+            if isinstance(value, (bool, int, float, str)):
+                attrs[name] = value
+        entries.append((kind, arrays, attrs))
+    try:
+        parent = os.path.dirname(cache_dir)
+        os.makedirs(parent, exist_ok=True)
+        tmp = tempfile.mkdtemp(dir=parent, prefix=".tmp_")
+        meta = []
+        for k, (kind, arrays, attrs) in enumerate(entries):
+            for name, value in arrays.items():
+                np.save(os.path.join(tmp, "%d_%s.npy" % (k, name)), value)
+            meta.append({'kind': kind, 'arrays': sorted(arrays), 'attrs': attrs})
+        with open(os.path.join(tmp, "meta.json"), "w") as fid:
+            json.dump(meta, fid)
+        try:
+            os.rename(tmp, cache_dir)
+        except OSError:  # Another process saved it first.
+            shutil.rmtree(tmp, ignore_errors=True)
+    except (OSError, ValueError):
+        pass
 
+def _load_cache(cache_dir):
+    # type: (str) -> Optional[List[Data]]
+    """
+    Load the datasets saved in *cache_dir*, or None if there are none.
+    """
+    try:
+        with open(os.path.join(cache_dir, "meta.json")) as fid:
+            meta = json.load(fid)
+        datasets = []
+        for k, entry in enumerate(meta):
+            arrays = {}
+            for name in entry['arrays']:
+                path = os.path.join(cache_dir, "%d_%s.npy" % (k, name))
+                arrays[name] = np.load(path, mmap_mode='c')
+            if entry['kind'] == '2d':
+                data = Data2D(x=arrays['qx_data'], y=arrays['qy_data'])
+            else:
+                data = Data1D(x=arrays['x'])
+            for name, value in arrays.items():
+                setattr(data, name, value)
+            for name, value in entry['attrs'].items():
+                setattr(data, name, value)
+            datasets.append(data)
+    except (OSError, ValueError, KeyError):
+        return None
+    return datasets
 
 def set_beam_stop(data, radius, outer=None):
     # type: (Data, float, Optional[float]) -> None
@@ -781,49 +909,60 @@ def _build_matrix(self, plottable):
             or self.qx_data.ndim != 1 or self.qy_data.ndim != 1):
         return self.x_bins, self.y_bins, plottable
 
-    # maximum # of loops to fillup_pixels
-    # otherwise, loop could never stop depending on data
-    max_loop = 1
-    # get the x and y_bin arrays.
-    x_bins, y_bins = _get_bins(self)
-    # set zero to None
-
     #Note: Can not use scipy.interpolate.Rbf:
     # 'cause too many data points (>10000)<=JHC.
-    # 1d array to use for weighting the data point averaging
-    #when they fall into a same bin.
-    weights_data = np.ones([self.data.size])
-    # get histogram of ones w/len(data); this will provide
-    #the weights of data on each bins
-    weights, _, _ = np.histogram2d(
-        x=self.qy_data, y=self.qx_data, bins=[y_bins, x_bins],
-        weights=weights_data)
-    # get histogram of data, all points into a bin in a way of summing
-    image, _, _ = np.histogram2d(
-        x=self.qy_data, y=self.qx_data, bins=[y_bins, x_bins],
-        weights=plottable)
-    # Now, normalize the image by weights only for weights>1:
-    # If weight == 1, there is only one data point in the bin so
-    # that no normalization is required.
+    x_bins, y_bins, index, weights = _get_bin_map(self)
+    # Sum the data points into their bins, then average the bins with more
+    # than one point.  This is the same as np.histogram2d with the bins as
+    # edges, but reuses the bin index of each point.
+    image = np.bincount(index, weights=np.asarray(plottable).ravel(),
+                        minlength=weights.size).reshape(weights.shape)
     image[weights > 1] = image[weights > 1] / weights[weights > 1]
     # Set image bins w/o a data point (weight==0) as None (was set to zero
-    # by histogram2d.)
+    # by the sum.)
     image[weights == 0] = None
 
-    # Fill empty bins with 8 nearest neighbors only when at least
-    #one None point exists
-    loop = 0
-
-    # do while loop until all vacant bins are filled up up
-    #to loop = max_loop
-    while (weights == 0).any():
-        if loop >= max_loop:  # this protects never-ending loop
-            break
+    # Fill empty bins with 8 nearest neighbors, once, when at least
+    # one empty bin exists.
+    if (weights == 0).any():
         image = _fillup_pixels(image=image, weights=weights)
-        loop += 1
 
     return x_bins, y_bins, image
 
+def _get_bin_map(self):
+    """
+    Return *(x_bins, y_bins, index, weights)* for binning the data onto the
+    image grid, where *index* is the flat image index for each data point
+    and *weights* is the number of points in each image pixel.
+
+    The map is cached on the data, and is rebuilt if *qx_data* or *qy_data*
+    is replaced by a new array.  Changing the values in place will not be
+    noticed.
+    """
+    cache = getattr(self, '_bin_map', None)
+    if (cache is not None and cache[0] is self.qx_data
+            and cache[1] is self.qy_data):
+        return cache[2:]
+    x_bins, y_bins = _get_bins(self)
+    # Bins are treated as edges, with the last edge included in the last
+    # bin, as in np.histogram2d.
+    columns = _bin_index(x_bins, self.qx_data)
+    rows = _bin_index(y_bins, self.qy_data)
+    shape = (len(y_bins) - 1, len(x_bins) - 1)
+    index = np.ravel_multi_index((rows, columns), shape)
+    weights = np.bincount(index, minlength=shape[0]*shape[1])
+    weights = weights.reshape(shape).astype('d')
+    self._bin_map = (self.qx_data, self.qy_data, x_bins, y_bins, index, weights)
+    return x_bins, y_bins, index, weights
+
+def _bin_index(edges, values):
+    """
+    Return the bin for each value given the bin *edges*.
+    """
+    index = np.searchsorted(edges, values, side='right') - 1
+    index[values == edges[-1]] -= 1
+    return index
+
 def _get_bins(self):
     """
     get bins
@@ -864,6 +1003,9 @@ def _get_bins(self):
 
     return x_bins, y_bins
 
+# Neighbours used to fill empty pixels.
+_FILL_KERNEL = np.array([[1., 1., 1.], [1., 0., 1.], [1., 1., 1.]])
+
 def _fillup_pixels(image=None, weights=None):
     """
     Fill z values of the empty cells of 2d image matrix
@@ -872,64 +1014,112 @@ def _fillup_pixels(image=None, weights=None):
     :param image: (2d matrix with some zi = None)
 
     :return: image (2d array )
-
-    :TODO: Find better way to do for-loop below
     """
+    from scipy.ndimage import convolve
+
     # No image matrix given
     if (image is None or np.ndim(image) != 2
             or np.isfinite(image).all()
             or weights is None):
         return image
-    # Get bin size in y and x directions
-    len_x, len_y = image.shape[1], image.shape[0]
-    temp_image = np.zeros([len_y, len_x])
-    weit = np.zeros([len_y, len_x])
-    # do for-loop for all pixels
-    for n_y in range(len_y):
-        for n_x in range(len_x):
-            # find only null pixels
-            if weights[n_y][n_x] > 0 or np.isfinite(image[n_y][n_x]):
-                continue
-            # find 4 nearest neighbors
-            # check where or not it is at the corner
-            if n_y != 0 and np.isfinite(image[n_y - 1][n_x]):
-                temp_image[n_y][n_x] += image[n_y - 1][n_x]
-                weit[n_y][n_x] += 1
-            if n_x != 0 and np.isfinite(image[n_y][n_x - 1]):
-                temp_image[n_y][n_x] += image[n_y][n_x - 1]
-                weit[n_y][n_x] += 1
-            if n_y != len_y - 1 and np.isfinite(image[n_y + 1][n_x]):
-                temp_image[n_y][n_x] += image[n_y + 1][n_x]
-                weit[n_y][n_x] += 1
-            if n_x != len_x - 1 and np.isfinite(image[n_y][n_x + 1]):
-                temp_image[n_y][n_x] += image[n_y][n_x + 1]
-                weit[n_y][n_x] += 1
-            # go 4 next nearest neighbors when no non-zero
-            # neighbor exists
-            if (n_y != 0 and n_x != 0
-                    and np.isfinite(image[n_y - 1][n_x - 1])):
-                temp_image[n_y][n_x] += image[n_y - 1][n_x - 1]
-                weit[n_y][n_x] += 1
-            if (n_y != len_y - 1 and n_x != 0
-                    and np.isfinite(image[n_y + 1][n_x - 1])):
-                temp_image[n_y][n_x] += image[n_y + 1][n_x - 1]
-                weit[n_y][n_x] += 1
-            if (n_y != len_y and n_x != len_x - 1
-                    and np.isfinite(image[n_y - 1][n_x + 1])):
-                temp_image[n_y][n_x] += image[n_y - 1][n_x + 1]
-                weit[n_y][n_x] += 1
-            if (n_y != len_y - 1 and n_x != len_x - 1
-                    and np.isfinite(image[n_y + 1][n_x + 1])):
-                temp_image[n_y][n_x] += image[n_y + 1][n_x + 1]
-                weit[n_y][n_x] += 1
-
-    # get it normalized
-    ind = (weit > 0)
-    image[ind] = temp_image[ind] / weit[ind]
+    # Sum and count the finite values among the 8 neighbors of each pixel,
+    # with the pixels beyond the edge of the image treated as missing.
+    finite = np.isfinite(image)
+    total = convolve(np.where(finite, image, 0.), _FILL_KERNEL,
+                     mode='constant', cval=0.)
+    count = convolve(finite.astype('d'), _FILL_KERNEL,
+                     mode='constant', cval=0.)
+
+    # fill only the null pixels with at least one neighbor
+    ind = (weights == 0) & ~finite & (count > 0)
+    image[ind] = total[ind] / count[ind]
 
     return image
 
 
+def test_build_matrix():
+    # type: () -> None
+    """
+    Check the image binning against np.histogram2d and the hole filling.
+    """
+    qx, qy = np.meshgrid(np.linspace(-0.1, 0.1, 20), np.linspace(-0.1, 0.1, 20))
+    data = Data2D(x=qx.flatten(), y=qy.flatten(), z=np.hypot(qx, qy).flatten())
+    # Knock out a pixel, and jitter the rest so bins get 0, 1 or 2 points.
+    keep = np.arange(data.data.size) != 5*20 + 5
+    for name in ('qx_data', 'qy_data', 'data'):
+        setattr(data, name, getattr(data, name)[keep])
+    data.qx_data = data.qx_data + 0.003*np.sin(7*data.qy_data/0.01)
+    x_bins, y_bins, image = _build_matrix(data, data.data)
+
+    count, _, _ = np.histogram2d(data.qy_data, data.qx_data, bins=[y_bins, x_bins])
+    total, _, _ = np.histogram2d(data.qy_data, data.qx_data, bins=[y_bins, x_bins],
+                                 weights=data.data)
+    filled = count > 0
+    assert (~filled).any()
+    assert np.allclose(image[filled], total[filled]/count[filled])
+    for i, j in zip(*np.nonzero(~filled)):
+        block = total[max(i-1, 0):i+2, max(j-1, 0):j+2]
+        norm = count[max(i-1, 0):i+2, max(j-1, 0):j+2]
+        good = norm > 0
+        assert np.isclose(image[i, j], np.mean(block[good]/norm[good]))
+
+    # The bin map is reused for the same q arrays.
+    cache = data._bin_map
+    _build_matrix(data, 2*data.data)
+    assert data._bin_map is cache
+    data.qy_data = data.qy_data.copy()
+    _build_matrix(data, data.data)
+    assert data._bin_map is not cache
+
+
+def test_data_cache():
+    # type: () -> None
+    """
+    Check that load_data reuses the cached arrays until the file changes.
+    """
+    global _load_sasdata
+    q = np.logspace(-3, -1, 20)
+    data1d = empty_data1D(q, resolution=0.05)
+    data1d.y, data1d.dy = q**-2, 0.1*q**-2
+    data1d.filename = "sample.dat"
+    data2d = empty_data2D(np.linspace(-0.1, 0.1, 6), resolution=0.05)
+    data2d.data = data2d.q_data**-2
+    calls = []
+    def loader(filename):
+        calls.append(filename)
+        return [data1d, data2d]
+    original = _load_sasdata
+    root = tempfile.mkdtemp()
+    try:
+        _load_sasdata = loader
+        filename = os.path.join(root, "sample.dat")
+        with open(filename, "w") as fid:
+            fid.write("x")
+        cache = os.path.join(root, "cache")
+        load_data(filename, cache=cache)
+        first, second = load_data(filename, index='all', cache=cache)
+        assert len(calls) == 1
+        assert isinstance(first, Data1D) and isinstance(second, Data2D)
+        assert first.filename == "sample.dat" and first.qmax == data1d.qmax
+        for name in ('x', 'dx', 'y', 'dy', 'mask'):
+            assert (getattr(first, name) == getattr(data1d, name)).all(), name
+        for name in ('qx_data', 'dqy_data', 'data', 'mask', 'x_bins'):
+            assert (getattr(second, name) == getattr(data2d, name)).all(), name
+        # Masks can be modified without changing the cache.
+        first.mask |= True
+        assert not load_data(filename, cache=cache).mask.any()
+        # A modified file is loaded again.
+        with open(filename, "w") as fid:
+            fid.write("xy")
+        load_data(filename, cache=cache)
+        assert len(calls) == 2
+        load_data(filename, cache=False)
+        assert len(calls) == 3
+    finally:
+        _load_sasdata = original
+        shutil.rmtree(root, ignore_errors=True)
+
+
 def demo():
     # type: () -> None
     """
@@ -32,7 +32,7 @@ except Exception:
 
 # pylint: disable=unused-import
 try:
-    from typing import List, Tuple, Sequence
+    from typing import Dict, List, Optional, Tuple, Sequence
     from .modelinfo import ModelInfo, ParameterTable
     from .kernel import Kernel
 except ImportError:
@@ -65,6 +65,9 @@ class CallDetails(object):
     if the latitude is not a polydisperse parameter.
     """
     parts = None  # type: List["CallDetails"]
+    #: Declared *(type, width)* of the distribution for each polydisperse
+    #: parameter, or None if unknown; see :func:`make_kernel_args`.
+    dispersion = None  # type: Optional[Dict[str, Tuple[str, float]]]
     def __init__(self, model_info):
         # type: (ModelInfo) -> None
         parameters = model_info.parameters
@@ -222,8 +225,8 @@ def make_details(model_info, length, offset, num_weights):
 
 
 ZEROS = tuple([0.]*31)
-def make_kernel_args(kernel, mesh):
-    # type: (Kernel, Tuple[List[np.ndarray], List[np.ndarray]]) -> Tuple[CallDetails, np.ndarray, bool]
+def make_kernel_args(kernel, mesh, dispersion=None):
+    # type: (Kernel, Tuple[List[np.ndarray], List[np.ndarray]], Optional[Dict[str, Tuple[str, float]]]) -> Tuple[CallDetails, np.ndarray, bool]
     """
     Converts (value, dispersity, weight) for each parameter into kernel pars.
 
@@ -231,6 +234,11 @@ def make_kernel_args(kernel, mesh):
     containing the different values, and the magnetic flag indicating whether
     any magnetic magnitudes are non-zero. Magnetic vectors (M0, phi, theta) are
     converted to rectangular coordinates (mx, my, mz).
+
+    *dispersion* is the declared *(type, width)* of the distribution for
+    each polydisperse parameter, as returned by
+    :func:`.direct_model.get_dispersion`.  It is stored in the call details
+    so that the kernel can use closed form averages; see :mod:`.analytic`.
     """
     npars = kernel.info.parameters.npars
     nvalues = kernel.info.parameters.nvalues
@@ -243,6 +251,7 @@ def make_kernel_args(kernel, mesh):
     length = np.array([len(w) for w in weight])
     offset = np.cumsum(np.hstack((0, length)))
     call_details = make_details(kernel.info, length, offset[:-1], offset[-1])
+    call_details.dispersion = dispersion
     # Pad value array to a 32 value boundary
     data_len = nvalues + 2*sum(len(v) for v in dispersity)
     extra = (32 - data_len%32)%32
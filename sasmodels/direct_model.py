@@ -31,15 +31,18 @@ from . import sesans  # type: ignore
 from . import weights
 from . import resolution
 from . import resolution2d
+from . import trace
 from .details import make_kernel_args, dispersion_mesh
 from .product import RADIUS_MODE_ID
 
 # pylint: disable=unused-import
-from typing import Optional, Dict, Tuple, List, Callable
+from typing import Optional, Dict, Tuple, List, Callable, Any, Iterator
 from collections import OrderedDict
 from .data import Data
+from .details import CallDetails
 from .kernel import Kernel, KernelModel
 from .modelinfo import Parameter, ParameterSet, ModelInfo
+from .resolution import Resolution
 # pylint: enable=unused-import
 
 def call_kernel(calculator, pars, cutoff=0., mono=False):
@@ -56,9 +59,11 @@ def call_kernel(calculator, pars, cutoff=0., mono=False):
 
     *mono* is True if polydispersity should be set to none on all parameters.
     """
-    mesh = get_mesh(calculator.info, pars, dim=calculator.dim, mono=mono)
-    #print("in call_kernel: pars:", list(zip(*mesh))[0])
-    call_details, values, is_magnetic = make_kernel_args(calculator, mesh)
+    with trace.span("mesh", calculator.info.id):
+        mesh = get_mesh(calculator.info, pars, dim=calculator.dim, mono=mono)
+        #print("in call_kernel: pars:", list(zip(*mesh))[0])
+        call_details, values, is_magnetic = make_kernel_args(
+            calculator, mesh, get_dispersion(calculator.info, pars))
     #print("in call_kernel: values:", values)
     return calculator(call_details, values, cutoff, is_magnetic)
 
@@ -74,9 +79,11 @@ def call_Fq(calculator, pars, cutoff=0., mono=False):
     model.
     """
     R_eff_type = int(pars.pop(RADIUS_MODE_ID, 1.0))
-    mesh = get_mesh(calculator.info, pars, dim=calculator.dim, mono=mono)
-    #print("in call_Fq: pars", list(zip(*mesh))[0])
-    call_details, values, is_magnetic = make_kernel_args(calculator, mesh)
+    with trace.span("mesh", calculator.info.id):
+        mesh = get_mesh(calculator.info, pars, dim=calculator.dim, mono=mono)
+        #print("in call_Fq: pars", list(zip(*mesh))[0])
+        call_details, values, is_magnetic = make_kernel_args(
+            calculator, mesh, get_dispersion(calculator.info, pars))
     #print("in call_Fq: values:", values)
     return calculator.Fq(call_details, values, cutoff, is_magnetic, R_eff_type)
 
@@ -128,6 +135,17 @@ def get_mesh(model_info, values, dim='1d', mono=False):
     return mesh
 
 
+def get_dispersion(model_info, pars):
+    # type: (ModelInfo, ParameterSet) -> Dict[str, Tuple[str, float]]
+    """
+    Return the declared *(type, width)* of the distribution for each
+    polydisperse parameter in the parameter set.
+    """
+    return {p.name: (pars.get(p.name+'_pd_type', 'gaussian'),
+                     float(pars.get(p.name+'_pd', 0.0)))
+            for p in model_info.parameters.call_parameters if p.polydisperse}
+
+
 def _pop_par_weights(parameter, values, active=True):
     # type: (Parameter, Dict[str, float], bool) -> Tuple[float, np.ndarray, np.ndarray]
     """
@@ -158,6 +176,84 @@ def _pop_par_weights(parameter, values, active=True):
     return value, pd[0], pd[1]
 
 
+class DispersityConvergence(object):
+    """
+    Choose the number of dispersity points for each polydisperse parameter.
+
+    Starting from *start* points, the number of points for one parameter at
+    a time is increased from $n$ to $2n-1$, which keeps the existing points
+    for the evenly spaced distributions, until $I(q)$ changes by less than
+    *tolerance* relative to $|I(q)|$ at every $q$, or *max_npts* is
+    reached.  The converged counts are kept in *npts* for the following
+    calls, and chosen again from *start* after every *recheck* calls so
+    they can follow the distribution widths during a fit.
+
+    Use the instance in place of :func:`call_kernel` to evaluate the model,
+    or call :meth:`select` to get the parameters to use.  The *name_pd_n*
+    values in the parameter set are ignored.
+    """
+    def __init__(self, tolerance=1e-3, start=5, max_npts=257, recheck=50):
+        # type: (float, int, int, int) -> None
+        self.tolerance = tolerance
+        self.start = start
+        self.max_npts = max_npts
+        self.recheck = recheck
+        #: Converged number of points for each parameter
+        self.npts = {}  # type: Dict[str, int]
+        self._calls = 0
+
+    def __call__(self, calculator, pars, cutoff=0.):
+        # type: (Kernel, ParameterSet, float) -> np.ndarray
+        return call_kernel(calculator, self.select(calculator, pars, cutoff),
+                           cutoff=cutoff)
+
+    def select(self, calculator, pars, cutoff=0.):
+        # type: (Kernel, ParameterSet, float) -> ParameterSet
+        """
+        Return a copy of *pars* with *name_pd_n* set for each polydisperse
+        parameter, checking for convergence if the parameter is new or it
+        is time to recheck.
+        """
+        partable = calculator.info.parameters
+        active_set = partable.pd_1d if calculator.dim == '1d' else partable.pd_2d
+        active = [p.name for p in partable.call_parameters
+                  if p.polydisperse and p.name in active_set
+                  and pars.get(p.name+'_pd', 0.) != 0.]
+        recheck = self.recheck > 0 and self._calls % self.recheck == 0
+        self._calls += 1
+        if recheck:
+            self.npts.clear()
+        pars = pars.copy()
+        for name in active:
+            pars[name+'_pd_n'] = self.npts.get(name, self.start)
+        pending = [name for name in active if name not in self.npts]
+        if not pending:
+            return pars
+
+        with trace.span("pd_converge", calculator.info.id):
+            current = call_kernel(calculator, pars, cutoff=cutoff)
+            for name in pending:
+                npts = pars[name+'_pd_n']
+                while 2*npts - 1 <= self.max_npts:
+                    trial = pars.copy()
+                    trial[name+'_pd_n'] = 2*npts - 1
+                    Iq = call_kernel(calculator, trial, cutoff=cutoff)
+                    if _relative_change(current, Iq) < self.tolerance:
+                        break
+                    pars, current, npts = trial, Iq, 2*npts - 1
+                self.npts[name] = npts
+        return pars
+
+def _relative_change(old, new):
+    # type: (np.ndarray, np.ndarray) -> float
+    """Largest change in *new* relative to *old* over nonzero points."""
+    scale = abs(new)
+    nonzero = scale > 0
+    if not nonzero.any():
+        return 0. if (old == new).all() else np.inf
+    return np.max(abs(new - old)[nonzero]/scale[nonzero])
+
+
 def _make_sesans_transform(data):
     # Pre-compute the Hankel matrix (H)
     SElength, SEunits = data.x, data._xunit
@@ -179,6 +275,94 @@ def _make_sesans_transform(data):
     return hankel
 
 
+class Progressive2D(object):
+    r"""
+    Coarse to fine evaluation of a 2D pattern for interactive previews.
+
+    *qx*, *qy* are the detector pixels to return, in any order, which must
+    lie on a rectilinear grid, possibly with pixels missing from the beam
+    stop or the mask.  For each stride in *strides* greater than one, the
+    model is evaluated on every stride-th row and column of the grid, with
+    the last row and column always included, and bilinearly interpolated to
+    the pixels.  Interpolation is on $\log I$ when the coarse values are
+    all positive.  The strides which do not reduce the grid are dropped, as
+    are all of them if the pixels are not on a grid.
+
+    *levels* is the list of *(stride, qx, qy)* at which to evaluate the
+    model, coarsest first.  Use :meth:`interpolate` to expand the result
+    from level *k* to the pixels.
+    """
+    def __init__(self, qx, qy, strides=(4, 2, 1)):
+        # type: (np.ndarray, np.ndarray, Tuple[int, ...]) -> None
+        qx, qy = np.asarray(qx).ravel(), np.asarray(qy).ravel()
+        xs, ys = np.unique(qx), np.unique(qy)
+        self.levels = []  # type: List[Tuple[int, np.ndarray, np.ndarray]]
+        self._weights = []  # type: List[Tuple[np.ndarray, ...]]
+        if len(xs)*len(ys) > 4*len(qx):
+            return
+        for stride in sorted(set(strides), reverse=True):
+            cols, rows = _coarse_nodes(xs, stride), _coarse_nodes(ys, stride)
+            if stride <= 1 or len(cols)*len(rows) >= len(qx):
+                continue
+            grid_x, grid_y = np.meshgrid(cols, rows)
+            self.levels.append((stride, grid_x.ravel(), grid_y.ravel()))
+            self._weights.append(_interp_weights(cols, qx)
+                                 + _interp_weights(rows, qy)
+                                 + ((len(rows), len(cols)),))
+
+    def interpolate(self, level, Iq):
+        # type: (int, np.ndarray) -> np.ndarray
+        """
+        Return *Iq* from the points of *levels[level]* interpolated to the
+        pixels.
+        """
+        x0, x1, tx, y0, y1, ty, shape = self._weights[level]
+        Z = np.reshape(Iq, shape)
+        log = (Z > 0).all()
+        if log:
+            Z = np.log(Z)
+        result = ((Z[y0, x0]*(1-tx) + Z[y0, x1]*tx)*(1-ty)
+                  + (Z[y1, x0]*(1-tx) + Z[y1, x1]*tx)*ty)
+        return np.exp(result) if log else result
+
+    def passes(self, calculate, full):
+        # type: (Callable[[int, np.ndarray, np.ndarray], np.ndarray], Callable[[], np.ndarray]) -> Iterator[Tuple[int, np.ndarray]]
+        """
+        Yield *(stride, Iq)* for each level, calling *calculate(level, qx, qy)*
+        for the coarse levels and *full()* for the final pass with stride 1.
+
+        The evaluation for each pass is only done when the next value is
+        requested, so stop iterating to cancel the remaining passes, for
+        example when the parameters change.
+        """
+        for level, (stride, qx, qy) in enumerate(self.levels):
+            yield stride, self.interpolate(level, calculate(level, qx, qy))
+        yield 1, full()
+
+
+def _coarse_nodes(values, stride):
+    # type: (np.ndarray, int) -> np.ndarray
+    index = np.arange(0, len(values), max(stride, 1))
+    if index[-1] != len(values) - 1:
+        index = np.hstack((index, len(values) - 1))
+    return values[index]
+
+
+def _interp_weights(nodes, points):
+    # type: (np.ndarray, np.ndarray) -> Tuple[np.ndarray, np.ndarray, np.ndarray]
+    """
+    Return the indices of the nodes on either side of each point and the
+    fractional distance from the lower node.
+    """
+    if len(nodes) == 1:
+        zero = np.zeros(len(points), 'i')
+        return zero, zero, np.zeros(len(points))
+    lower = np.clip(np.searchsorted(nodes, points, 'right') - 1,
+                    0, len(nodes) - 2)
+    t = (points - nodes[lower])/(nodes[lower+1] - nodes[lower])
+    return lower, lower + 1, t
+
+
 class DataMixin(object):
     """
     DataMixin captures the common aspects of evaluating a SAS model for a
@@ -199,10 +383,20 @@ class DataMixin(object):
     *_set_data* sets the intensity data in the data object,
     possibly with random noise added.  This is useful for simulating a
     dataset with the results from *_calc_theory*.
+
+    *dispersity* is a :class:`DispersityConvergence` object used to choose
+    the number of dispersity points, or None to use the *name_pd_n* values.
     """
-    def _interpret_data(self, data: Data, model: KernelModel) -> None:
-        # not type: (Data, KernelModel) -> None
+    dispersity = None  # type: Optional[DispersityConvergence]
+
+    def _interpret_data(self, data: Data, model: KernelModel,
+                        shared_resolution: Optional[Resolution]=None) -> None:
+        # not type: (Data, KernelModel, Optional[Resolution]) -> None
         # pylint: disable=attribute-defined-outside-init
+        # If *shared_resolution* is given it is used instead of building a
+        # new resolution calculator for the data.  It must come from data
+        # with the same q points and index.
+        res = shared_resolution
 
         self._data = data
         self._model = model
@@ -218,7 +412,8 @@ class DataMixin(object):
             self.data_type = 'Iq'
 
         if self.data_type == 'sesans':
-            res = _make_sesans_transform(data)
+            if res is None:
+                res = _make_sesans_transform(data)
             index = slice(None, None)
             if data.y is not None:
                 Iq, dIq = data.y, data.dy
@@ -238,8 +433,9 @@ class DataMixin(object):
                 dIq = data.err_data[index]
             else:
                 Iq, dIq = None, None
-            res = resolution2d.Pinhole2D(data=data, index=index,
-                                         nsigma=3.0, accuracy=accuracy)
+            if res is None:
+                res = resolution2d.Pinhole2D(data=data, index=index,
+                                             nsigma=3.0, accuracy=accuracy)
         elif self.data_type == 'Iq':
             index = (data.x >= data.qmin) & (data.x <= data.qmax)
             mask = getattr(data, 'mask', None)
@@ -251,7 +447,9 @@ class DataMixin(object):
                 dIq = data.dy[index]
             else:
                 Iq, dIq = None, None
-            if getattr(data, 'dx', None) is not None:
+            if res is not None:
+                pass
+            elif getattr(data, 'dx', None) is not None:
                 q, dq = data.x[index], data.dx[index]
                 if (dq > 0).any():
                     res = resolution.Pinhole1D(q, dq)
@@ -277,10 +475,10 @@ class DataMixin(object):
                     or getattr(data, 'dxw', None) is None):
                 raise ValueError("oriented sample with 1D data needs slit resolution")
 
-            res = resolution2d.Slit2D(
-                data.x[index],
-                qx_width=data.dxw[index],
-                qy_width=data.dxl[index])
+            # Gaussian width dxw along qx and slit length dxl across qy.
+            if res is None:
+                res = resolution2d.Slit2D(
+                    data.x[index], data.dxw[index], data.dxl[index])
         else:
             raise ValueError("Unknown data type") # never gets here
 
@@ -320,16 +518,24 @@ class DataMixin(object):
         else:
             raise ValueError("Unknown model")
 
+    def _kernel_inputs(self):
+        # type: () -> Tuple[np.ndarray, ...]
+        # TODO: change interfaces so that resolution returns kernel inputs
+        # Maybe have resolution always return a tuple, or maybe have
+        # make_kernel accept either an ndarray or a pair of ndarrays.
+        if self.data_type == 'Iq-oriented':
+            # The slit integral only evaluates the full grid where needed,
+            # starting from its coarse grid.
+            return tuple(self.resolution.q_coarse)
+        kernel_inputs = self.resolution.q_calc
+        if isinstance(kernel_inputs, np.ndarray):
+            kernel_inputs = (kernel_inputs,)
+        return kernel_inputs
+
     def _calc_theory(self, pars, cutoff=0.0):
         # type: (ParameterSet, float) -> np.ndarray
         if self._kernel is None:
-            # TODO: change interfaces so that resolution returns kernel inputs
-            # Maybe have resolution always return a tuple, or maybe have
-            # make_kernel accept either an ndarray or a pair of ndarrays.
-            kernel_inputs = self.resolution.q_calc
-            if isinstance(kernel_inputs, np.ndarray):
-                kernel_inputs = (kernel_inputs,)
-            self._kernel = self._model.make_kernel(kernel_inputs)
+            self._kernel = self._model.make_kernel(self._kernel_inputs())
 
         # Need to pull background out of resolution for multiple scattering
         default_background = self._model.info.parameters.common_parameters[1].default
@@ -339,21 +545,76 @@ class DataMixin(object):
         pars = pars.copy()
         pars['background'] = 0.
 
+        if self.dispersity is not None:
+            pars = self.dispersity.select(self._kernel, pars, cutoff=cutoff)
+        if self.data_type == 'Iq-oriented':
+            # Slit integral only evaluates qy where the theory is not
+            # negligible.  The first pass is on the coarse grid in
+            # self._kernel; later passes depend on the theory, so each
+            # keeps its kernel for as long as it gets the same points.
+            # pylint: disable=attribute-defined-outside-init
+            if getattr(self, '_refine_kernels', None) is None:
+                self._refine_kernels = []
+            kernels, level = self._refine_kernels, [0]
+            def calculate(qx, qy):
+                level[0] += 1
+                if level[0] == 1:
+                    return call_kernel(self._kernel, pars, cutoff=cutoff)
+                index = level[0] - 2
+                if index == len(kernels):
+                    kernels.append((None, None, None))
+                old_qx, old_qy, kernel = kernels[index]
+                if (kernel is None or not np.array_equal(qx, old_qx)
+                        or not np.array_equal(qy, old_qy)):
+                    if kernel is not None:
+                        kernel.release()
+                    kernel = self._model.make_kernel([qx, qy])
+                    kernels[index] = (qx, qy, kernel)
+                return call_kernel(kernel, pars, cutoff=cutoff)
+            result, Iq_calc = self.resolution.integrate(calculate)
+            self.results = None
+            # Storing the calculated Iq values so that they can be plotted.
+            # TODO: extend plotting of calculate Iq to other measurement types
+            # TODO: refactor so we don't store the result in the model
+            self.Iq_calc = (
+                self.resolution.qx_calc, self.resolution.qy_calc, Iq_calc)
+            return result + background
         Iq_calc = call_kernel(self._kernel, pars, cutoff=cutoff)
         self.results = getattr(self._kernel, 'results', None)
-        # Storing the calculated Iq values so that they can be plotted.
-        # Only applies to oriented USANS data for now.
-        # TODO: extend plotting of calculate Iq to other measurement types
-        # TODO: refactor so we don't store the result in the model
         self.Iq_calc = Iq_calc
         result = self.resolution.apply(Iq_calc)
-        if hasattr(self.resolution, 'nx'):
-            self.Iq_calc = (
-                self.resolution.qx_calc, self.resolution.qy_calc,
-                np.reshape(Iq_calc, (self.resolution.ny, self.resolution.nx))
-            )
         return result + background
 
+    def _calc_progressive(self, pars, cutoff=0.0, strides=(4, 2, 1)):
+        # type: (ParameterSet, float, Tuple[int, ...]) -> Iterator[Tuple[int, np.ndarray]]
+        """
+        Yield *(stride, Iq)* from coarse to fine.  See :class:`Progressive2D`.
+
+        Only 2D data has coarse passes.  These skip the resolution and the
+        dispersity convergence, so only the final pass, with stride 1, is
+        identical to :meth:`_calc_theory`.
+        """
+        if self.data_type != 'Iqxy':
+            yield 1, self._calc_theory(pars, cutoff=cutoff)
+            return
+        # Coarse grid and kernels are kept between calls, so moving a slider
+        # only pays for the kernel evaluations.
+        # pylint: disable=attribute-defined-outside-init
+        key = tuple(strides)
+        if getattr(self, '_progressive', (None,))[0] != key:
+            data = self._data
+            grid = Progressive2D(data.qx_data[self.index],
+                                 data.qy_data[self.index], strides)
+            self._progressive = (key, grid, {})
+        _, grid, kernels = self._progressive
+        def calculate(level, qx, qy):
+            if level not in kernels:
+                kernels[level] = self._model.make_kernel([qx, qy])
+            return call_kernel(kernels[level], pars, cutoff=cutoff)
+        full = lambda: self._calc_theory(pars, cutoff=cutoff)
+        for result in grid.passes(calculate, full):
+            yield result
+
 
 class DirectModel(DataMixin):
     """
@@ -364,18 +625,51 @@ class DirectModel(DataMixin):
     *model* is a model calculator return from :func:`.core.load_model`
 
     *cutoff* is the polydispersity weight cutoff.
+
+    *pd_tolerance*, if given, selects the number of dispersity points
+    automatically, increasing them until $I(q)$ changes by less than this
+    relative amount.  See :class:`DispersityConvergence`.
+
+    *resolution*, if given, is the resolution calculator from another
+    calculator on the same q points, which is used rather than building a
+    new one for *data*.
     """
-    def __init__(self, data: Data, model: KernelModel, cutoff: float=1e-5) -> None:
-        # not type: (Data, KernelModel, float) -> None
+    def __init__(self, data: Data, model: KernelModel, cutoff: float=1e-5,
+                 pd_tolerance: Optional[float]=None,
+                 resolution: Optional[Resolution]=None) -> None:
+        # not type: (Data, KernelModel, float, Optional[float], Optional[Resolution]) -> None
         self.model = model
         self.cutoff = cutoff
+        if pd_tolerance is not None:
+            self.dispersity = DispersityConvergence(pd_tolerance)
         # Note: _interpret_data defines the model attributes
-        self._interpret_data(data, model)
+        self._interpret_data(data, model, shared_resolution=resolution)
 
     def __call__(self, **pars):
         # type: (**float) -> np.ndarray
         return self._calc_theory(pars, cutoff=self.cutoff)
 
+    def progressive(self, strides=(4, 2, 1), **pars):
+        # type: (Tuple[int, ...], **float) -> Iterator[Tuple[int, np.ndarray]]
+        """
+        Yield *(stride, Iq)* for a quick preview of 2D data.
+
+        The first passes evaluate the model on every stride-th row and
+        column of the detector and interpolate to the remaining pixels,
+        without resolution.  The final pass, with stride 1, is the same as
+        calling the model.  Stop iterating to cancel the remaining passes,
+        for example when the parameters change while dragging a slider::
+
+            for stride, Iq in calculator.progressive(radius=radius):
+                show(Iq)
+                if parameters_changed():
+                    break
+
+        For 1D and SESANS data there is only the final pass.
+        """
+        return self._calc_progressive(pars, cutoff=self.cutoff,
+                                      strides=strides)
+
     def simulate_data(self, noise=None, **pars):
         # type: (Optional[float], **float) -> None
         """
@@ -391,6 +685,356 @@ class DirectModel(DataMixin):
         """
         return call_profile(self.model.info, pars)
 
+
+class SharedKernel(object):
+    """
+    Evaluate a model on the combined *q* inputs of several datasets.
+
+    *model* is the :class:`.kernel.KernelModel` shared by the datasets and
+    *q_inputs* is a list with one entry per dataset, each being the tuple
+    *(q,)* or *(qx, qy)* of kernel inputs for that dataset.  The inputs are
+    concatenated into a single buffer so that the dispersity mesh is walked
+    once for all datasets, and on the GPU there is a single kernel launch.
+
+    Use :meth:`parts` to retrieve a kernel for each dataset.  The parts
+    return the slice of the combined result belonging to their dataset.
+    The combined result is cached, so when the datasets share all parameters
+    except *scale* and *background* only the first part to be called will
+    trigger a kernel evaluation.  The intermediate *results* of the kernel,
+    such as P(q) and S(q) for product models, are cached alongside it.
+    """
+    def __init__(self, model, q_inputs):
+        # type: (KernelModel, List[Tuple[np.ndarray, ...]]) -> None
+        if len(set(len(q) for q in q_inputs)) != 1:
+            raise ValueError("cannot combine 1D and 2D kernel inputs")
+        self.bounds = np.cumsum([0] + [len(q[0]) for q in q_inputs])
+        combined = [np.hstack(v) for v in zip(*q_inputs)]
+        self.kernel = model.make_kernel(combined)
+        self._cache = {}  # type: Dict[str, Tuple[bytes, Any]]
+        #: Intermediate results from the evaluation returned by :meth:`Iq`.
+        self.results = None  # type: Optional[Callable[[], OrderedDict]]
+
+    def parts(self):
+        # type: () -> List["KernelPart"]
+        """Return one kernel for each of the combined datasets."""
+        return [KernelPart(self, k) for k in range(len(self.bounds)-1)]
+
+    def _lookup(self, method, key):
+        # type: (str, bytes) -> Any
+        cached = self._cache.get(method, None)
+        return cached[1] if cached is not None and cached[0] == key else None
+
+    def Iq(self, call_details, values, cutoff, magnetic):
+        # type: (CallDetails, np.ndarray, float, bool) -> np.ndarray
+        """
+        Return I(q) for the combined inputs with *scale=1* and
+        *background=0*.  The result is linear in *scale* so the caller can
+        apply its own scale and background.
+        """
+        # Key on everything but scale and background so that datasets which
+        # differ only in those parameters share the evaluation.
+        key = b"".join((values[2:].tobytes(), call_details.buffer.tobytes(),
+                        np.array([cutoff, magnetic], 'd').tobytes()))
+        result = self._lookup('Iq', key)
+        if result is None:
+            unit_values = values.copy()
+            unit_values[0], unit_values[1] = 1., 0.
+            result = self.kernel.Iq(call_details, unit_values, cutoff, magnetic)
+            results = getattr(self.kernel, 'results', None)
+            self._cache['Iq'] = (key, (result, results))
+        else:
+            result, results = result
+        self.results = results
+        return result
+
+    def Fq(self, call_details, values, cutoff, magnetic,
+           radius_effective_mode=0):
+        # type: (CallDetails, np.ndarray, float, bool, int) -> Tuple[Any, ...]
+        """
+        Return *F, F^2, R_eff, V_shell, V_form/V_shell* for the combined
+        inputs.  Like :meth:`Iq`, the result is cached.
+        """
+        key = b"".join((values[2:].tobytes(), call_details.buffer.tobytes(),
+                        np.array([cutoff, magnetic, radius_effective_mode],
+                                 'd').tobytes()))
+        result = self._lookup('Fq', key)
+        if result is None:
+            result = self.kernel.Fq(call_details, values, cutoff, magnetic,
+                                    radius_effective_mode)
+            self._cache['Fq'] = (key, result)
+        return result
+
+    def release(self):
+        # type: () -> None
+        """Free resources associated with the combined kernel."""
+        self._cache.clear()
+        self.kernel.release()
+
+
+class KernelPart(Kernel):
+    """
+    Kernel for one dataset in a :class:`SharedKernel`.
+
+    The part has the same interface as the kernel returned from
+    *model.make_kernel(q_vectors)* for the dataset alone.
+    """
+    def __init__(self, shared, index):
+        # type: (SharedKernel, int) -> None
+        self.shared = shared
+        self.index = slice(shared.bounds[index], shared.bounds[index+1])
+        self.info = shared.kernel.info
+        self.dim = shared.kernel.dim
+        self.dtype = shared.kernel.dtype
+        self.results = None  # type: Optional[Callable[[], OrderedDict]]
+
+    def Iq(self, call_details, values, cutoff, magnetic):
+        # type: (CallDetails, np.ndarray, float, bool) -> np.ndarray
+        Iq = self.shared.Iq(call_details, values, cutoff, magnetic)
+        results = self.shared.results
+        self.results = (
+            None if results is None
+            else lambda: _part_results(results(), self.index, values[0]))
+        return values[0]*Iq[self.index] + values[1]
+    Iq.__doc__ = Kernel.Iq.__doc__
+    __call__ = Iq
+
+    def Fq(self, call_details, values, cutoff, magnetic,
+           radius_effective_mode=0):
+        # type: (CallDetails, np.ndarray, float, bool, int) -> Tuple[Any, ...]
+        F1, F2, radius_effective, shell_volume, volume_ratio = self.shared.Fq(
+            call_details, values, cutoff, magnetic, radius_effective_mode)
+        F1 = F1[self.index] if F1 is not None else None
+        return F1, F2[self.index], radius_effective, shell_volume, volume_ratio
+    Fq.__doc__ = Kernel.Fq.__doc__
+
+    @property
+    def stats(self):
+        # type: () -> Any
+        """Dispersity point counts from the combined evaluation."""
+        return self.shared.kernel.stats
+
+    def release(self):
+        # type: () -> None
+        """
+        Parts do not own any resources.  Use :meth:`SharedKernel.release`
+        to free the combined kernel.
+        """
+        pass
+
+
+def _part_results(parts, index, scale):
+    # type: (OrderedDict, slice, float) -> OrderedDict
+    """
+    Return the intermediate results *parts* from a :class:`SharedKernel`
+    for the dataset at *index* in the combined *q*.
+
+    The shared evaluation is for *scale=1*, so the "P(Q)" from a product
+    model, which includes the scale, is multiplied by *scale*.  Nested
+    parts, such as the components of a mixture, do not depend on it.
+    """
+    def select(value):
+        if isinstance(value, OrderedDict):
+            return OrderedDict((k, select(v)) for k, v in value.items())
+        if isinstance(value, tuple) and len(value) == 2:
+            q, y = value
+            if isinstance(q, (list, tuple)):
+                q = type(q)(v[index] for v in q)
+            elif isinstance(q, np.ndarray):
+                q = q[index]
+            return q, (y[index] if isinstance(y, np.ndarray) else y)
+        return value
+    parts = select(parts)
+    if "P(Q)" in parts:
+        q, Pq = parts["P(Q)"]
+        parts["P(Q)"] = q, scale*Pq
+    return parts
+
+
+def share_kernel(calculators):
+    # type: (List[DataMixin]) -> List[SharedKernel]
+    """
+    Evaluate the theory for several calculators with a single kernel call.
+
+    *calculators* is a list of :class:`DirectModel` or
+    :class:`.bumps_model.Experiment` objects, such as the experiments in
+    a simultaneous fit.  Calculators that use the same model and the same
+    data dimension are grouped together, with their kernel replaced by a
+    part of a :class:`SharedKernel` evaluating the combined *q* vector.
+
+    The theory for each dataset is unchanged.  Evaluation is only shared
+    when all model parameters other than *scale* and *background* are the
+    same between datasets; otherwise each part triggers its own evaluation
+    over the combined *q*, which is slower than evaluating separately.
+
+    Returns the list of shared kernels.  Pickled calculators do not keep
+    the shared kernel, and will fall back to separate evaluation.
+    """
+    groups = OrderedDict()  # type: Dict[Tuple[int, int], List[DataMixin]]
+    for calculator in calculators:
+        inputs = calculator._kernel_inputs()
+        groups.setdefault((id(calculator._model), len(inputs)), []).append(
+            (calculator, inputs))
+    shared_kernels = []
+    for group in groups.values():
+        if len(group) < 2:
+            continue
+        model = group[0][0]._model
+        shared = SharedKernel(model, [inputs for _, inputs in group])
+        for (calculator, _), part in zip(group, shared.parts()):
+            calculator._kernel = part
+        shared_kernels.append(shared)
+    return shared_kernels
+
+
+def test_share_kernel():
+    # type: () -> None
+    """Check that combined evaluation matches separate evaluation"""
+    from .data import empty_data1D
+    from .core import load_model
+
+    model = load_model('sphere', dtype='double', platform='dll')
+    pars = dict(radius=120, radius_pd=0.2, radius_pd_n=15)
+    data = [empty_data1D(np.logspace(-3, -1, 30)),
+            empty_data1D(np.logspace(-2, 0, 50), resolution=0.1)]
+    separate = [DirectModel(d, model) for d in data]
+    combined = [DirectModel(d, model) for d in data]
+    shared, = share_kernel(combined)
+
+    # Count the calls to the combined kernel.
+    calls = []
+    kernel_Iq = shared.kernel.Iq
+    def counted_Iq(*args):
+        calls.append(args)
+        return kernel_Iq(*args)
+    shared.kernel.Iq = counted_Iq
+
+    # Changing scale and background does not require a new evaluation.
+    for radius, scale, background, ncalls in [
+            (120, 1., 0., 1), (120, 2., 0.1, 1), (80, 2., 0.1, 2)]:
+        pars['radius'] = radius
+        for a, b in zip(separate, combined):
+            target = a(scale=scale, background=background, **pars)
+            actual = b(scale=scale, background=background, **pars)
+            assert np.allclose(actual, target, rtol=1e-12, atol=0)
+        assert len(calls) == ncalls, "expected one evaluation per parameter set"
+
+    # Product models keep the P(Q) and S(Q) breakdown for each dataset.
+    model = load_model('sphere@hardsphere', dtype='double', platform='dll')
+    pars = dict(radius=120, radius_pd=0.2, radius_pd_n=15, volfraction=0.2,
+                radius_effective_mode=1)
+    separate = [DirectModel(d, model) for d in data]
+    combined = [DirectModel(d, model) for d in data]
+    share_kernel(combined)
+    for scale in (1., 2.):
+        for a, b in zip(separate, combined):
+            a(scale=scale, **pars)
+            b(scale=scale, **pars)
+            target, actual = a.results(), b.results()
+            assert list(actual.keys()) == list(target.keys())
+            for key in ("P(Q)", "S(Q)"):
+                assert np.allclose(actual[key][0], target[key][0])
+                assert np.allclose(actual[key][1], target[key][1],
+                                   rtol=1e-12, atol=0), key
+            assert actual["volume"] == target["volume"]
+
+def test_kernel_stats():
+    # type: () -> None
+    """Check the dispersity point counts returned by the kernel"""
+    from .core import load_model
+
+    q = [np.logspace(-3, -1, 10)]
+    # Points with radius > radius_bell are invalid for barbell.
+    model = load_model('barbell', dtype='double', platform='dll')
+    kernel = model.make_kernel(q)
+    pars = dict(radius=20, radius_bell=22, radius_pd=0.2, radius_pd_n=21,
+                length=50, length_pd=0.1, length_pd_n=5)
+    call_kernel(kernel, pars, cutoff=0.)
+    stats = kernel.stats
+    assert stats.total == 21*5 and stats.cutoff == 0
+    assert 0 < stats.invalid < stats.total
+    call_kernel(kernel, pars, cutoff=1e-3)
+    assert kernel.stats.cutoff > 0
+    assert kernel.stats.total == stats.total
+    assert kernel.stats.invalid + kernel.stats.evaluated < stats.total
+
+    # Python kernels count the same way.
+    model = load_model('_spherepy')
+    kernel = model.make_kernel(q)
+    call_kernel(kernel, dict(radius=50, radius_pd=0.2, radius_pd_n=21),
+                cutoff=0.05)
+    assert kernel.stats.total == 21 and kernel.stats.invalid == 0
+    assert 0 < kernel.stats.cutoff < 21
+
+def test_dispersity_convergence():
+    # type: () -> None
+    """Check that automatic point counts follow the distribution width."""
+    from .core import load_model
+    q = np.logspace(-3, -1, 50)
+    kernel = load_model('sphere', dtype='double').make_kernel([q])
+    npts = []
+    for width in (0.01, 0.1):
+        auto = DispersityConvergence(tolerance=1e-3)
+        pars = dict(radius=100, radius_pd=width, radius_pd_type='lognormal')
+        Iq = auto(kernel, pars)
+        target = call_kernel(kernel, dict(pars, radius_pd_n=1025))
+        assert np.max(abs(Iq - target)/target) < 3e-3, width
+        npts.append(auto.npts['radius'])
+    # The default 80 points for lognormal are too many for the narrow
+    # distribution and too few for the broad one.
+    assert npts[0] < 80 < npts[1] < auto.max_npts, npts
+
+def test_progressive():
+    # type: () -> None
+    """Check that the coarse passes preview the final 2D result."""
+    from .core import load_model
+    from .data import empty_data2D
+    model = load_model('cylinder', dtype='double')
+    data = empty_data2D(np.linspace(-0.1, 0.1, 65), resolution=0.0)
+    data.mask = data.q_data < 0.01
+    calculator = DirectModel(data, model)
+    pars = dict(radius=20, length=200, theta=30, phi=20, theta_pd=10,
+                theta_pd_n=5, background=0.01)
+    passes = list(calculator.progressive(**pars))
+    assert [stride for stride, _ in passes] == [4, 2, 1]
+    assert np.allclose(passes[-1][1], calculator(**pars), rtol=1e-12)
+    target = passes[-1][1]
+    errors = [np.median(abs(Iq/target - 1)) for _, Iq in passes[:-1]]
+    assert errors[0] < 0.1 and errors[1] < errors[0], errors
+    # Coarse kernels are evaluated on a fraction of the detector.
+    _, grid, kernels = calculator._progressive
+    assert [len(qx) for _, qx, _ in grid.levels] == [17*17, 33*33]
+    # Scattered points have only the final pass.
+    qx, qy = np.random.RandomState(0).uniform(-0.1, 0.1, (2, 100))
+    assert Progressive2D(qx, qy).levels == []
+
+def test_oriented_slit():
+    # type: () -> None
+    """Check that the slit integral reuses its kernels between calls."""
+    from .core import load_model
+    from .data import empty_data1D
+    model = load_model('cylinder', dtype='double', platform='dll')
+    data = empty_data1D(np.logspace(-4, -2, 20))
+    data.oriented = True
+    data.dxl, data.dxw = 0.05*np.ones_like(data.x), 0.01*data.x
+    calculator = DirectModel(data, model)
+    pars = dict(radius=200, length=1000, theta=90, phi=30)
+    Iq = calculator(**pars)
+    # The kernel only covers the coarse grid, not the full one.
+    res = calculator.resolution
+    assert calculator._kernel.q_input.nq == len(res.q_coarse[0])
+    assert calculator._kernel.q_input.nq < res.nx*res.ny/2
+    # Compare to the full trapezoid rule on a finer grid.
+    from .resolution2d import Slit2D
+    fine = Slit2D(data.x, data.dxw, data.dxl, accuracy='xhigh')
+    grid = model.make_kernel(fine.q_calc)
+    target = fine.apply(call_kernel(grid, pars)) + 1e-3
+    assert np.allclose(Iq, target, rtol=2e-3)
+    # Same parameters, same points, so the refinement kernels are reused.
+    kernels = [kernel for _, _, kernel in calculator._refine_kernels]
+    assert kernels
+    assert np.array_equal(calculator(**pars), Iq)
+    assert kernels == [kernel for _, _, kernel in calculator._refine_kernels]
+
 def test_reparameterize():
     # type: () -> None
     """Check simple reparameterized models will load and build"""
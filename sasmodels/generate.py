@@ -175,7 +175,7 @@ from .custom import load_custom_kernel_module
 
 # pylint: disable=unused-import
 try:
-    from typing import Tuple, Sequence, Iterator, Dict, List
+    from typing import Tuple, Sequence, Iterator, Dict, List, Set
     from types import ModuleType
     from .modelinfo import ModelInfo
 except ImportError:
@@ -425,13 +425,17 @@ def tag_source(source):
         pass
     return "%08X"%(0xffffffff&crc32(source))
 
-def convert_type(source, dtype):
-    # type: (str, np.dtype) -> str
+def convert_type(source, dtype, mixed=False):
+    # type: (str, np.dtype, bool) -> str
     """
     Convert code from double precision to the desired type.
 
     Floating point constants are tagged with 'f' for single precision or 'L'
     for long double precision.
+
+    If *mixed* is True then variables declared as SAS_ACC, such as the
+    dispersity and orientation accumulators, remain in double precision
+    while everything else is converted.
     """
     source = _fix_tgmath_int(source)
     if dtype == F16:
@@ -448,6 +452,8 @@ def convert_type(source, dtype):
         source = _convert_type(source, "long double", "L")
     else:
         raise ValueError("Unexpected dtype in source conversion: %s" % dtype)
+    if mixed and fbytes < 8:
+        source = "#define USE_MIXED_PRECISION\n" + source
     return ("#define FLOAT_SIZE %d\n" % fbytes)+source
 
 
@@ -736,7 +742,8 @@ def _build_translation(model_info, table_id="_v", var_prefix="_var_"):
 
     * *subs* = {name: expr, ...} parameter substitution table for calling
       into the kernel function
-    * *translation* = "#define TRANSLATION_VARS(_v) _var_name = expr ...."
+    * *translation* = "#define TRANSLATION_VARS(_v) double _var_name = expr ...
+      #define TRANSLATION_UPDATE(_v, _par) ..."
     * *validity* = "#define VALID(_v) ..."
 
     The returned *subs* is used to generate the substitions for CALL_VOLUME
@@ -746,6 +753,12 @@ def _build_translation(model_info, table_id="_v", var_prefix="_var_"):
     the generated model files.  They are the same for all variants (1D, 2D,
     magnetic) so can be defined once along side the parameter table.  Even
     though they are expanded independently in each variant.
+
+    Intermediates are computed once before entering the dispersity loops, and
+    recomputed only when a parameter they depend on changes.  Expressions
+    for base parameters are also stored as intermediates rather than being
+    evaluated for every $q$, unless they depend on sld or orientation
+    parameters, which the kernel may overwrite within the loop body.
     """
     # Usual case of no translation.
     call_table = model_info.parameters.kernel_parameters
@@ -775,6 +788,24 @@ def _build_translation(model_info, table_id="_v", var_prefix="_var_"):
     variables = set(name for name, expr in assigns
                     if name not in call_pars and name not in base_pars)
 
+    # Find the caller parameters that each assignment depends on, following
+    # references through the intermediates.  Parameters which the kernel
+    # changes inside the loop body make the expression volatile.
+    volatile_pars = set(p.id for p in call_table
+                        if p.type in ('sld', 'orientation'))
+    depends = {}  # type: Dict[str, Set[str]]
+    for name, eq in assigns:
+        deps = set()  # type: Set[str]
+        for symbol in _IDENT_RE.findall(eq):
+            if symbol in variables:
+                deps |= depends.get(symbol, set())
+            elif symbol in call_pars:
+                deps.add(symbol)
+        depends[name] = deps
+    hoisted = set(name for name, eq in assigns if name in base_pars
+                  and name not in call_pars
+                  and not depends[name] & volatile_pars)
+
     # Regular expression substition to tag the variables on each RHS.
     # Don't want to translate all symbols since they include C constants and
     # math functions.
@@ -790,11 +821,20 @@ def _build_translation(model_info, table_id="_v", var_prefix="_var_"):
     # Create a substituion table assuming all parameters are directly assigned,
     # then update it with
     subs = {p.id: table_id+'.'+p.id for p in base_table}
-    subs.update((name, eq) for name, eq in assigns if name in base_pars)
-
-    # Build TRANSLATION_VARS macros assignments to variables.
-    var_values = [(var_prefix+name, eq) for name, eq in assigns
-                  if name in variables]
+    subs.update((name, var_prefix+name if name in hoisted else eq)
+                for name, eq in assigns if name in base_pars)
+
+    # Build TRANSLATION_VARS macros assignments to variables, with the
+    # positions in the parameter vector of the parameters they depend on.
+    index = {}  # type: Dict[str, List[int]]
+    offset = 0
+    for p in call_table:
+        index[p.id] = list(range(offset, offset + p.length))
+        offset += p.length
+    var_values = [(var_prefix+name, eq,
+                   sorted(k for par in depends[name] for k in index[par]))
+                  for name, eq in assigns
+                  if name in variables or name in hoisted]
     translation_vars = _build_translation_vars(table_id, var_values)
 
     # Build VALID macro, with expressions using caller parameters.
@@ -804,23 +844,39 @@ def _build_translation(model_info, table_id="_v", var_prefix="_var_"):
 
 def _build_translation_vars(table_id, variables):
     r"""
-    Build TRANSLATION_VARS macro for C which builds intermediate values.
+    Build TRANSLATION_VARS macro for C which builds intermediate values,
+    and the TRANSLATION_UPDATE macro which recomputes those that depend on
+    the parameter at position *_par* in the parameter vector.
+
+    *variables* is a list of *(name, expr, [index, ...])*.
 
     E. g.,
 
     ::
 
         #define TRANSLATION_VARS(_v) \
-         const double _temporary_Re = cbrt(_v.volume/_v.eccentricity/M_4PI_3)
+          double _var_Re = cbrt(_v.volume/_v.eccentricity/M_4PI_3)
+        #define TRANSLATION_UPDATE(_v, _par) do { \
+          if (_par == 2 || _par == 3) \
+            _var_Re = cbrt(_v.volume/_v.eccentricity/M_4PI_3); \
+        } while (0)
     """
     if variables:
-        # Leave comma off def since last def doesn't have comma
-        defs = ["const double %s = %s" % (name, eq)
-                for name, eq in variables]
+        # Leave semicolon off def since last def doesn't have semicolon
+        defs = ["double %s = %s" % (name, eq)
+                for name, eq, _ in variables]
+        updates = ["if (%s) \\\n    %s = %s;" % (
+            " || ".join("_par == %d" % k for k in deps), name, eq)
+                   for name, eq, deps in variables if deps]
         return ("#define TRANSLATION_VARS(%s) \\\n  "%table_id
-                + "; \\\n  ".join(defs))
+                + "; \\\n  ".join(defs)
+                + "\n#define TRANSLATION_UPDATE(%s, _par) do { \\\n  "%table_id
+                + " \\\n  ".join(updates)
+                + " \\\n} while (0)")
     else:
-        return '#define TRANSLATION_VARS(%s) do {} while(0)'%table_id
+        return ('#define TRANSLATION_VARS(%s) do {} while(0)\n'
+                '#define TRANSLATION_UPDATE(%s, _par) do {} while(0)'
+                % (table_id, table_id))
 
 def _build_validity_check(eq, table_id, subs):
     """
@@ -839,6 +895,33 @@ def _build_validity_check(eq, table_id, subs):
         eq = _IDENT_RE.sub(id_sub, eq)
         return "#define VALID(%s) (%s)" % (table_id, eq)
 
+def test_build_translation():
+    """
+    Check that translated parameters are computed outside the q loop and
+    only recomputed when the parameters they depend on change.
+    """
+    from numpy import inf
+    from .core import reparameterize
+    parameters = [
+        ["volume", "Ang^3", 1e5, [0, inf], "volume", "ellipsoid volume"],
+        ["eccentricity", "", 1, [0, inf], "volume", "polar:equatorial radius"],
+        ["contrast", "1e-6/Ang^2", 1, [-inf, inf], "sld", "sld contrast"],
+    ]
+    translation = """
+        Re = cbrt(volume/eccentricity/M_4PI_3)
+        radius_polar = eccentricity*Re
+        radius_equatorial = Re
+        sld = sld_solvent + contrast
+        """
+    info = reparameterize('ellipsoid', parameters, translation,
+                          insert_after={'': 'volume,eccentricity,contrast'})
+    subs, translation_vars, _ = _build_translation(info)
+    assert subs['radius_polar'] == '_var_radius_polar'
+    # Magnetic kernels change the sld inside the q loop.
+    assert subs['sld'] == '_v.sld_solvent + _v.contrast'
+    assert "if (_par == 0 || _par == 1) \\\n    _var_Re = " in translation_vars
+    assert "_var_sld" not in translation_vars
+
 _IQXY_PATTERN = re.compile(r"(^|\s)double\s+I(?P<mode>q(ac|abc|xy))\s*[(]",
                            flags=re.MULTILINE)
 def find_xy_mode(source):
@@ -1115,12 +1198,56 @@ def make_source(model_info):
                         call_iqxy, clear_iqxy, model_info.name)
     code = '\n'.join(source + wrappers[0] + wrappers[1] + wrappers[2])
 
-    # Note: Identical code for dll and opencl.  This may not always be the case
-    # so leave them as separate entries in the returned value.
-    result = {'dll': code, 'opencl': code}
+    # The dll also describes the model parameters so that it can be used
+    # without python, through sasmodels/libsasmodels.c.
+    result = {'dll': code + '\n' + _dll_info(model_info), 'opencl': code}
     return result
 
 
+# Version of the model description returned by sasmodels_info() in the dll.
+DLL_INFO_VERSION = 1
+
+def _dll_info(model_info):
+    # type: (ModelInfo) -> str
+    """
+    Return the C source for *sasmodels_info*, which describes the model
+    parameters for libsasmodels.c.
+
+    The description is text, one item per line, with a line for each of the
+    call parameters giving its name, default, limits, whether it is
+    polydisperse in 1D and in 2D, and whether the dispersity is relative::
+
+        par radius 50 0 inf 1 1 1
+
+    The size of *double* in the compiled kernel is returned in *real_size*.
+    """
+    partable = model_info.parameters
+    lines = [
+        "sasmodels %d" % DLL_INFO_VERSION,
+        "name %s" % model_info.name,
+        "have_fq %d" % bool(model_info.have_Fq),
+        "npars %d" % partable.npars,
+        "nvalues %d" % partable.nvalues,
+        "max_pd %d" % partable.max_pd,
+        "nmagnetic %d" % partable.nmagnetic,
+        "theta_par %d" % partable.theta_offset,
+    ]
+    for p in partable.call_parameters:
+        lines.append("par %s %.17g %.17g %.17g %d %d %d" % (
+            p.id, p.default, p.limits[0], p.limits[1],
+            p.name in partable.pd_1d, p.name in partable.pd_2d,
+            bool(p.relative_pd)))
+    text = "\n".join('  "%s\\n"' % line for line in lines)
+    return """\
+kernel const char *sasmodels_info(int32_t *real_size)
+{
+  *real_size = (int32_t)sizeof(double);
+  return
+%s;
+}
+""" % text
+
+
 def _kernels(kernel, call_iq, clear_iq, call_iqxy, clear_iqxy, name):
     # type: (Dict[str, str], str, str, str, str, str) -> List[str]
     code = kernel[0]
@@ -1160,6 +1287,90 @@ def _kernels(kernel, call_iq, clear_iq, call_iqxy, clear_iqxy, name):
     return iq, iqxy, imagnetic
 
 
+def product_kernel_name(model_info):
+    # type: (ModelInfo) -> str
+    """
+    Name of the fused P@S kernel symbol for the product *model_info*.
+    """
+    p_info, s_info = model_info.composition[1]
+    return "%s_%s_Iq" % (p_info.name, s_info.name)
+
+
+def make_product_source(model_info):
+    # type: (ModelInfo) -> Dict[str, str]
+    """
+    Generate the dll source for a product model from
+    :func:`.product.make_product_info`.
+
+    The source contains the form factor kernels from :func:`make_source`,
+    followed by the structure factor functions, renamed to *Iq_S* and
+    *form_volume_S*, and a fused 1D kernel named by
+    :func:`product_kernel_name` which computes <F>, <F^2>, the effective
+    radius and the volume ratio, then S(q) and the combined I(q) in one
+    pass.  See *kernel_product.c* for details.
+
+    Raises ValueError if the structure factor cannot be fused, such as a
+    python model or one with reparameterized, vector or dispersity limited
+    parameters.  Only the dll is supported.
+    """
+    from .product import VOLFRAC_ID
+
+    p_info, s_info = model_info.composition[1]
+    s_table = s_info.parameters
+    if callable(s_info.Iq):
+        raise ValueError("can't fuse python structure factor")
+    if (s_info.translation or s_info.valid or s_info.have_Fq
+            or any(p.length > 1 for p in s_table.kernel_parameters)
+            or s_table.iq_parameters != s_table.kernel_parameters):
+        raise ValueError("can't fuse structure factor %s" % s_info.id)
+
+    # Form factor kernels, followed by the structure factor functions.
+    source = [make_source(p_info)['dll']]
+    p_sources = set(model_sources(p_info))
+    source.append("#define Iq Iq_S")
+    source.append("#define form_volume form_volume_S")
+    for path in model_sources(s_info):
+        if path not in p_sources:
+            _add_source(source, read_text(path), path)
+    if s_info.c_code:
+        _add_source(source, s_info.c_code, s_info.basefile,
+                    lineno=s_info.lineno.get('c_code', 1))
+    q = Parameter(name='q')
+    if isinstance(s_info.form_volume, str):
+        source.append(_gen_fn(s_info, 'form_volume',
+                              s_table.form_volume_parameters))
+    if isinstance(s_info.Iq, str):
+        source.append(_gen_fn(s_info, 'Iq', [q] + s_table.iq_parameters))
+    source.append("#undef form_volume")
+    source.append("#undef Iq")
+
+    # radius_effective and volfraction are the first two S parameters,
+    # with the remaining parameters in the *product* vector.
+    refs = dict(zip((p.id for p in s_table.kernel_parameters),
+                    ["_radius", "_volfrac"]
+                    + ["(_s)[%d]" % k for k in range(s_table.npars - 2)]))
+    call_s = "#define CALL_S(_q, _radius, _volfrac, _s) Iq_S(%s)" % ",".join(
+        ["_q"] + [refs[p.id] for p in s_table.iq_parameters])
+    if s_table.form_volume_parameters:
+        call_volume = (
+            "#define CALL_S_VOLUME(_radius, _volfrac, _s) form_volume_S(%s)"
+            % ",".join(refs[p.id] for p in s_table.form_volume_parameters))
+    else:
+        call_volume = "#define CALL_S_VOLUME(_radius, _volfrac, _s) 1.0"
+    kernel_code, path = load_template('kernel_product.c')
+    source.extend([
+        "#define PRODUCT_KERNEL_NAME %s" % product_kernel_name(model_info),
+        "#define FORM_KERNEL %s" % kernel_name(p_info, "Iq"),
+        "#define FORM_NOUT %d" % (2 if p_info.have_Fq else 1),
+        "#define VOLFRAC_IN_P %d" % (VOLFRAC_ID in p_info.parameters),
+        call_s,
+        call_volume,
+        '#line 1 "%s"' % _clean_source_filename(path),
+        kernel_code,
+        ])
+    return {'dll': '\n'.join(source)}
+
+
 def load_kernel_module(model_name):
     # type: (str) -> ModuleType
     """
@@ -11,9 +11,13 @@ the kernel should be released, which also releases the inputs.
 
 from __future__ import division, print_function
 
+import os
+
+from . import trace
+
 # pylint: disable=unused-import
 try:
-    from typing import List, Any
+    from typing import List, Any, Optional
 except ImportError:
     pass
 else:
@@ -58,7 +62,7 @@ class Kernel(object):
             self.info = <ModelInfo object>
             self.dim = <'1d' or '2d'>
             self.dtype = <kernel.dtype>
-            size = 2*self.q_input.nq+4 if self.info.have_Fq else self.q_input.nq+4
+            size = 2*self.q_input.nq+7 if self.info.have_Fq else self.q_input.nq+7
             size = size + <extra padding if needed for kernel>
             self.result = np.empty(size, dtype=self.dtype)
 
@@ -78,6 +82,9 @@ class Kernel(object):
             self.result[end + 1] = form_volume
             self.result[end + 2] = shell_volume
             self.result[end + 3] = radius_effective
+            self.result[end + 4] = num_evaluated
+            self.result[end + 5] = num_cutoff
+            self.result[end + 6] = num_invalid
     """
     #: Kernel dimension, either "1d" or "2d".
     dim = None  # type: str
@@ -89,6 +96,14 @@ class Kernel(object):
     q_input = None  # type: Any
     #: Place to hold result of *_call_kernel()* for subclass.
     result = None # type: np.ndarray
+    #: Dispersity point counts from the last call, or None if the kernel
+    #: does not provide them.
+    stats = None # type: Optional[KernelStats]
+    #: Use the closed form dispersity average from :mod:`.analytic` when
+    #: the model and dispersity allow it.  This averages over the whole
+    #: distribution rather than the *npts* by *nsigmas* mesh, so it is off
+    #: unless the environment variable *SAS_ANALYTIC=1* is set.
+    analytic = os.environ.get("SAS_ANALYTIC", "0") not in ("", "0")
 
     def Iq(self, call_details, values, cutoff, magnetic):
         # type: (CallDetails, np.ndarray, np.ndarray, float, bool) -> np.ndarray
@@ -179,8 +194,25 @@ class Kernel(object):
         this scale factor evaluates to one and so can be used for both
         hollow and solid shapes.
         """
-        self._call_kernel(call_details, values, cutoff, magnetic,
-                          radius_effective_mode)
+        if self.analytic:
+            from . import analytic
+            result = analytic.Fq(self, call_details, values, cutoff,
+                                 magnetic, radius_effective_mode)
+            if result is not None:
+                return result
+        return self._mesh_Fq(call_details, values, cutoff, magnetic,
+                             radius_effective_mode)
+
+    def _mesh_Fq(self, call_details, values, cutoff, magnetic,
+                 radius_effective_mode):
+        # type: (CallDetails, np.ndarray, np.ndarray, float, bool, int) -> np.ndarray
+        """
+        Returns the :meth:`Fq` values summed over the dispersity mesh.
+        """
+        with trace.span("kernel", self.info.id, details=lambda: {
+                'nq': self.q_input.nq, 'npd': int(call_details.num_eval)}):
+            self._call_kernel(call_details, values, cutoff, magnetic,
+                              radius_effective_mode)
         #print("returned",self.q_input.q, self.result)
         nout = 2 if self.info.have_Fq and self.dim == '1d' else 1
         total_weight = self.result[nout*self.q_input.nq + 0]
@@ -198,6 +230,8 @@ class Kernel(object):
         F1 = (self.result[1:nout*self.q_input.nq:nout]/total_weight
               if nout == 2 else None)
         F2 = self.result[0:nout*self.q_input.nq:nout]/total_weight
+        counts = self.result[nout*self.q_input.nq + 4:nout*self.q_input.nq + 7]
+        self.stats = KernelStats(*counts) if len(counts) == 3 else None
         return F1, F2, radius_effective, shell_volume, form_volume/shell_volume
 
     def release(self):
@@ -216,3 +250,32 @@ class Kernel(object):
         engines need to provide an implementation for this.
         """
         raise NotImplementedError()
+
+
+class KernelStats(object):
+    """
+    Number of dispersity points seen by the kernel in the last call.
+
+    *evaluated* is the number of points for which the form factor was
+    computed, *cutoff* is the number skipped because their weight was below
+    the polydispersity cutoff, and *invalid* is the number rejected by the
+    model as outside its valid parameter domain.
+
+    For single precision kernels the counts are exact up to $2^{24}$ points.
+    """
+    def __init__(self, evaluated, cutoff, invalid):
+        # type: (float, float, float) -> None
+        self.evaluated = int(evaluated)
+        self.cutoff = int(cutoff)
+        self.invalid = int(invalid)
+
+    @property
+    def total(self):
+        # type: () -> int
+        """Total number of points in the dispersity mesh."""
+        return self.evaluated + self.cutoff + self.invalid
+
+    def __repr__(self):
+        # type: () -> str
+        return "KernelStats(evaluated=%d, cutoff=%d, invalid=%d)" % (
+            self.evaluated, self.cutoff, self.invalid)
@@ -9,6 +9,14 @@
 // Use SAS_DOUBLE to force the use of double even for float kernels
 #define SAS_DOUBLE dou ## ble
 
+// Use SAS_ACC for accumulators in long sums.  It is double in mixed precision
+// kernels (see generate.convert_type) and the kernel float type otherwise.
+#ifdef USE_MIXED_PRECISION
+#  define SAS_ACC SAS_DOUBLE
+#else
+#  define SAS_ACC double
+#endif
+
 // If opencl is not available, then we are compiling a C function
 // Note: if using a C++ compiler, then define kernel as extern "C"
 #ifdef USE_OPENCL
@@ -27,6 +27,8 @@
 //      parameters in the parameter table.
 //  TRANSLATION_VARS(table) : series of intermediate expressions used to
 //      compute parameter substitions when reparameterizing a model.
+//  TRANSLATION_UPDATE(table, par) : recompute the intermediates which
+//      depend on parameter vector entry par after it changes.
 //  VALID(table) : test if the current point is feesible to calculate.
 //  CALL_VOLUME(form, shell, table) : assign form and shell values.
 //  CALL_RADIUS_EFFECTIVE(mode, table) : call the R_eff function.
@@ -322,7 +324,7 @@ void KERNEL_NAME(
     pglobal const ProblemDetails *details,
     pglobal const double *values, // parameter values and distributions
     pglobal const double *q,      // nq q values, with padding to boundary
-    pglobal double *result,       // nq+1 return values, again with padding
+    pglobal SAS_ACC *result,      // nq+7 return values, again with padding
     const double cutoff,          // cutoff in the dispersity weight product
     int32_t radius_effective_mode // which effective radius to compute
     )
@@ -384,28 +386,36 @@ void KERNEL_NAME(
   // the calculation from somewhere in the middle of the dispersity mesh,
   // and we update the value rather than reset it. Similarly for the
   // normalization factor, which is stored as the final value in the
-  // results vector (one past the number of q values).
+  // results vector (one past the number of q values), and for the counts
+  // of points evaluated, dropped by the cutoff and failing VALID which
+  // follow the effective radius.
   //
   // The code differs slightly between opencl and dll since opencl is only
   // seeing one q value (stored in the variable "this_F2") while the dll
   // version must loop over all q.
   #if defined(CALL_FQ)
-    double weight_norm = (pd_start == 0 ? 0.0 : result[2*nq]);
-    double weighted_form = (pd_start == 0 ? 0.0 : result[2*nq+1]);
-    double weighted_shell = (pd_start == 0 ? 0.0 : result[2*nq+2]);
-    double weighted_radius = (pd_start == 0 ? 0.0 : result[2*nq+3]);
+    SAS_ACC weight_norm = (pd_start == 0 ? 0.0 : result[2*nq]);
+    SAS_ACC weighted_form = (pd_start == 0 ? 0.0 : result[2*nq+1]);
+    SAS_ACC weighted_shell = (pd_start == 0 ? 0.0 : result[2*nq+2]);
+    SAS_ACC weighted_radius = (pd_start == 0 ? 0.0 : result[2*nq+3]);
+    SAS_ACC num_evaluated = (pd_start == 0 ? 0.0 : result[2*nq+4]);
+    SAS_ACC num_cutoff = (pd_start == 0 ? 0.0 : result[2*nq+5]);
+    SAS_ACC num_invalid = (pd_start == 0 ? 0.0 : result[2*nq+6]);
   #else
-    double weight_norm = (pd_start == 0 ? 0.0 : result[nq]);
-    double weighted_form = (pd_start == 0 ? 0.0 : result[nq+1]);
-    double weighted_shell = (pd_start == 0 ? 0.0 : result[nq+2]);
-    double weighted_radius = (pd_start == 0 ? 0.0 : result[nq+3]);
+    SAS_ACC weight_norm = (pd_start == 0 ? 0.0 : result[nq]);
+    SAS_ACC weighted_form = (pd_start == 0 ? 0.0 : result[nq+1]);
+    SAS_ACC weighted_shell = (pd_start == 0 ? 0.0 : result[nq+2]);
+    SAS_ACC weighted_radius = (pd_start == 0 ? 0.0 : result[nq+3]);
+    SAS_ACC num_evaluated = (pd_start == 0 ? 0.0 : result[nq+4]);
+    SAS_ACC num_cutoff = (pd_start == 0 ? 0.0 : result[nq+5]);
+    SAS_ACC num_invalid = (pd_start == 0 ? 0.0 : result[nq+6]);
   #endif
   #if defined(USE_GPU)
     #if defined(CALL_FQ)
-      double this_F2 = (pd_start == 0 ? 0.0 : result[2*q_index+0]);
-      double this_F1 = (pd_start == 0 ? 0.0 : result[2*q_index+1]);
+      SAS_ACC this_F2 = (pd_start == 0 ? 0.0 : result[2*q_index+0]);
+      SAS_ACC this_F1 = (pd_start == 0 ? 0.0 : result[2*q_index+1]);
     #else
-      double this_F2 = (pd_start == 0 ? 0.0 : result[q_index]);
+      SAS_ACC this_F2 = (pd_start == 0 ? 0.0 : result[q_index]);
     #endif
   #else // !USE_GPU
     if (pd_start == 0) {
@@ -650,6 +660,7 @@ After expansion, the loop struction will look like the following:
 #define PD_OPEN(_LOOP,_OUTER) \
   while (i##_LOOP < n##_LOOP) { \
     local_values.vector[p##_LOOP] = v##_LOOP[i##_LOOP]; \
+    TRANSLATION_UPDATE(local_values.table, p##_LOOP); \
     const double weight##_LOOP = w##_LOOP[i##_LOOP] * weight##_OUTER;
 
 // create the variable "weight#=1.0" where # is the outermost level+1 (=MAX_PD).
@@ -695,6 +706,11 @@ int step = pd_start;
   PD_INIT(0)
 #endif
 
+// Intermediates for reparameterized models.  Each loop recomputes those
+// which depend on its parameter, so values fixed across the mesh are only
+// computed once.
+TRANSLATION_VARS(local_values.table);
+
 // open nested loops
 PD_OUTERMOST_WEIGHT(MAX_PD)
 #if MAX_PD>4
@@ -716,8 +732,6 @@ PD_OUTERMOST_WEIGHT(MAX_PD)
 //if (q_index==0) {printf("step:%d of %d, pars:",step,pd_stop); for (int i=0; i < NUM_PARS; i++) printf("p%d=%g ",i, local_values.vector[i]); printf("\n");}
 
   // ====== loop body =======
-  // Note: recalc all intermediates for each loop, because we don't know order
-  TRANSLATION_VARS(local_values.table);
   if (VALID(local_values.table)) {
      APPLY_PROJECTION();
 
@@ -726,6 +740,7 @@ PD_OUTERMOST_WEIGHT(MAX_PD)
     if (weight > cutoff) {
       double form, shell;
       CALL_VOLUME(form, shell, local_values.table);
+      num_evaluated += 1.0;
       weight_norm += weight;
       weighted_form += weight * form;
       weighted_shell += weight * shell;
@@ -802,7 +817,11 @@ PD_OUTERMOST_WEIGHT(MAX_PD)
           #endif
         #endif // !USE_OPENCL
       }
+    } else {
+      num_cutoff += 1.0;
     }
+  } else {
+    num_invalid += 1.0;
   }
 // close nested loops
 ++step;
@@ -838,11 +857,17 @@ PD_OUTERMOST_WEIGHT(MAX_PD)
     result[2*nq+1] = weighted_form;
     result[2*nq+2] = weighted_shell;
     result[2*nq+3] = weighted_radius;
+    result[2*nq+4] = num_evaluated;
+    result[2*nq+5] = num_cutoff;
+    result[2*nq+6] = num_invalid;
 #else
     result[nq] = weight_norm;
     result[nq+1] = weighted_form;
     result[nq+2] = weighted_shell;
     result[nq+3] = weighted_radius;
+    result[nq+4] = num_evaluated;
+    result[nq+5] = num_cutoff;
+    result[nq+6] = num_invalid;
 #endif
   }
 
@@ -0,0 +1,81 @@
+// Fused P@S kernel for the dll, following the form factor kernels.
+//
+// NOTE: the following macros are defined in generate.make_product_source:
+//
+//  PRODUCT_KERNEL_NAME : name of the fused kernel
+//  FORM_KERNEL : the 1D kernel for the form factor, such as sphere_Iq
+//  FORM_NOUT : 2 if the form factor returns <F> and <F^2>, otherwise 1
+//  VOLFRAC_IN_P : 1 if the volume fraction is a form factor parameter
+//  CALL_S(_q, _radius, _volfrac, _s) : call the renamed structure factor Iq
+//      with the remaining structure factor parameters in _s.
+//  CALL_S_VOLUME(_radius, _volfrac, _s) : call the renamed structure factor
+//      form_volume, or 1.0 if it has no volume parameters.
+//
+// The *product* vector holds scale, background, volfraction, beta mode,
+// radius_effective, then the remaining structure factor parameters.
+//
+// The form factor dispersity loop is called in chunks from pd_start to
+// pd_stop, accumulating into result as usual.  After the final chunk the
+// sums are normalized and combined with S(q) as in product.ProductKernel,
+// storing S(q) and I(q) in the 2*nq slots after the form factor results.
+
+kernel
+void PRODUCT_KERNEL_NAME(
+    int32_t nq,                   // number of q values
+    const int32_t pd_start,       // where we are in the dispersity loop
+    const int32_t pd_stop,        // where we are stopping in the dispersity loop
+    pglobal const ProblemDetails *details,
+    pglobal const double *values, // form factor values and distributions
+    pglobal const double *q,      // nq q values, with padding to boundary
+    pglobal SAS_ACC *result,      // form factor results, then S(q) and I(q)
+    const double cutoff,          // cutoff in the dispersity weight product
+    int32_t radius_effective_mode,// which effective radius to compute
+    pglobal const double *product // P@S parameters
+    )
+{
+  FORM_KERNEL(nq, pd_start, pd_stop, details, values, q, result, cutoff,
+              radius_effective_mode);
+  if (pd_stop < details->num_eval) return;
+
+  // Normalize the totals as in Kernel._mesh_Fq.
+  const int32_t end = FORM_NOUT*nq;
+  const double weight_norm = (result[end] == 0.0 ? 1.0 : result[end]);
+  const double form_volume = result[end+1]/weight_norm;
+  const double weighted_shell = result[end+2]/weight_norm;
+  const double shell_volume = (weighted_shell == 0.0 ? 1.0 : weighted_shell);
+  const double volume_ratio = form_volume/shell_volume;
+  const double radius = (radius_effective_mode > 0
+      ? result[end+3]/weight_norm : product[4]);
+
+  const double scale = product[0];
+  const double background = product[1];
+  const double volfrac = product[2];
+  const double s_volfrac = volfrac*volume_ratio;
+  const double s_volume = CALL_S_VOLUME(radius, s_volfrac, product+5);
+  const double s_norm = (s_volume == 0.0 ? 1.0 : s_volume);
+  const double combined_scale = (VOLFRAC_IN_P ? 1.0 : volfrac)
+      * (scale/shell_volume);
+
+  pglobal SAS_ACC *S_out = result + end + 7;
+  pglobal SAS_ACC *I_out = S_out + nq;
+  #ifdef USE_OPENMP
+  #pragma omp parallel for
+  #endif
+  for (int q_index=0; q_index < nq; q_index++) {
+    const double Sq = CALL_S(q[q_index], radius, s_volfrac, product+5)/s_norm;
+    const double Fsq = result[FORM_NOUT*q_index]/weight_norm;
+    double PS;
+    #if FORM_NOUT == 2
+    if (product[3] > 0.0) {  // beta approximation
+      const double F = result[2*q_index+1]/weight_norm;
+      PS = Fsq + (Sq - 1.0)*F*F;
+    } else {
+      PS = Fsq*Sq;
+    }
+    #else
+    PS = Fsq*Sq;
+    #endif
+    S_out[q_index] = Sq;
+    I_out[q_index] = PS*combined_scale + background;
+  }
+}
@@ -210,8 +210,8 @@ def get_warp(kernel, queue):
         queue.device)
 
 
-def compile_model(context, source, dtype, fast=False):
-    # type: (cl.Context, str, np.dtype, bool) -> cl.Program
+def compile_model(context, source, dtype, fast=False, mixed=False):
+    # type: (cl.Context, str, np.dtype, bool, bool) -> cl.Program
     """
     Build a model to run on the gpu.
 
@@ -222,12 +222,14 @@ def compile_model(context, source, dtype, fast=False):
     dtype = np.dtype(dtype)
     if not all(has_type(d, dtype) for d in context.devices):
         raise RuntimeError("%s not supported for devices"%dtype)
+    if mixed and not all(has_type(d, generate.F64) for d in context.devices):
+        raise RuntimeError("mixed precision not supported for devices")
 
-    source_list = [generate.convert_type(source, dtype)]
+    source_list = [generate.convert_type(source, dtype, mixed=mixed)]
 
     if dtype == generate.F16:
         source_list.insert(0, _F16_PRAGMA)
-    elif dtype == generate.F64:
+    if dtype == generate.F64 or mixed:
         source_list.insert(0, _F64_PRAGMA)
 
     # Note: USE_SINCOS makes the Intel CPU slower under OpenCL.
@@ -290,15 +292,17 @@ class GpuEnvironment(object):
         """
         return self.context.get(dtype, None) is not None
 
-    def compile_program(self, name, source, dtype, fast, timestamp):
-        # type: (str, str, np.dtype, bool, float) -> cl.Program
+    def compile_program(self, name, source, dtype, fast, timestamp,
+                        mixed=False):
+        # type: (str, str, np.dtype, bool, float, bool) -> cl.Program
         """
         Compile the program for the device in the given context.
         """
         # Note: PyOpenCL caches based on md5 hash of source, options and device
         # but I'll do so as well just to save some data munging time.
         tag = generate.tag_source(source)
-        key = "%s-%s-%s%s"%(name, dtype, tag, ("-fast" if fast else ""))
+        key = "%s-%s-%s%s%s"%(name, dtype, tag, ("-fast" if fast else ""),
+                              ("-mixed" if mixed else ""))
         # Check timestamp on program.
         program, program_timestamp = self.compiled.get(key, (None, np.inf))
         if program_timestamp < timestamp:
@@ -308,7 +312,7 @@ class GpuEnvironment(object):
             logging.info("building %s for OpenCL %s", key,
                          context.devices[0].name.strip())
             program = compile_model(self.context[dtype],
-                                    str(source), dtype, fast)
+                                    str(source), dtype, fast, mixed)
             self.compiled[key] = (program, timestamp)
         return program
 
@@ -414,31 +418,36 @@ class GpuModel(KernelModel):
     is an optional extension which may not be available on all devices.
     Half precision ('float16','half') may be available on some devices.
     Fast precision ('fast') is a loose version of single precision, indicating
-    that the compiler is allowed to take shortcuts.
+    that the compiler is allowed to take shortcuts.  Mixed precision
+    (*mixed=True*) is single precision with the sums accumulated and
+    returned in double precision.
     """
     info = None  # type: ModelInfo
     source = ""  # type: str
     dtype = None  # type: np.dtype
     fast = False  # type: bool
+    mixed = False  # type: bool
     _program = None  # type: cl.Program
     _kernels = None  # type: Dict[str, cl.Kernel]
 
-    def __init__(self, source, model_info, dtype=generate.F32, fast=False):
-        # type: (Dict[str,str], ModelInfo, np.dtype, bool) -> None
+    def __init__(self, source, model_info, dtype=generate.F32, fast=False,
+                 mixed=False):
+        # type: (Dict[str,str], ModelInfo, np.dtype, bool, bool) -> None
         #print("create model", id(self))
         self.info = model_info
         self.source = source
         self.dtype = dtype
         self.fast = fast
+        self.mixed = mixed
         # TODO: can a model be freed?
 
     def __getstate__(self):
-        # type: () -> Tuple[ModelInfo, str, np.dtype, bool]
-        return self.info, self.source, self.dtype, self.fast
+        # type: () -> Tuple[ModelInfo, str, np.dtype, bool, bool]
+        return self.info, self.source, self.dtype, self.fast, self.mixed
 
     def __setstate__(self, state):
-        # type: (Tuple[ModelInfo, str, np.dtype, bool]) -> None
-        self.info, self.source, self.dtype, self.fast = state
+        # type: (Tuple[ModelInfo, str, np.dtype, bool, bool]) -> None
+        self.info, self.source, self.dtype, self.fast, self.mixed = state
         self._program = self._kernels = None
 
     def make_kernel(self, q_vectors):
@@ -464,7 +473,8 @@ class GpuModel(KernelModel):
             self.source['opencl'],
             self.dtype,
             self.fast,
-            timestamp)
+            timestamp,
+            mixed=self.mixed)
         variants = ['Iq', 'Iqxy', 'Imagnetic']
         names = [generate.kernel_name(self.info, k) for k in variants]
         functions = [getattr(program, k) for k in names]
@@ -589,13 +599,16 @@ class GpuKernel(Kernel):
 
         # Holding place for the returned value.
         nout = 2 if self.info.have_Fq and self.dim == '1d' else 1
-        extra_q = 4  # Total weight, form volume, shell volume and R_eff.
-        self.result = np.empty(self.q_input.nq*nout + extra_q, dtype)
+        # Total weight, form volume, shell volume, R_eff and the number of
+        # points evaluated, dropped by cutoff and rejected as invalid.
+        extra_q = 7
+        result_dtype = generate.F64 if model.mixed else dtype
+        self.result = np.empty(self.q_input.nq*nout + extra_q, result_dtype)
 
         # Allocate result value on GPU.
         env = environment()
         context = env.context[self.dtype]
-        width = ((self.result.size+31)//32)*32 * self.dtype.itemsize
+        width = ((self.result.size+31)//32)*32 * self.result.itemsize
         self._result_b = cl.Buffer(context, mf.READ_WRITE, width)
 
     def _call_kernel(self, call_details, values, cutoff, magnetic,
@@ -204,8 +204,8 @@ def show_device_functions(source):
     return source
 
 
-def compile_model(source, dtype, fast=False):
-    # type: (str, np.dtype, bool) -> SourceModule
+def compile_model(source, dtype, fast=False, mixed=False):
+    # type: (str, np.dtype, bool, bool) -> SourceModule
     """
     Build a model to run on the gpu.
 
@@ -217,7 +217,7 @@ def compile_model(source, dtype, fast=False):
     if not has_type(dtype):
         raise RuntimeError("%s not supported for devices"%dtype)
 
-    source_list = [generate.convert_type(source, dtype)]
+    source_list = [generate.convert_type(source, dtype, mixed=mixed)]
 
     source_list.insert(0, "#define USE_SINCOS\n")
     source = "\n".join(source_list)
@@ -277,22 +277,24 @@ class GpuEnvironment(object):
         """
         return has_type(dtype)
 
-    def compile_program(self, name, source, dtype, fast, timestamp):
-        # type: (str, str, np.dtype, bool, float) -> SourceModule
+    def compile_program(self, name, source, dtype, fast, timestamp,
+                        mixed=False):
+        # type: (str, str, np.dtype, bool, float, bool) -> SourceModule
         """
         Compile the program for the device in the given context.
         """
         # Note: PyCuda (probably) caches but I'll do so as well just to
         # save some data munging time.
         tag = generate.tag_source(source)
-        key = "%s-%s-%s%s"%(name, dtype, tag, ("-fast" if fast else ""))
+        key = "%s-%s-%s%s%s"%(name, dtype, tag, ("-fast" if fast else ""),
+                              ("-mixed" if mixed else ""))
         # Check timestamp on program.
         program, program_timestamp = self.compiled.get(key, (None, np.inf))
         if program_timestamp < timestamp:
             del self.compiled[key]
         if key not in self.compiled:
             logging.info("building %s for CUDA", key)
-            program = compile_model(str(source), dtype, fast)
+            program = compile_model(str(source), dtype, fast, mixed)
             self.compiled[key] = (program, timestamp)
         return program
 
@@ -310,29 +312,34 @@ class GpuModel(KernelModel):
     is an optional extension which may not be available on all devices.
     Half precision ('float16','half') may be available on some devices.
     Fast precision ('fast') is a loose version of single precision, indicating
-    that the compiler is allowed to take shortcuts.
+    that the compiler is allowed to take shortcuts.  Mixed precision
+    (*mixed=True*) is single precision with the sums accumulated and
+    returned in double precision.
     """
     info = None  # type: ModelInfo
     source = ""  # type: str
     dtype = None  # type: np.dtype
     fast = False  # type: bool
+    mixed = False  # type: bool
     _program = None  # type: SourceModule
     _kernels = None  # type: Dict[str, cuda.Function]
 
-    def __init__(self, source, model_info, dtype=generate.F32, fast=False):
-        # type: (Dict[str,str], ModelInfo, np.dtype, bool) -> None
+    def __init__(self, source, model_info, dtype=generate.F32, fast=False,
+                 mixed=False):
+        # type: (Dict[str,str], ModelInfo, np.dtype, bool, bool) -> None
         self.info = model_info
         self.source = source
         self.dtype = dtype
         self.fast = fast
+        self.mixed = mixed
 
     def __getstate__(self):
-        # type: () -> Tuple[ModelInfo, str, np.dtype, bool]
-        return self.info, self.source, self.dtype, self.fast
+        # type: () -> Tuple[ModelInfo, str, np.dtype, bool, bool]
+        return self.info, self.source, self.dtype, self.fast, self.mixed
 
     def __setstate__(self, state):
-        # type: (Tuple[ModelInfo, str, np.dtype, bool]) -> None
-        self.info, self.source, self.dtype, self.fast = state
+        # type: (Tuple[ModelInfo, str, np.dtype, bool, bool]) -> None
+        self.info, self.source, self.dtype, self.fast, self.mixed = state
         self._program = self._kernels = None
 
     def make_kernel(self, q_vectors):
@@ -358,7 +365,8 @@ class GpuModel(KernelModel):
             self.source['opencl'],
             self.dtype,
             self.fast,
-            timestamp)
+            timestamp,
+            mixed=self.mixed)
         variants = ['Iq', 'Iqxy', 'Imagnetic']
         names = [generate.kernel_name(self.info, k) for k in variants]
         functions = [program.get_function(k) for k in names]
@@ -465,11 +473,14 @@ class GpuKernel(Kernel):
 
         # Holding place for the returned value.
         nout = 2 if self.info.have_Fq and self.dim == '1d' else 1
-        extra_q = 4  # Total weight, form volume, shell volume and R_eff.
-        self.result = np.empty(self.q_input.nq*nout + extra_q, dtype)
+        # Total weight, form volume, shell volume, R_eff and the number of
+        # points evaluated, dropped by cutoff and rejected as invalid.
+        extra_q = 7
+        result_dtype = generate.F64 if model.mixed else dtype
+        self.result = np.empty(self.q_input.nq*nout + extra_q, result_dtype)
 
         # Allocate result value on GPU.
-        width = ((self.result.size+31)//32)*32 * self.dtype.itemsize
+        width = ((self.result.size+31)//32)*32 * self.result.itemsize
         self._result_b = cuda.mem_alloc(width)
 
     def _call_kernel(self, call_details, values, cutoff, magnetic,
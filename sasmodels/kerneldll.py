@@ -93,7 +93,7 @@ from .generate import F16, F32, F64
 
 # pylint: disable=unused-import
 try:
-    from typing import Tuple, Callable, Any, List
+    from typing import Tuple, Callable, Any, List, Optional
     from .modelinfo import ModelInfo
     from .details import CallDetails
 except ImportError:
@@ -179,17 +179,34 @@ elif COMPILER == "mingw":
         """mingw compiler command"""
         return CC + [source, "-o", output, "-lm"]
 
+# Compiler flag to enable OpenMP for compile_model(..., openmp=True).
+OPENMP_FLAG = {
+    "unix": "-fopenmp" if sys.platform != "darwin" else None,
+    "mingw": "-fopenmp",
+    "msvc": "/openmp",
+}.get(COMPILER, None)
+
 ALLOW_SINGLE_PRECISION_DLLS = True
 
 
-def compile_model(source, output):
-    # type: (str, str) -> None
+def compile_model(source, output, openmp=False, libs=()):
+    # type: (str, str, bool, List[str]) -> None
     """
     Compile *source* producing *output*.
 
+    If *openmp* is True, compile with OpenMP support if the compiler has it.
+    This is used by code outside the models, such as the real space engine
+    in explore/realspace.c; the models themselves are compiled without it.
+
+    *libs* are additional link options, such as "-ldl".
+
     Raises RuntimeError if the compile failed or the output wasn't produced.
     """
-    command = compile_command(source=source, output=output)
+    command = compile_command(source=source, output=output) + list(libs)
+    if openmp and OPENMP_FLAG is not None:
+        # Place the flag before the source so it precedes any linker options.
+        index = next(k for k, arg in enumerate(command) if source in arg)
+        command.insert(index, OPENMP_FLAG)
     command_str = " ".join('"%s"'%p if ' ' in p else p for p in command)
     logging.info(command_str)
     try:
@@ -203,14 +220,15 @@ def compile_model(source, output):
         raise RuntimeError("compile failed.  File is in %r"%source)
 
 
-def dll_name(model_file, dtype):
-    # type: (str, np.dtype) ->  str
+def dll_name(model_file, dtype, mixed=False):
+    # type: (str, np.dtype, bool) ->  str
     """
     Name of the dll containing the model.  This is the base file name without
-    any path or extension, with a form such as 'sas_sphere32'.
+    any path or extension, with a form such as 'sas_sphere32'.  Mixed
+    precision dlls are tagged with 'm', as in 'sas32m_sphere'.
     """
     bits = 8*dtype.itemsize
-    basename = "sas%d_%s"%(bits, model_file)
+    basename = "sas%d%s_%s"%(bits, "m" if mixed else "", model_file)
     basename += ARCH + ".so"
 
     # Hack to find precompiled dlls.
@@ -221,17 +239,17 @@ def dll_name(model_file, dtype):
     return joinpath(SAS_DLL_PATH, basename)
 
 
-def dll_path(model_file, dtype):
-    # type: (str, np.dtype) -> str
+def dll_path(model_file, dtype, mixed=False):
+    # type: (str, np.dtype, bool) -> str
     """
     Complete path to the dll for the model.  Note that the dll may not
     exist yet if it hasn't been compiled.
     """
-    return os.path.join(SAS_DLL_PATH, dll_name(model_file, dtype))
+    return os.path.join(SAS_DLL_PATH, dll_name(model_file, dtype, mixed))
 
 
-def make_dll(source, model_info, dtype=F64, system=False):
-    # type: (str, ModelInfo, np.dtype, bool) -> str
+def make_dll(source, model_info, dtype=F64, system=False, mixed=False):
+    # type: (str, ModelInfo, np.dtype, bool, bool) -> str
     """
     Returns the path to the compiled model defined by *kernel_module*.
 
@@ -252,11 +270,15 @@ def make_dll(source, model_info, dtype=F64, system=False):
 
     *system* is a bool that controls whether these are the precompiled DLLs
     that would be shipped with a binary distribution.
+
+    *mixed* is True if a single precision dll should accumulate its sums in
+    double precision.  See :func:`.generate.convert_type`.
     """
     if dtype == F16:
         raise ValueError("16 bit floats not supported")
     if dtype == F32 and not ALLOW_SINGLE_PRECISION_DLLS:
         dtype = F64  # Force 64-bit dll.
+    mixed = mixed and dtype == F32
     # Note: dtype may be F128 for long double precision.
 
     # TODO: Deal with ever-growing ~/.sasmodels/compiled_models.
@@ -267,7 +289,7 @@ def make_dll(source, model_info, dtype=F64, system=False):
     # Don't use time stamps for caching since they are not reliable, especially
     # when multiple versions of the application are installed.
     model_file = model_info.id + "_" + generate.tag_source(source)
-    dll = dll_path(model_file, dtype)
+    dll = dll_path(model_file, dtype, mixed)
     logging.debug("make_dll: dll located %s as %s in %s",
                   model_info.id, model_file, dll)
 
@@ -275,7 +297,7 @@ def make_dll(source, model_info, dtype=F64, system=False):
         # Make sure the DLL path exists. Use abspath since python docs warn
         # that makedirs is not robust against '..' in path.
         os.makedirs(os.path.abspath(SAS_DLL_PATH), exist_ok=True)
-        source = generate.convert_type(source, dtype)
+        source = generate.convert_type(source, dtype, mixed=mixed)
         if not system:
             basename = splitext(os.path.basename(dll))[0] + "_"
             system_fd, filename = tempfile.mkstemp(suffix=".c", prefix=basename)
@@ -298,8 +320,68 @@ def make_dll(source, model_info, dtype=F64, system=False):
     return dll
 
 
-def load_dll(source, model_info, dtype=F64):
-    # type: (str, ModelInfo, np.dtype) -> "DllModel"
+def make_libsasmodels(output=None):
+    # type: (str) -> str
+    """
+    Compile the standalone C interface in *sasmodels/libsasmodels.c*,
+    returning the path to the library.
+
+    The library loads the double precision model dlls produced by
+    :func:`make_dll` and evaluates them without python.  The default
+    *output* is in *SAS_DLL_PATH*, tagged with a hash of the source.
+    """
+    source = joinpath(os.path.dirname(__file__), "libsasmodels.c")
+    if output is None:
+        text = []
+        for filename in (source, splitext(source)[0] + ".h"):
+            with open(filename) as fid:
+                text.append(fid.read())
+        tag = generate.tag_source("".join(text))
+        ext = ".dll" if os.name == "nt" else ".so"
+        output = joinpath(SAS_DLL_PATH, "libsasmodels_" + tag + ext)
+    if not os.path.exists(output):
+        os.makedirs(os.path.abspath(os.path.dirname(output)), exist_ok=True)
+        libs = ["-ldl"] if COMPILER == "unix" and sys.platform != "darwin" else []
+        compile_model(source=source, output=output, libs=libs)
+    return output
+
+
+#: Library sources from *sasmodels/models/lib* needed by *sasmodels/special.c*.
+SPECIAL_SOURCES = ("lib/polevl.c", "lib/sas_3j1x_x.c", "lib/sas_J1.c")
+
+def make_special_dll(output=None):
+    # type: (str) -> str
+    """
+    Compile the array versions of the special functions in
+    *sasmodels/special.c*, returning the path to the library.
+
+    The functions come from the C sources in *sasmodels/models/lib*, so the
+    compiled versions used by :mod:`.special` give the same values as the C
+    models.  The default *output* is in *SAS_DLL_PATH*, tagged with a hash
+    of the source.
+    """
+    source = [generate.load_template('kernel_header.c')[0]]
+    for filename in SPECIAL_SOURCES:
+        with open(joinpath(generate.MODEL_PATH, filename)) as fid:
+            source.append(fid.read())
+    source.append(generate.load_template('special.c')[0])
+    source = generate.convert_type("\n".join(source), F64)
+    if output is None:
+        tag = generate.tag_source(source)
+        output = joinpath(SAS_DLL_PATH, "sas_special_" + tag + ARCH + ".so")
+    if not os.path.exists(output):
+        os.makedirs(os.path.abspath(os.path.dirname(output)), exist_ok=True)
+        system_fd, filename = tempfile.mkstemp(suffix=".c",
+                                               prefix="sas_special_")
+        with os.fdopen(system_fd, "w") as file_handle:
+            file_handle.write(source)
+        compile_model(source=filename, output=output)
+        os.unlink(filename)
+    return output
+
+
+def load_dll(source, model_info, dtype=F64, mixed=False):
+    # type: (str, ModelInfo, np.dtype, bool) -> "DllModel"
     """
     Create and load a dll corresponding to the source.
 
@@ -312,8 +394,23 @@ def load_dll(source, model_info, dtype=F64):
     See :func:`make_dll` for details on controlling the dll path and the
     allowed floating point precision.
     """
-    filename = make_dll(source, model_info, dtype=dtype)
-    return DllModel(filename, model_info, dtype=dtype)
+    mixed = mixed and dtype == F32
+    filename = make_dll(source, model_info, dtype=dtype, mixed=mixed)
+    return DllModel(filename, model_info, dtype=dtype, mixed=mixed)
+
+
+def load_product_dll(source, model_info):
+    # type: (str, ModelInfo) -> "DllProductModel"
+    """
+    Create and load the double precision dll for a product model.
+
+    *source* is returned from :func:`.generate.make_product_source`, as
+    *make_product_source(model_info)['dll']*.  The resulting model evaluates
+    the form factor of the product, computing S(q) and I(q) in the same
+    call when requested by :class:`.product.ProductKernel`.
+    """
+    filename = make_dll(source, model_info, dtype=F64)
+    return DllProductModel(filename, model_info)
 
 
 class DllModel(KernelModel):
@@ -330,15 +427,19 @@ class DllModel(KernelModel):
     for single and 'd', 'float64' or 'double' for double.  Double precision
     is an optional extension which may not be available on all devices.
 
+    *mixed* is True if the dll was built in mixed precision, in which case
+    the results are returned in double precision.
+
     Call :meth:`release` when done with the kernel.
     """
-    def __init__(self, dllpath, model_info, dtype=generate.F32):
-        # type: (str, ModelInfo, np.dtype) -> None
+    def __init__(self, dllpath, model_info, dtype=generate.F32, mixed=False):
+        # type: (str, ModelInfo, np.dtype, bool) -> None
         self.info = model_info
         self.dllpath = dllpath
         self._dll = None  # type: ct.CDLL
         self._kernels = None  # type: List[Callable, Callable]
         self.dtype = np.dtype(dtype)
+        self.mixed = mixed
 
     def _load_dll(self):
         # type: () -> None
@@ -361,12 +462,12 @@ class DllModel(KernelModel):
             k.argtypes = argtypes
 
     def __getstate__(self):
-        # type: () -> Tuple[ModelInfo, str]
-        return self.info, self.dllpath
+        # type: () -> Tuple[ModelInfo, str, np.dtype, bool]
+        return self.info, self.dllpath, self.dtype, self.mixed
 
     def __setstate__(self, state):
-        # type: (Tuple[ModelInfo, str]) -> None
-        self.info, self.dllpath = state
+        # type: (Tuple[ModelInfo, str, np.dtype, bool]) -> None
+        self.info, self.dllpath, self.dtype, self.mixed = state
         self._dll = None
 
     def make_kernel(self, q_vectors):
@@ -377,7 +478,7 @@ class DllModel(KernelModel):
             self._load_dll()
         is_2d = len(q_vectors) == 2
         kernel = self._kernels[1:3] if is_2d else [self._kernels[0]]*2
-        return DllKernel(kernel, self.info, q_input)
+        return DllKernel(kernel, self.info, q_input, mixed=self.mixed)
 
     def release(self):
         # type: () -> None
@@ -404,6 +505,9 @@ class DllKernel(Kernel):
     *q_input* is the DllInput q vectors at which the kernel should be
     evaluated.
 
+    *mixed* is True if the kernel accumulates its results in double
+    precision.
+
     The resulting call method takes the *pars*, a list of values for
     the fixed parameters to the kernel, and *pd_pars*, a list of (value, weight)
     vectors for the polydisperse parameters.  *cutoff* determines the
@@ -412,8 +516,8 @@ class DllKernel(Kernel):
 
     Call :meth:`release` when done with the kernel instance.
     """
-    def __init__(self, kernel, model_info, q_input):
-        # type: (Callable[[], np.ndarray], ModelInfo, PyInput) -> None
+    def __init__(self, kernel, model_info, q_input, mixed=False):
+        # type: (Callable[[], np.ndarray], ModelInfo, PyInput, bool) -> None
         dtype = q_input.dtype
         self.q_input = q_input
         self.kernel = kernel
@@ -430,8 +534,11 @@ class DllKernel(Kernel):
 
         # Holding place for the returned value.
         nout = 2 if self.info.have_Fq else 1
-        extra_q = 4  # Total weight, form volume, shell volume and R_eff.
-        self.result = np.empty(self.q_input.nq*nout + extra_q, dtype)
+        # Total weight, form volume, shell volume, R_eff and the number of
+        # points evaluated, dropped by cutoff and rejected as invalid.
+        extra_q = 7
+        result_dtype = generate.F64 if mixed else dtype
+        self.result = np.empty(self.q_input.nq*nout + extra_q, result_dtype)
 
     def _call_kernel(self, call_details, values, cutoff, magnetic,
                      radius_effective_mode):
@@ -454,10 +561,18 @@ class DllKernel(Kernel):
         # Call kernel and retrieve results.
         #print("Calling DLL")
         #call_details.show(values)
+        self._run(kernel, kernel_args, call_details.num_eval)
+
+    def _run(self, kernel, kernel_args, num_eval):
+        # type: (Callable, List[Any], int) -> None
+        """
+        Call *kernel* in steps over the *num_eval* points in the dispersity
+        mesh, filling in pd_start and pd_stop in *kernel_args*.
+        """
         step = 100
         # TODO: Do we need the explicit sleep like the OpenCL and CUDA loops?
-        for start in range(0, call_details.num_eval, step):
-            stop = min(start + step, call_details.num_eval)
+        for start in range(0, num_eval, step):
+            stop = min(start + step, num_eval)
             kernel_args[1:3] = [start, stop]
             kernel(*kernel_args) # type: ignore
 
@@ -474,3 +589,155 @@ class DllKernel(Kernel):
     def __del__(self):
         # type: () -> None
         self.release()
+
+
+class DllProductModel(DllModel):
+    """
+    ctypes wrapper for the form factor of a product model, with the fused
+    P@S kernel generated by :func:`.generate.make_product_source`.
+
+    *dllpath* is the stored path to the dll.
+
+    *model_info* is the product model definition.  The resulting model
+    behaves as the form factor model, *model_info.composition[1][0]*.
+    """
+    def __init__(self, dllpath, model_info):
+        # type: (str, ModelInfo) -> None
+        DllModel.__init__(self, dllpath, model_info.composition[1][0],
+                          dtype=F64)
+        self.product_info = model_info
+        self._fused = None  # type: Callable
+
+    def _load_dll(self):
+        # type: () -> None
+        DllModel._load_dll(self)
+        self._fused = self._dll[generate.product_kernel_name(self.product_info)]
+        self._fused.argtypes = list(self._kernels[0].argtypes) + [ct.c_void_p]
+
+    def __getstate__(self):
+        # type: () -> Tuple[ModelInfo, str]
+        return self.product_info, self.dllpath
+
+    def __setstate__(self, state):
+        # type: (Tuple[ModelInfo, str]) -> None
+        self.__init__(*state)
+
+    def make_kernel(self, q_vectors):
+        # type: (List[np.ndarray]) -> DllProductKernel
+        q_input = PyInput(q_vectors, self.dtype)
+        if self._dll is None:
+            self._load_dll()
+        is_2d = len(q_vectors) == 2
+        kernel = self._kernels[1:3] if is_2d else [self._kernels[0]]*2
+        return DllProductKernel(kernel, self._fused, self.info, q_input)
+
+
+class DllProductKernel(DllKernel):
+    """
+    Form factor kernel which can compute the P@S product in the same call.
+
+    Set *product* to the vector of scale, background, volfraction, beta
+    mode, radius_effective and the remaining structure factor parameters
+    and clear *product_result* before calling :meth:`Fq` on 1D data.  If
+    the dispersity mesh is evaluated then *product_result* is set to S(q)
+    and I(q), otherwise it is left as None (for example, when the closed
+    form from :mod:`.analytic` is used instead).
+    """
+    #: P@S parameters for the next call, or None for the form factor only.
+    product = None  # type: Optional[np.ndarray]
+    #: S(q) and I(q) from the last call, or None if they were not computed.
+    product_result = None  # type: Optional[Tuple[np.ndarray, np.ndarray]]
+
+    def __init__(self, kernel, fused, model_info, q_input):
+        # type: (List[Callable], Callable, ModelInfo, PyInput) -> None
+        DllKernel.__init__(self, kernel, model_info, q_input)
+        self.fused = fused
+        # Room for S(q) and I(q) after the form factor results.
+        nq = q_input.nq
+        self.result = np.empty(len(self.result) + 2*nq, self.result.dtype)
+
+    def _run(self, kernel, kernel_args, num_eval):
+        # type: (Callable, List[Any], int) -> None
+        if self.product is None or self.dim != '1d':
+            DllKernel._run(self, kernel, kernel_args, num_eval)
+            return
+        product = np.ascontiguousarray(self.product, F64)
+        DllKernel._run(self, self.fused, kernel_args + [product.ctypes.data],
+                       num_eval)
+        nq = self.q_input.nq
+        start = (2 if self.info.have_Fq else 1)*nq + 7
+        self.product_result = (self.result[start:start + nq].copy(),
+                               self.result[start + nq:start + 2*nq].copy())
+
+
+def test_libsasmodels():
+    # type: () -> None
+    """
+    Check that libsasmodels.c matches the python interface.
+    """
+    from .core import load_model_info
+    from .data import empty_data1D
+    from .direct_model import DirectModel, call_kernel
+
+    lib = ct.CDLL(make_libsasmodels())
+    lib.sas_model_load.restype = ct.c_void_p
+    lib.sas_model_load.argtypes = [ct.c_char_p, ct.c_char_p, ct.c_int]
+    lib.sas_model_free.argtypes = [ct.c_void_p]
+    lib.sas_calculator_new.restype = ct.c_void_p
+    lib.sas_calculator_new.argtypes = [ct.c_void_p, ct.c_int, ct.c_void_p, ct.c_void_p]
+    lib.sas_calculator_new_2d.restype = ct.c_void_p
+    lib.sas_calculator_new_2d.argtypes = [ct.c_void_p, ct.c_int, ct.c_void_p, ct.c_void_p]
+    lib.sas_calculator_free.argtypes = [ct.c_void_p]
+    lib.sas_set.argtypes = [ct.c_void_p, ct.c_char_p, ct.c_double]
+    lib.sas_set_dispersity.argtypes = [
+        ct.c_void_p, ct.c_char_p, ct.c_int, ct.c_double, ct.c_int, ct.c_double]
+    lib.sas_calculate.argtypes = [ct.c_void_p, ct.c_void_p]
+
+    def load(name):
+        info = load_model_info(name)
+        path = make_dll(generate.make_source(info)['dll'], info)
+        error = ct.create_string_buffer(256)
+        model = lib.sas_model_load(path.encode('utf8'), error, len(error))
+        assert model, error.value
+        return info, path, model
+
+    def evaluate(calc, pars, n):
+        for name, value in pars.items():
+            if name.endswith('_pd'):
+                code = lib.sas_set_dispersity(
+                    calc, name[:-3].encode('utf8'), 1, value,
+                    pars.get(name+'_n', 35), pars.get(name+'_nsigma', 3.))
+            elif not name.endswith(('_pd_n', '_pd_nsigma')):
+                code = lib.sas_set(calc, name.encode('utf8'), value)
+            assert code == 0, name
+        Iq = np.empty(n)
+        assert lib.sas_calculate(calc, Iq.ctypes.data) == 0
+        return Iq
+
+    # 1D with pinhole resolution and size dispersity.
+    info, path, model = load("sphere")
+    q = np.logspace(-3, -1, 50)
+    data = empty_data1D(q, resolution=0.1)
+    pars = dict(radius=200., radius_pd=0.1, radius_pd_n=15, background=0.01)
+    target = DirectModel(data, DllModel(path, info, dtype=F64))(**pars)
+    calc = lib.sas_calculator_new(model, len(q), q.ctypes.data,
+                                  data.dx.ctypes.data)
+    actual = evaluate(calc, pars, len(q))
+    lib.sas_calculator_free(calc)
+    lib.sas_model_free(model)
+    assert np.allclose(actual, target, rtol=1e-10, atol=0), (actual, target)
+
+    # 2D with orientation dispersity.
+    info, path, model = load("cylinder")
+    qx, qy = np.meshgrid(np.linspace(-0.2, 0.2, 7), np.linspace(-0.2, 0.2, 5))
+    qx, qy = qx.flatten(), qy.flatten()
+    pars = dict(theta=20., theta_pd=10., theta_pd_n=7, radius_pd=0.1,
+                radius_pd_n=5, phi=40., length=100.)
+    kernel = DllModel(path, info, dtype=F64).make_kernel([qx, qy])
+    target = call_kernel(kernel, pars)
+    calc = lib.sas_calculator_new_2d(model, len(qx), qx.ctypes.data,
+                                     qy.ctypes.data)
+    actual = evaluate(calc, pars, len(qx))
+    lib.sas_calculator_free(calc)
+    lib.sas_model_free(model)
+    assert np.allclose(actual, target, rtol=1e-10, atol=0), (actual, target)
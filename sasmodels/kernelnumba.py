@@ -0,0 +1,490 @@
+"""
+Numba driver for python kernels
+
+Pure python models which define their *Iq*, *Iqxy*, *form_volume*,
+*shell_volume* and *radius_effective* functions using numpy operations
+can be compiled with `numba <https://numba.pydata.org>`_.  The model
+functions are compiled in nopython mode, and a loop over the points in
+the dispersity mesh is generated for each model and compiled with
+*parallel=True*, so that different dispersity points are evaluated on
+different cores.  The mesh itself is built and pruned using the vectorized
+dispersity loop from :mod:`.kernelpy`.
+
+Compiled code is cached on disk in *SAS_NUMBA_PATH*, which defaults to
+*~/.sasmodels/numba_models*.  The generated loops are saved there with a
+file name that includes a hash of the model source so that a modified model
+is recompiled, and the compiled model functions are cached alongside them
+rather than next to the model file.
+
+The parallel loops use the numba threading layer selected by the user.
+Programs which fork worker processes after evaluating a numba model, such
+as the parallel fitters and the batch and shared memory services, may hang
+on exit with the TBB layer.  Set *NUMBA_THREADING_LAYER=workqueue* to use
+the fork-safe layer in that case.
+
+Models using functions that numba does not support, such as those from
+scipy.special, fail to compile.  In that case :meth:`NumbaModel.make_kernel`
+logs the problem and returns a :class:`.kernelpy.PyKernel` instead.
+
+Use *platform="numba"* with :func:`.core.build_model` to select this
+backend for python models, or set the environment variable *SAS_NUMBA=1*
+to make it the default.  C models are unaffected.
+"""
+from __future__ import division, print_function
+
+import os
+import sys
+import hashlib
+import logging
+import importlib.util
+from types import FunctionType
+
+import numpy as np  # type: ignore
+
+from .generate import F64
+from .kernelpy import PyModel, PyInput, PyKernel
+
+try:
+    import numba
+    from numba.core.caching import (
+        FunctionCache, CompileResultCacheImpl, _CacheLocator,
+        _SourceFileBackedLocatorMixin)
+    HAVE_NUMBA = True
+except ImportError:
+    HAVE_NUMBA = False
+
+# pylint: disable=unused-import
+try:
+    from typing import Any, Callable, Dict, List, Optional, Tuple
+    from types import ModuleType
+    from .modelinfo import ModelInfo
+except ImportError:
+    pass
+# pylint: enable=unused-import
+
+logger = logging.getLogger(__name__)
+
+if "SAS_NUMBA_PATH" in os.environ:
+    SAS_NUMBA_PATH = os.environ["SAS_NUMBA_PATH"]
+else:
+    SAS_NUMBA_PATH = os.path.join(
+        os.path.expanduser("~"), ".sasmodels", "numba_models")
+
+
+def use_numba():
+    # type: () -> bool
+    """Return True if numba is the default engine for python models."""
+    return HAVE_NUMBA and os.environ.get("SAS_NUMBA", "0") not in ("", "0")
+
+
+class NumbaModel(PyModel):
+    """
+    Wrapper for pure python models compiled with numba.
+
+    The interface matches :class:`.kernelpy.PyModel`.  The compiled module
+    is built when the first kernel is created.  If compilation fails, the
+    model uses :class:`.kernelpy.PyKernel` for all kernels.
+    """
+    def __init__(self, model_info):
+        # type: (ModelInfo) -> None
+        PyModel.__init__(self, model_info)
+        self._module = None  # type: Optional[ModuleType]
+        self._failed = not HAVE_NUMBA
+
+    def make_kernel(self, q_vectors):
+        """Instantiate the numba kernel with input *q_vectors*"""
+        q_input = PyInput(q_vectors, dtype=F64)
+        if not self._failed:
+            try:
+                if self._module is None:
+                    self._module = load_module(self.info)
+                return NumbaKernel(self.info, q_input, self._module)
+            except Exception as exc:
+                logger.info("numba compilation failed for %s: %s",
+                            self.info.name, exc)
+                self._failed = True
+        return PyKernel(self.info, q_input)
+
+
+class NumbaKernel(PyKernel):
+    """
+    Callable SAS kernel using compiled numba functions.
+
+    *module* is the compiled module returned from :func:`load_module`.
+    The functions are compiled for these *q* inputs when the kernel is
+    created, which raises an exception if the model is not supported.
+    """
+    # Even a single point is faster when compiled.
+    mesh_min_active = 0
+    # Compiled code doesn't change between calls, so check it only once.
+    mesh_check_always = False
+
+    def __init__(self, model_info, q_input, module):
+        # type: (ModelInfo, PyInput, ModuleType) -> None
+        PyKernel.__init__(self, model_info, q_input)
+        self._mesh = _NumbaMesh(module, q_input)
+        # Compile now so that failures are reported by make_kernel.
+        pars = np.array([p.default for p in
+                         model_info.parameters.kernel_parameters], 'd')
+        pars = pars[:, None]
+        self._mesh.form(pars)
+        self._mesh.volume(pars)
+        self._mesh.radius(1, pars)
+
+
+class _NumbaMesh(object):
+    """
+    Mesh evaluator with the interface of :class:`.kernelpy._MeshForm`,
+    calling the generated numba loops.
+    """
+    def __init__(self, module, q_input):
+        # type: (ModuleType, PyInput) -> None
+        self._module = module
+        if q_input.is_2d:
+            qx = np.ascontiguousarray(q_input.q[:, 0])
+            qy = np.ascontiguousarray(q_input.q[:, 1])
+            self._form = lambda pars: module.form_2d(qx, qy, pars)
+        else:
+            q = np.ascontiguousarray(q_input.q)
+            self._form = lambda pars: module.form_1d(q, pars)
+
+    def form(self, pars):
+        # type: (np.ndarray) -> np.ndarray
+        """Return I(q) with one row for each column of *pars*."""
+        return self._form(np.ascontiguousarray(pars))
+
+    def volume(self, pars):
+        # type: (np.ndarray) -> Tuple[np.ndarray, np.ndarray]
+        """Return shell and form volume for each column of *pars*."""
+        return self._module.volume(np.ascontiguousarray(pars))
+
+    def radius(self, mode, pars):
+        # type: (int, np.ndarray) -> np.ndarray
+        """Return effective radius for each column of *pars*."""
+        return self._module.radius(mode, np.ascontiguousarray(pars))
+
+
+def _offsets(model_info):
+    # type: (ModelInfo) -> Tuple[List[int], List[int]]
+    """
+    Return the offsets of the kernel and volume parameters in the parameter
+    vector.  Raises ValueError for models with vector parameters.
+    """
+    partable = model_info.parameters
+    kernel_index, volume_index = [], []
+    offset = 0
+    for p in partable.kernel_parameters:
+        if p.length != 1:
+            raise ValueError("vector parameter %s not supported" % p.name)
+        if p in partable.iq_parameters:
+            kernel_index.append(offset)
+        if p in partable.form_volume_parameters:
+            volume_index.append(offset)
+        offset += 1
+    return kernel_index, volume_index
+
+
+def _unwrap(fn):
+    # type: (Callable) -> Tuple[Callable, bool]
+    """
+    Return the model function and whether it is vectorized, undoing the
+    wrappers added by :mod:`.kernelpy`.
+    """
+    wrapped = getattr(fn, '__wrapped__', None)
+    if wrapped is not None:
+        return wrapped, False
+    return fn, True
+
+
+def generate_source(model_info):
+    # type: (ModelInfo) -> str
+    """
+    Generate the numba source for the dispersity loops of the model.
+
+    The generated module expects the compiled model functions *Iq*, *Iqxy*,
+    *form_volume*, *shell_volume* and *radius_effective* to be defined in
+    its namespace before it is executed.
+    """
+    kernel_index, volume_index = _offsets(model_info)
+    args = ", ".join("P[%d, i]" % k for k in kernel_index)
+    vargs = ", ".join("P[%d, i]" % k for k in volume_index)
+    _, Iq_vector = _unwrap(model_info.Iq)
+    Iqxy = model_info.Iqxy
+    from_Iq = getattr(Iqxy, 'from_Iq', False)
+    _, Iqxy_vector = _unwrap(Iqxy) if not from_Iq else (None, Iq_vector)
+
+    if Iq_vector:
+        Iq_row = "result[i, :] = Iq(q, %s)" % args
+    else:
+        Iq_row = ("for j in range(q.shape[0]):\n"
+                  "            result[i, j] = Iq(q[j], %s)" % args)
+    if from_Iq:
+        Iqxy_prefix = "q = np.sqrt(qx*qx + qy*qy)"
+        Iqxy_row = Iq_row
+    else:
+        Iqxy_prefix = "pass"
+        if Iqxy_vector:
+            Iqxy_row = "result[i, :] = Iqxy(qx, qy, %s)" % args
+        else:
+            Iqxy_row = ("for j in range(qx.shape[0]):\n"
+                        "            result[i, j] = Iqxy(qx[j], qy[j], %s)" % args)
+
+    if model_info.form_volume is not None:
+        form_row = "form[i] = form_volume(%s)" % vargs
+    else:
+        form_row = "form[i] = 1.0"
+    if model_info.shell_volume is not None and model_info.form_volume is not None:
+        shell_row = "shell[i] = shell_volume(%s)" % vargs
+    else:
+        shell_row = "shell[i] = form[i]"
+    if model_info.radius_effective is not None:
+        radius_row = "radius[i] = radius_effective(mode, %s)" % vargs
+    elif model_info.form_volume is not None:
+        radius_row = "radius[i] = np.cbrt(0.75/np.pi*form_volume(%s))" % vargs
+    else:
+        radius_row = "radius[i] = 1.0"
+
+    return _TEMPLATE.format(
+        name=model_info.id, Iq_row=Iq_row, Iqxy_prefix=Iqxy_prefix,
+        Iqxy_row=Iqxy_row, form_row=form_row, shell_row=shell_row,
+        radius_row=radius_row)
+
+_TEMPLATE = '''\
+# Dispersity loops for the {name} model.
+# Generated by sasmodels.kernelnumba; do not edit.
+import numpy as np
+from numba import njit, prange
+
+@njit(parallel=True, cache=True)
+def form_1d(q, P):
+    n = P.shape[1]
+    result = np.empty((n, q.shape[0]))
+    for i in prange(n):
+        {Iq_row}
+    return result
+
+@njit(parallel=True, cache=True)
+def form_2d(qx, qy, P):
+    {Iqxy_prefix}
+    n = P.shape[1]
+    result = np.empty((n, qx.shape[0]))
+    for i in prange(n):
+        {Iqxy_row}
+    return result
+
+@njit(cache=True)
+def volume(P):
+    n = P.shape[1]
+    shell = np.empty(n)
+    form = np.empty(n)
+    for i in range(n):
+        {form_row}
+        {shell_row}
+    return shell, form
+
+@njit(cache=True)
+def radius(mode, P):
+    n = P.shape[1]
+    radius = np.zeros(n)
+    if mode == 0:
+        return radius
+    for i in range(n):
+        {radius_row}
+    return radius
+'''
+
+
+if HAVE_NUMBA:
+    class _ModelCacheLocator(_SourceFileBackedLocatorMixin, _CacheLocator):
+        """
+        Cache locator for model functions, using a subdirectory of
+        *SAS_NUMBA_PATH* for each model directory.
+        """
+        def __init__(self, py_func, py_file):
+            self._py_file = py_file
+            self._lineno = py_func.__code__.co_firstlineno
+            self._cache_path = os.path.join(
+                SAS_NUMBA_PATH, self.get_suitable_cache_subpath(py_file))
+
+        def get_cache_path(self):
+            return self._cache_path
+
+    class _ModelCacheImpl(CompileResultCacheImpl):
+        _locator_classes = [_ModelCacheLocator]
+
+    class _ModelCache(FunctionCache):
+        _impl_class = _ModelCacheImpl
+
+
+def _njit(fn):
+    # type: (Callable) -> Callable
+    """
+    Compile *fn* in nopython mode, caching to *SAS_NUMBA_PATH* if possible.
+    """
+    compiled = numba.njit(fn)
+    try:
+        compiled._cache = _ModelCache(fn)
+    except RuntimeError:
+        # No cache locator, e.g., for interactive functions.
+        pass
+    return compiled
+
+
+def _jit(fn, namespaces):
+    # type: (Optional[Callable], Dict[int, Dict[str, Any]]) -> Optional[Callable]
+    """
+    Compile *fn* in nopython mode, caching to disk if possible.
+
+    Numba resolves the functions called by *fn* from its globals, so each
+    python function in the defining module is compiled as well, using a
+    copy of the module namespace which refers to the compiled versions.
+    *namespaces* holds the compiled namespace for each module seen so far.
+    Functions which are not defined at module level, such as closures, are
+    compiled separately against the same namespace.
+    """
+    if fn is None:
+        return None
+    fn, _ = _unwrap(fn)
+    key = id(fn.__globals__)
+    if key not in namespaces:
+        namespace = dict(fn.__globals__)
+        for name, value in fn.__globals__.items():
+            if (isinstance(value, FunctionType)
+                    and value.__globals__ is fn.__globals__):
+                namespace[name] = _njit(_rebind(value, namespace))
+        namespaces[key] = namespace
+    namespace = namespaces[key]
+    compiled = namespace.get(fn.__name__, None)
+    if (not isinstance(compiled, numba.core.dispatcher.Dispatcher)
+            or compiled.py_func.__code__ is not fn.__code__):
+        compiled = _njit(_rebind(fn, namespace))
+    return compiled
+
+
+def _rebind(fn, namespace):
+    # type: (FunctionType, Dict[str, Any]) -> FunctionType
+    """Return a copy of *fn* which uses *namespace* for its globals."""
+    return FunctionType(fn.__code__, namespace, fn.__name__,
+                        fn.__defaults__, fn.__closure__)
+
+
+def load_module(model_info):
+    # type: (ModelInfo) -> ModuleType
+    """
+    Return the compiled numba module for *model_info*.
+
+    The generated loop source is written to *SAS_NUMBA_PATH*, named with
+    a hash of the model file and the generated source.
+    """
+    source = generate_source(model_info)
+    digest = hashlib.sha1(source.encode('utf8'))
+    digest.update(numba.__version__.encode('utf8'))
+    try:
+        with open(model_info.filename, 'rb') as fid:
+            digest.update(fid.read())
+    except (TypeError, IOError):
+        pass
+    name = "sasmodels_numba_%s_%s" % (model_info.id, digest.hexdigest()[:12])
+    path = os.path.join(SAS_NUMBA_PATH, name + ".py")
+    if not os.path.exists(path):
+        os.makedirs(SAS_NUMBA_PATH, exist_ok=True)
+        with open(path, 'w') as fid:
+            fid.write(source)
+
+    module = sys.modules.get(name, None)
+    if module is not None:
+        return module
+    spec = importlib.util.spec_from_file_location(name, path)
+    module = importlib.util.module_from_spec(spec)
+    Iqxy = model_info.Iqxy
+    namespaces = {}  # type: Dict[int, Dict[str, Any]]
+    module.Iq = _jit(model_info.Iq, namespaces)
+    module.Iqxy = (None if getattr(Iqxy, 'from_Iq', False)
+                   else _jit(Iqxy, namespaces))
+    module.form_volume = _jit(model_info.form_volume, namespaces)
+    module.shell_volume = _jit(model_info.shell_volume, namespaces)
+    module.radius_effective = _jit(model_info.radius_effective, namespaces)
+    # Numba needs to import the module by name when loading from the cache.
+    sys.modules[name] = module
+    try:
+        spec.loader.exec_module(module)
+    except Exception:
+        del sys.modules[name]
+        raise
+    return module
+
+
+def test_numba_model():
+    # type: () -> None
+    """Check that the numba kernel matches the python kernel"""
+    import tempfile
+    import fractions
+    from types import ModuleType
+    from .core import load_model_info
+    from .direct_model import call_kernel
+    from .modelinfo import make_model_info
+
+    global SAS_NUMBA_PATH
+    if not HAVE_NUMBA:
+        return
+    saved_path = SAS_NUMBA_PATH
+    SAS_NUMBA_PATH = tempfile.mkdtemp()
+    try:
+        model_info = load_model_info('_spherepy')
+        numba_model, py_model = NumbaModel(model_info), PyModel(model_info)
+        pars = dict(radius=50, radius_pd=0.2, radius_pd_n=35)
+        for q in ([np.logspace(-3, -1, 30)],
+                  [np.linspace(-0.1, 0.1, 20), np.linspace(0.1, -0.1, 20)]):
+            kernel = numba_model.make_kernel(q)
+            assert isinstance(kernel, NumbaKernel)
+            target = py_model.make_kernel(q)
+            for p in (pars, dict(radius=50)):
+                assert np.allclose(call_kernel(kernel, p),
+                                   call_kernel(target, p),
+                                   rtol=1e-12, atol=0)
+        assert any(f.endswith('.py') for f in os.listdir(SAS_NUMBA_PATH))
+        # Compiled model functions are cached with the loops, not the models.
+        cache = [f for _, _, files in os.walk(SAS_NUMBA_PATH) for f in files]
+        assert any(f.startswith('_spherepy.') for f in cache)
+        pycache = os.path.join(os.path.dirname(model_info.filename),
+                               '__pycache__')
+        assert not (os.path.isdir(pycache) and any(
+            f.endswith('.nbi') for f in os.listdir(pycache)))
+
+        # Model functions need not be defined at module level.
+        module = ModuleType('closure')
+        module.name = 'closure'
+        module.__file__ = 'closure.py'
+        module.parameters = [["radius", "Ang", 50, [0, np.inf], "volume", ""]]
+        scale = 2.0
+        def Iq(q, radius):
+            return scale*np.sin(q*radius)
+        Iq.vectorized = True
+        module.Iq = Iq
+        q = [np.logspace(-3, -1, 30)]
+        model_info = make_model_info(module)
+        kernel = NumbaModel(model_info).make_kernel(q)
+        assert isinstance(kernel, NumbaKernel)
+        assert np.allclose(call_kernel(kernel, {}),
+                           call_kernel(PyModel(model_info).make_kernel(q), {}),
+                           rtol=1e-12, atol=0)
+
+        # Functions that numba cannot type fall back to the python kernel.
+        def Iq(q, radius):
+            return np.full_like(q, float(fractions.Fraction(1, 3))*radius)
+        Iq.vectorized = True
+        module.name = module.__name__ = module.__file__ = 'unsupported'
+        module.Iq = Iq
+        model_info = make_model_info(module)
+        try:
+            NumbaKernel(model_info, PyInput(q, dtype=F64),
+                        load_module(model_info))
+        except numba.core.errors.TypingError:
+            pass
+        else:
+            raise AssertionError("expected a numba typing error")
+        kernel = NumbaModel(model_info).make_kernel(q)
+        assert type(kernel) is PyKernel
+        assert np.allclose(call_kernel(kernel, {}), 50/3 + 1e-3)
+    finally:
+        SAS_NUMBA_PATH = saved_path
@@ -24,7 +24,7 @@ from .kernel import KernelModel, Kernel
 
 # pylint: disable=unused-import
 try:
-    from typing import Union, Callable, List
+    from typing import Union, Callable, List, Optional, Tuple
     from .details import CallDetails
     from .modelinfo import ModelInfo
 except ImportError:
@@ -33,6 +33,11 @@ except ImportError:
 
 logger = logging.getLogger(__name__)
 
+#: Maximum number of q values times dispersity points to evaluate in one
+#: vectorized call to the model.  This bounds the size of the temporary
+#: arrays, with 2^20 points using 8 MB for each array in the model.
+MAX_MESH_SIZE = 2**20
+
 
 class PyModel(KernelModel):
     """
@@ -114,6 +119,14 @@ class PyKernel(Kernel):
 
     Call :meth:`release` when done with the kernel instance.
     """
+    #: Use the vectorized mesh when there are at least this many dispersity
+    #: loops.  Without dispersity the mesh is a single point, and there is
+    #: no benefit over calling the model directly.
+    mesh_min_active = 1
+    #: Check the mesh against the scalar model on every call rather than
+    #: just the first.
+    mesh_check_always = True
+
     def __init__(self, model_info, q_input):
         # type: (ModelInfo, List[np.ndarray]) -> None
         self.dtype = np.dtype('d')
@@ -138,6 +151,7 @@ class PyKernel(Kernel):
         # Create views into the array to hold the arguments.
         offset = 0
         kernel_args, volume_args = [], []
+        kernel_index, volume_index = [], []
         for p in partable.kernel_parameters:
             if p.length == 1:
                 # Scalar values are length 1 vectors with no dimensions.
@@ -145,11 +159,13 @@ class PyKernel(Kernel):
             else:
                 # Vector values are simple views.
                 v = parameter_vector[offset:offset+p.length]
-            offset += p.length
             if p in kernel_parameters:
                 kernel_args.append(v)
+                kernel_index.append(offset)
             if p in volume_parameters:
                 volume_args.append(v)
+                volume_index.append(offset)
+            offset += p.length
 
         # Hold on to the parameter vector so we can use it to call kernel later.
         # This may also be required to preserve the views into the vector.
@@ -178,6 +194,14 @@ class PyKernel(Kernel):
                         else (lambda mode: cbrt(0.75/pi*volume(*volume_args))) if volume
                         else (lambda mode: 1.0))
 
+        # Vectorized form for evaluating many dispersity points in one call.
+        # This is only available for models without vector parameters.
+        if all(p.length == 1 for p in partable.kernel_parameters):
+            self._mesh = _MeshForm(model_info, q_input, kernel_index, volume_index)
+        else:
+            self._mesh = None
+        self._mesh_check = True
+
     def _call_kernel(self, call_details, values, cutoff, magnetic, radius_effective_mode):
         # type: (CallDetails, np.ndarray, np.ndarray, float, bool) -> None
         if magnetic:
@@ -186,9 +210,25 @@ class PyKernel(Kernel):
         #call_details.show(values)
         radius = ((lambda: 0.0) if radius_effective_mode == 0
                   else (lambda: self._radius(radius_effective_mode)))
-        self.result = _loops(
-            self._parameter_vector, self._form, self._volume, radius,
-            self.q_input.nq, call_details, values, cutoff)
+        result = None
+        if (self._mesh is not None
+                and call_details.num_active >= self.mesh_min_active):
+            result = _mesh_loops(
+                self._parameter_vector, self._form, self._volume, radius,
+                self._mesh, radius_effective_mode, self.q_input.nq,
+                call_details, values, cutoff, check=self._mesh_check)
+            if result is None:
+                # Model does not broadcast over the parameters, so don't
+                # try again with this kernel.
+                logger.info("using dispersity loop for %s", self.info.name)
+                self._mesh = None
+            else:
+                self._mesh_check = self.mesh_check_always
+        if result is None:
+            result = _loops(
+                self._parameter_vector, self._form, self._volume, radius,
+                self.q_input.nq, call_details, values, cutoff)
+        self.result = result
 
     def release(self):
         # type: () -> None
@@ -226,6 +266,7 @@ def _loops(parameters, form, form_volume, form_radius, nq, call_details,
         weight_norm = 1.0
         weighted_shell, weighted_form = form_volume()
         weighted_radius = form_radius()
+        num_evaluated, num_cutoff, num_invalid = 1, 0, 0
 
     else:
         pd_value = values[2+n_pars:2+n_pars + call_details.num_weights]
@@ -235,6 +276,7 @@ def _loops(parameters, form, form_volume, form_radius, nq, call_details,
         weighted_form = 0.0
         weighted_shell = 0.0
         weighted_radius = 0.0
+        num_evaluated, num_cutoff, num_invalid = 0, 0, 0
         partial_weight = np.nan
         weight = np.nan
 
@@ -267,20 +309,174 @@ def _loops(parameters, form, form_volume, form_radius, nq, call_details,
                 # INVALID expression like the C models, but that is expensive.
                 Iq = np.asarray(form(), 'd')
                 if np.isnan(Iq).any():
+                    num_invalid += 1
                     continue
 
                 # Update value and norm.
+                num_evaluated += 1
                 total += weight * Iq
                 weight_norm += weight
                 unweighted_shell, unweighted_form = form_volume()
                 weighted_shell += weight * unweighted_shell
                 weighted_form += weight * unweighted_form
                 weighted_radius += weight * form_radius()
+            else:
+                num_cutoff += 1
+
+    result = np.hstack((total, weight_norm, weighted_form, weighted_shell, weighted_radius,
+                        num_evaluated, num_cutoff, num_invalid))
+    return result
+
 
-    result = np.hstack((total, weight_norm, weighted_form, weighted_shell, weighted_radius))
+class _MeshForm(object):
+    """
+    Evaluate the model for a block of dispersity points in one call.
+
+    The parameters are passed as column vectors, one row per dispersity
+    point, which a model written with numpy operations will broadcast
+    against the row vector of *q* values to give a 2-D result.  Volume
+    and effective radius functions receive the parameters as 1-D vectors.
+    """
+    def __init__(self, model_info, q_input, kernel_index, volume_index):
+        # type: (ModelInfo, PyInput, List[int], List[int]) -> None
+        self.kernel_index = kernel_index
+        self.volume_index = volume_index
+        if q_input.is_2d:
+            Iqxy = model_info.Iqxy
+            qx, qy = q_input.q[:, 0], q_input.q[:, 1]
+            self._form = lambda args: Iqxy(qx, qy, *args)
+        else:
+            Iq = model_info.Iq
+            q = q_input.q
+            self._form = lambda args: Iq(q, *args)
+        self._volume_fn = model_info.form_volume
+        self._shell_fn = model_info.shell_volume
+        self._radius_fn = model_info.radius_effective
+
+    def form(self, pars):
+        # type: (np.ndarray) -> np.ndarray
+        """Return I(q) with one row for each column of *pars*."""
+        return self._form([pars[k][:, None] for k in self.kernel_index])
+
+    def volume(self, pars):
+        # type: (np.ndarray) -> Tuple[np.ndarray, np.ndarray]
+        """Return shell and form volume for each column of *pars*."""
+        n = pars.shape[1]
+        args = [pars[k] for k in self.volume_index]
+        if self._volume_fn is None:
+            return np.ones(n), np.ones(n)
+        form = np.broadcast_to(self._volume_fn(*args), (n,))
+        shell = (np.broadcast_to(self._shell_fn(*args), (n,))
+                 if self._shell_fn is not None else form)
+        return shell, form
+
+    def radius(self, mode, pars):
+        # type: (int, np.ndarray) -> np.ndarray
+        """Return effective radius for each column of *pars*."""
+        n = pars.shape[1]
+        args = [pars[k] for k in self.volume_index]
+        if mode == 0:
+            return np.zeros(n)
+        if self._radius_fn is not None:
+            return np.broadcast_to(self._radius_fn(mode, *args), (n,))
+        if self._volume_fn is not None:
+            return np.broadcast_to(cbrt(0.75/pi*self._volume_fn(*args)), (n,))
+        return np.ones(n)
+
+
+def _mesh_loops(parameters, form, form_volume, form_radius, mesh,
+                radius_effective_mode, nq, call_details, values, cutoff,
+                check=True):
+    # type: (np.ndarray, Callable[[], np.ndarray], Callable[[], float], Callable[[], float], _MeshForm, int, int, CallDetails, np.ndarray, float, bool) -> Optional[np.ndarray]
+    """
+    Vectorized version of :func:`_loops`.
+
+    The dispersity mesh, pruned of points with weight below *cutoff*, is
+    evaluated in blocks of up to :data:`MAX_MESH_SIZE` values.  If *check*
+    is True, the first point is checked against a call to the scalar *form*,
+    *form_volume* and *form_radius* functions.  None is returned if the
+    model fails or does not broadcast correctly so that the caller can
+    use :func:`_loops` instead.
+    """
+    n_pars = len(parameters)
+    parameters[:] = values[2:n_pars+2]
+    num_active = call_details.num_active
+    pd_value = values[2+n_pars:2+n_pars + call_details.num_weights]
+    pd_weight = values[2+n_pars + call_details.num_weights:]
+    pd_par = call_details.pd_par[:num_active]
+    pd_offset = call_details.pd_offset[:num_active]
+    pd_stride = call_details.pd_stride[:num_active]
+    pd_length = call_details.pd_length[:num_active]
+
+    # Build the index into the weight vector for every point in the mesh,
+    # then drop the points below the cutoff.
+    loop_index = np.arange(call_details.num_eval)[:, None]
+    pd_index = (loop_index//pd_stride)%pd_length + pd_offset
+    weight = np.prod(pd_weight[pd_index], axis=1)
+    keep = weight > cutoff
+    num_cutoff = call_details.num_eval - np.count_nonzero(keep)
+    pd_index, weight = pd_index[keep], weight[keep]
+
+    total = np.zeros(nq, 'd')
+    weight_norm = weighted_form = weighted_shell = weighted_radius = 0.0
+    num_evaluated = num_invalid = 0
+    step = max(MAX_MESH_SIZE//max(nq, 1), 1)
+    for start in range(0, len(weight), step):
+        block = slice(start, start+step)
+        w = weight[block]
+        pars = np.repeat(parameters[:, None], len(w), axis=1)
+        pars[pd_par] = pd_value[pd_index[block]].T
+        try:
+            Iq = np.asarray(mesh.form(pars), 'd')
+            shell, volume = mesh.volume(pars)
+            radius = mesh.radius(radius_effective_mode, pars)
+        except Exception:
+            logger.debug("vectorized evaluation failed", exc_info=True)
+            return None
+        if Iq.shape != (len(w), nq):
+            return None
+        if check and start == 0 and not _check_mesh_point(
+                parameters, form, form_volume, form_radius, pars[:, 0],
+                Iq[0], shell[0], volume[0], radius[0]):
+            return None
+        # Points which produce NaN for any q are excluded entirely.
+        valid = ~np.isnan(Iq).any(axis=1)
+        num_invalid += len(w) - np.count_nonzero(valid)
+        num_evaluated += np.count_nonzero(valid)
+        w = w[valid]
+        total += np.dot(w, Iq[valid])
+        weight_norm += np.sum(w)
+        weighted_shell += np.dot(w, shell[valid])
+        weighted_form += np.dot(w, volume[valid])
+        weighted_radius += np.dot(w, radius[valid])
+
+    result = np.hstack((total, weight_norm, weighted_form, weighted_shell, weighted_radius,
+                        num_evaluated, num_cutoff, num_invalid))
     return result
 
 
+def _check_mesh_point(parameters, form, form_volume, form_radius, point,
+                      Iq, shell, volume, radius):
+    # type: (np.ndarray, Callable[[], np.ndarray], Callable[[], float], Callable[[], float], np.ndarray, np.ndarray, float, float, float) -> bool
+    """
+    Return True if the vectorized results for a single dispersity point
+    match the scalar evaluation of the model at *point*.
+    """
+    saved = parameters.copy()
+    parameters[:] = point
+    try:
+        target_Iq = np.asarray(form(), 'd')
+        target_shell, target_volume = form_volume()
+        target_radius = form_radius()
+    finally:
+        parameters[:] = saved
+    return (target_Iq.shape == Iq.shape
+            and np.allclose(Iq, target_Iq, rtol=1e-10, atol=0, equal_nan=True)
+            and np.allclose([shell, volume, radius],
+                            [target_shell, target_volume, target_radius],
+                            rtol=1e-10, atol=0, equal_nan=True))
+
+
 def _create_default_functions(model_info):
     """
     Autogenerate missing functions, such as Iqxy from Iq.
@@ -307,6 +503,7 @@ def _create_vector_Iq(model_info):
             """
             return np.array([Iq(qi, *args) for qi in q])
         vector_Iq.vectorized = True
+        vector_Iq.__wrapped__ = Iq
         model_info.Iq = vector_Iq
 
 
@@ -324,6 +521,7 @@ def _create_vector_Iqxy(model_info):
                 """
                 return np.array([Iqxy(qxi, qyi, *args) for qxi, qyi in zip(qx, qy)])
             vector_Iqxy.vectorized = True
+            vector_Iqxy.__wrapped__ = Iqxy
             model_info.Iqxy = vector_Iqxy
     else:
         #print("defaulting Iqxy")
@@ -335,4 +533,53 @@ def _create_vector_Iqxy(model_info):
             """
             return Iq(np.sqrt(qx**2 + qy**2), *args)
         default_Iqxy.vectorized = True
+        default_Iqxy.from_Iq = True
         model_info.Iqxy = default_Iqxy
+
+
+def test_mesh_loops():
+    # type: () -> None
+    """Check vectorized dispersity loops against the scalar loops"""
+    from types import ModuleType
+    from .core import load_model_info
+    from .direct_model import call_kernel
+    from .modelinfo import make_model_info
+
+    global MAX_MESH_SIZE
+    saved_size = MAX_MESH_SIZE
+    pars = dict(radius=50, radius_pd=0.2, radius_pd_n=35)
+    q_vectors = ([np.logspace(-3, -1, 30)],
+                 [np.linspace(-0.1, 0.1, 20), np.linspace(0.1, -0.1, 20)])
+    model = PyModel(load_model_info('_spherepy'))
+    try:
+        # Small blocks so that the mesh is evaluated in several pieces.
+        MAX_MESH_SIZE = 200
+        for q in q_vectors:
+            vector, scalar = model.make_kernel(q), model.make_kernel(q)
+            scalar._mesh = None
+            for cutoff in (0., 1e-3):
+                actual = call_kernel(vector, pars, cutoff=cutoff)
+                target = call_kernel(scalar, pars, cutoff=cutoff)
+                assert vector._mesh is not None
+                assert np.allclose(actual, target, rtol=1e-12, atol=0)
+                assert repr(vector.stats) == repr(scalar.stats)
+    finally:
+        MAX_MESH_SIZE = saved_size
+
+    # A model which branches on its parameters cannot be vectorized over
+    # them, and should fall back to the scalar loop.
+    module = ModuleType('branching')
+    module.name = 'branching'
+    module.__file__ = 'branching.py'
+    module.parameters = [["radius", "Ang", 50, [0, np.inf], "volume", ""]]
+    def Iq(q, radius):
+        return q*radius if radius > 40 else q
+    Iq.vectorized = True
+    module.Iq = Iq
+    module.form_volume = lambda radius: radius**3
+    model = PyModel(make_model_info(module))
+    vector, scalar = model.make_kernel(q_vectors[0]), model.make_kernel(q_vectors[0])
+    scalar._mesh = None
+    actual = call_kernel(vector, pars)
+    assert vector._mesh is None
+    assert np.allclose(actual, call_kernel(scalar, pars), rtol=1e-12, atol=0)
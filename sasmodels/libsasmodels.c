@@ -0,0 +1,769 @@
+// Standalone C interface for evaluating sasmodels kernels.
+//
+// See libsasmodels.h for usage.  The dispersity weights follow
+// sasmodels/weights.py, the kernel arguments follow make_kernel_args in
+// sasmodels/details.py, and the resolution follows Pinhole1D in
+// sasmodels/resolution.py, so results match the python interface to within
+// round off.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#define DLL_OPEN(path) ((void *)LoadLibraryA(path))
+#define DLL_SYMBOL(handle, name) ((void *)GetProcAddress((HMODULE)(handle), name))
+#define DLL_CLOSE(handle) FreeLibrary((HMODULE)(handle))
+#else
+#include <dlfcn.h>
+#define DLL_OPEN(path) dlopen(path, RTLD_NOW|RTLD_LOCAL)
+#define DLL_SYMBOL(handle, name) dlsym(handle, name)
+#define DLL_CLOSE(handle) dlclose(handle)
+#endif
+
+#include "libsasmodels.h"
+
+// Must match DLL_INFO_VERSION in sasmodels/generate.py.
+#define INFO_VERSION 1
+#define MAX_NAME 64
+#define ERROR_LEN 256
+// Parameters before the kernel parameters: scale and background.
+#define NUM_COMMON_PARS 2
+// Magnetic parameters for each sld: M0, mtheta, mphi.
+#define NUM_MAGNETIC_PARS 3
+// Limits for pinhole resolution, from sasmodels/resolution.py.
+#define MINIMUM_RESOLUTION 1e-8
+#define MINIMUM_ABSOLUTE_Q 0.02
+#define PINHOLE_N_SIGMA_LOW 2.5
+#define PINHOLE_N_SIGMA_HIGH 3.0
+#define DEGREES (3.14159265358979323846/180.)
+
+typedef void KernelFunction(
+    int32_t nq, int32_t pd_start, int32_t pd_stop, const int32_t *details,
+    const double *values, const double *q, double *result, double cutoff,
+    int32_t radius_effective_mode);
+typedef const char *InfoFunction(int32_t *real_size);
+
+typedef struct {
+    char name[MAX_NAME];
+    double default_value, lower, upper;
+    int pd_1d, pd_2d, relative;
+} Parameter;
+
+struct SasModel {
+    void *handle;
+    char name[MAX_NAME];
+    int have_fq, npars, nvalues, max_pd, nmagnetic, theta_par;
+    int num_parameters;
+    Parameter *pars;
+    KernelFunction *Iq, *Iqxy, *Imagnetic;
+};
+
+typedef struct {
+    SasDistribution type;
+    double width, nsigmas;
+    int npts, capacity;
+} Dispersity;
+
+struct SasCalculator {
+    const SasModel *model;
+    int is_2d, nq, nq_calc;
+    double cutoff;
+    double *q_input;    // |q_calc| for 1D, interleaved (qx, qy) for 2D
+    // Pinhole resolution as compressed rows: output point i is the sum of
+    // weight[k]*Iq_calc[column[k]] for k in [row[i], row[i+1]).  NULL for
+    // no resolution.
+    int *row, *column;
+    double *weight;
+    double *pars;       // current parameter values
+    Dispersity *pd;     // dispersity for each kernel parameter
+    int pd_capacity;    // sum of pd[k].capacity
+    double *values;     // kernel values: pars, dispersity values, weights
+    double *scratch;    // weights before they are moved into values
+    int32_t *details;   // ProblemDetails structure
+    int32_t *length, *offset;
+    double *result, *Iq_calc;
+    char error[ERROR_LEN];
+};
+
+static void
+set_error(char *error, int error_len, const char *message, const char *arg)
+{
+    if (error != NULL && error_len > 0) {
+        snprintf(error, (size_t)error_len, message, arg);
+    }
+}
+
+// ===== Model loading =====
+
+static int
+parse_info(SasModel *model, const char *info, char *error, int error_len)
+{
+    int version = 0, count = 0;
+    const char *line;
+    for (line = info; *line; line = strchr(line, '\n') + 1) {
+        if (strncmp(line, "par ", 4) == 0) count++;
+        if (strchr(line, '\n') == NULL) break;
+    }
+    model->pars = (Parameter *)calloc(count > 0 ? count : 1, sizeof(Parameter));
+    if (model->pars == NULL) {
+        set_error(error, error_len, "out of memory%s", "");
+        return 0;
+    }
+    for (line = info; *line; line = strchr(line, '\n') + 1) {
+        char key[MAX_NAME];
+        if (sscanf(line, "%63s", key) == 1) {
+            if (strcmp(key, "sasmodels") == 0) {
+                sscanf(line, "sasmodels %d", &version);
+            } else if (strcmp(key, "name") == 0) {
+                sscanf(line, "name %63s", model->name);
+            } else if (strcmp(key, "have_fq") == 0) {
+                sscanf(line, "have_fq %d", &model->have_fq);
+            } else if (strcmp(key, "npars") == 0) {
+                sscanf(line, "npars %d", &model->npars);
+            } else if (strcmp(key, "nvalues") == 0) {
+                sscanf(line, "nvalues %d", &model->nvalues);
+            } else if (strcmp(key, "max_pd") == 0) {
+                sscanf(line, "max_pd %d", &model->max_pd);
+            } else if (strcmp(key, "nmagnetic") == 0) {
+                sscanf(line, "nmagnetic %d", &model->nmagnetic);
+            } else if (strcmp(key, "theta_par") == 0) {
+                sscanf(line, "theta_par %d", &model->theta_par);
+            } else if (strcmp(key, "par") == 0) {
+                Parameter *p = model->pars + model->num_parameters;
+                if (sscanf(line, "par %63s %lf %lf %lf %d %d %d", p->name,
+                           &p->default_value, &p->lower, &p->upper,
+                           &p->pd_1d, &p->pd_2d, &p->relative) != 7) {
+                    set_error(error, error_len, "bad parameter line in %s",
+                              model->name);
+                    return 0;
+                }
+                model->num_parameters++;
+            }
+        }
+        if (strchr(line, '\n') == NULL) break;
+    }
+    if (version != INFO_VERSION) {
+        set_error(error, error_len, "unsupported model description in %s",
+                  model->name);
+        return 0;
+    }
+    if (model->num_parameters != model->nvalues
+            || model->npars + NUM_COMMON_PARS > model->nvalues) {
+        set_error(error, error_len, "inconsistent parameter table in %s",
+                  model->name);
+        return 0;
+    }
+    return 1;
+}
+
+SasModel *
+sas_model_load(const char *path, char *error, int error_len)
+{
+    char symbol[MAX_NAME + 16];
+    int32_t real_size = 0;
+    InfoFunction *info;
+    SasModel *model = (SasModel *)calloc(1, sizeof(SasModel));
+    if (model == NULL) {
+        set_error(error, error_len, "out of memory%s", "");
+        return NULL;
+    }
+    model->handle = DLL_OPEN(path);
+    if (model->handle == NULL) {
+        set_error(error, error_len, "could not load %s", path);
+        free(model);
+        return NULL;
+    }
+    info = (InfoFunction *)DLL_SYMBOL(model->handle, "sasmodels_info");
+    if (info == NULL) {
+        set_error(error, error_len, "%s is not a sasmodels model", path);
+        sas_model_free(model);
+        return NULL;
+    }
+    {
+        const char *text = info(&real_size);
+        if (real_size != (int32_t)sizeof(double)) {
+            set_error(error, error_len,
+                      "%s is not a double precision model", path);
+            sas_model_free(model);
+            return NULL;
+        }
+        if (!parse_info(model, text, error, error_len)) {
+            sas_model_free(model);
+            return NULL;
+        }
+    }
+    snprintf(symbol, sizeof(symbol), "%s_Iq", model->name);
+    model->Iq = (KernelFunction *)DLL_SYMBOL(model->handle, symbol);
+    snprintf(symbol, sizeof(symbol), "%s_Iqxy", model->name);
+    model->Iqxy = (KernelFunction *)DLL_SYMBOL(model->handle, symbol);
+    snprintf(symbol, sizeof(symbol), "%s_Imagnetic", model->name);
+    model->Imagnetic = (KernelFunction *)DLL_SYMBOL(model->handle, symbol);
+    if (model->Iq == NULL || model->Iqxy == NULL || model->Imagnetic == NULL) {
+        set_error(error, error_len, "missing kernels in %s", path);
+        sas_model_free(model);
+        return NULL;
+    }
+    return model;
+}
+
+void
+sas_model_free(SasModel *model)
+{
+    if (model == NULL) return;
+    if (model->handle != NULL) DLL_CLOSE(model->handle);
+    free(model->pars);
+    free(model);
+}
+
+const char *
+sas_model_name(const SasModel *model)
+{
+    return model->name;
+}
+
+int
+sas_model_num_parameters(const SasModel *model)
+{
+    return model->num_parameters;
+}
+
+const char *
+sas_parameter_name(const SasModel *model, int index)
+{
+    if (index < 0 || index >= model->num_parameters) return NULL;
+    return model->pars[index].name;
+}
+
+double
+sas_parameter_default(const SasModel *model, int index)
+{
+    if (index < 0 || index >= model->num_parameters) return NAN;
+    return model->pars[index].default_value;
+}
+
+int
+sas_parameter_index(const SasModel *model, const char *name)
+{
+    for (int k=0; k < model->num_parameters; k++) {
+        if (strcmp(model->pars[k].name, name) == 0) return k;
+    }
+    return SAS_UNKNOWN_PARAMETER;
+}
+
+// ===== Calculator setup =====
+
+// Allocate the value buffers for the current dispersity capacities.
+static int
+resize_values(SasCalculator *calc)
+{
+    const SasModel *model = calc->model;
+    double *values, *scratch;
+    int total = 0;
+    for (int k=0; k < model->npars; k++) total += calc->pd[k].capacity;
+    values = (double *)realloc(calc->values,
+        (size_t)(model->nvalues + 2*total)*sizeof(double));
+    if (values == NULL) return 0;
+    calc->values = values;
+    scratch = (double *)realloc(calc->scratch, (size_t)total*sizeof(double));
+    if (scratch == NULL) return 0;
+    calc->scratch = scratch;
+    calc->pd_capacity = total;
+    return 1;
+}
+
+static SasCalculator *
+calculator_new(const SasModel *model, int is_2d, int nq)
+{
+    const int max_pd = model->max_pd;
+    SasCalculator *calc = (SasCalculator *)calloc(1, sizeof(SasCalculator));
+    if (calc == NULL) return NULL;
+    calc->model = model;
+    calc->is_2d = is_2d;
+    calc->nq = nq;
+    calc->pars = (double *)malloc((size_t)model->nvalues*sizeof(double));
+    calc->pd = (Dispersity *)calloc((size_t)model->npars + 1, sizeof(Dispersity));
+    calc->details = (int32_t *)calloc((size_t)(4*max_pd + 4), sizeof(int32_t));
+    calc->length = (int32_t *)calloc((size_t)model->npars + 1, sizeof(int32_t));
+    calc->offset = (int32_t *)calloc((size_t)model->npars + 1, sizeof(int32_t));
+    if (calc->pars == NULL || calc->pd == NULL || calc->details == NULL
+            || calc->length == NULL || calc->offset == NULL) {
+        sas_calculator_free(calc);
+        return NULL;
+    }
+    for (int k=0; k < model->nvalues; k++) {
+        calc->pars[k] = model->pars[k].default_value;
+    }
+    for (int k=0; k < model->npars; k++) {
+        calc->pd[k].type = SAS_NONE;
+        calc->pd[k].capacity = 1;
+    }
+    if (!resize_values(calc)) {
+        sas_calculator_free(calc);
+        return NULL;
+    }
+    return calc;
+}
+
+// Allocate the kernel result and the unsmeared I(q) for nq_calc points.
+static int
+allocate_results(SasCalculator *calc)
+{
+    const int nout = (calc->model->have_fq && !calc->is_2d) ? 2 : 1;
+    calc->result = (double *)malloc(
+        (size_t)(nout*calc->nq_calc + 7)*sizeof(double));
+    calc->Iq_calc = (double *)malloc((size_t)calc->nq_calc*sizeof(double));
+    return calc->result != NULL && calc->Iq_calc != NULL;
+}
+
+static int
+compare_double(const void *a, const void *b)
+{
+    const double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Extend the sorted q points to cover [q_min, q_max] with about the same
+// spacing as the end intervals, returning the number of points.  If q_calc
+// is NULL only the count is returned.
+static int
+linear_extrapolation(int nq, const double *q, double q_min, double q_max,
+                     double *q_calc)
+{
+    int n_low = 0, n_high = 0, n = 0;
+    if (q_min + 2*MINIMUM_RESOLUTION < q[0]) {
+        const double delta = nq > 1 ? q[1] - q[0] : 0.;
+        n_low = delta > 0. ? (int)ceil((q[0] - q_min)/delta) : 15;
+    }
+    if (q_max - 2*MINIMUM_RESOLUTION > q[nq-1]) {
+        const double delta = nq > 1 ? q[nq-1] - q[nq-2] : 0.;
+        n_high = delta > 0. ? (int)ceil((q_max - q[nq-1])/delta) : 15;
+    }
+    if (q_calc == NULL) return n_low + nq + n_high;
+    for (int k=0; k < n_low; k++) {
+        q_calc[n++] = q_min + k*(q[0] - q_min)/n_low;
+    }
+    for (int k=0; k < nq; k++) q_calc[n++] = q[k];
+    for (int k=1; k <= n_high; k++) {
+        q_calc[n++] = k == n_high
+            ? q_max : q[nq-1] + k*(q_max - q[nq-1])/n_high;
+    }
+    return n;
+}
+
+// Build the pinhole resolution matrix, as in resolution.Pinhole1D.
+static int
+pinhole_setup(SasCalculator *calc, int nq, const double *q, const double *dq)
+{
+    double q_min = INFINITY, q_max = -INFINITY, q_cut = INFINITY;
+    double *sorted, *q_calc, *edges;
+    int n, nkeep = 0, nnz = 0;
+
+    for (int i=0; i < nq; i++) {
+        const double low = q[i] - PINHOLE_N_SIGMA_LOW*dq[i];
+        const double high = q[i] + PINHOLE_N_SIGMA_HIGH*dq[i];
+        if (low < q_min) q_min = low;
+        if (high > q_max) q_max = high;
+        if (q[i] < q_cut) q_cut = q[i];
+    }
+    q_cut *= MINIMUM_ABSOLUTE_Q;
+    sorted = (double *)malloc((size_t)nq*sizeof(double));
+    if (sorted == NULL) return 0;
+    memcpy(sorted, q, (size_t)nq*sizeof(double));
+    qsort(sorted, (size_t)nq, sizeof(double), compare_double);
+    n = linear_extrapolation(nq, sorted, q_min, q_max, NULL);
+    q_calc = (double *)malloc((size_t)n*sizeof(double));
+    edges = (double *)malloc((size_t)(n + 1)*sizeof(double));
+    if (q_calc == NULL || edges == NULL) {
+        free(sorted); free(q_calc); free(edges);
+        return 0;
+    }
+    linear_extrapolation(nq, sorted, q_min, q_max, q_calc);
+    free(sorted);
+
+    // Protect against models which are not defined for very low q.
+    for (int j=0; j < n; j++) {
+        if (fabs(q_calc[j]) >= q_cut) q_calc[nkeep++] = q_calc[j];
+    }
+    n = nkeep;
+    if (n < 2) {
+        free(q_calc); free(edges);
+        return 0;
+    }
+    edges[0] = q_calc[0] - 0.5*(q_calc[1] - q_calc[0]);
+    for (int j=1; j < n; j++) edges[j] = 0.5*(q_calc[j-1] + q_calc[j]);
+    edges[n] = q_calc[n-1] + 0.5*(q_calc[n-1] - q_calc[n-2]);
+
+    // Count the points within (-2.5, +3) sigma of each q.
+    calc->row = (int *)malloc((size_t)(nq + 1)*sizeof(int));
+    if (calc->row == NULL) {
+        free(q_calc); free(edges);
+        return 0;
+    }
+    for (int i=0; i < nq; i++) {
+        const double width = dq[i] > MINIMUM_RESOLUTION ? dq[i] : MINIMUM_RESOLUTION;
+        const double low = q[i] - PINHOLE_N_SIGMA_LOW*width;
+        const double high = q[i] + PINHOLE_N_SIGMA_HIGH*width;
+        calc->row[i] = nnz;
+        for (int j=0; j < n; j++) {
+            if (q_calc[j] >= low && q_calc[j] <= high) nnz++;
+        }
+    }
+    calc->row[nq] = nnz;
+    calc->column = (int *)malloc((size_t)(nnz > 0 ? nnz : 1)*sizeof(int));
+    calc->weight = (double *)malloc((size_t)(nnz > 0 ? nnz : 1)*sizeof(double));
+    if (calc->column == NULL || calc->weight == NULL) {
+        free(q_calc); free(edges);
+        return 0;
+    }
+    for (int i=0; i < nq; i++) {
+        const double width = dq[i] > MINIMUM_RESOLUTION ? dq[i] : MINIMUM_RESOLUTION;
+        const double low = q[i] - PINHOLE_N_SIGMA_LOW*width;
+        const double high = q[i] + PINHOLE_N_SIGMA_HIGH*width;
+        const double scale = 1./(sqrt(2.)*width);
+        double total = 0.;
+        int k = calc->row[i];
+        for (int j=0; j < n; j++) {
+            if (q_calc[j] >= low && q_calc[j] <= high) {
+                calc->column[k] = j;
+                calc->weight[k] = erf((edges[j+1] - q[i])*scale)
+                    - erf((edges[j] - q[i])*scale);
+                total += calc->weight[k];
+                k++;
+            }
+        }
+        for (k=calc->row[i]; k < calc->row[i+1]; k++) {
+            calc->weight[k] /= total;
+        }
+    }
+    free(edges);
+
+    // Force positive q, even for points on the other side of the beam stop.
+    for (int j=0; j < n; j++) q_calc[j] = fabs(q_calc[j]);
+    calc->q_input = q_calc;
+    calc->nq_calc = n;
+    return 1;
+}
+
+SasCalculator *
+sas_calculator_new(const SasModel *model, int nq, const double *q,
+                   const double *dq)
+{
+    SasCalculator *calc = calculator_new(model, 0, nq);
+    if (calc == NULL) return NULL;
+    if (dq != NULL && nq > 0) {
+        if (!pinhole_setup(calc, nq, q, dq)) {
+            sas_calculator_free(calc);
+            return NULL;
+        }
+    } else {
+        calc->nq_calc = nq;
+        calc->q_input = (double *)malloc((size_t)(nq > 0 ? nq : 1)*sizeof(double));
+        if (calc->q_input == NULL) {
+            sas_calculator_free(calc);
+            return NULL;
+        }
+        if (nq > 0) memcpy(calc->q_input, q, (size_t)nq*sizeof(double));
+    }
+    if (!allocate_results(calc)) {
+        sas_calculator_free(calc);
+        return NULL;
+    }
+    return calc;
+}
+
+SasCalculator *
+sas_calculator_new_2d(const SasModel *model, int n, const double *qx,
+                      const double *qy)
+{
+    SasCalculator *calc = calculator_new(model, 1, n);
+    if (calc == NULL) return NULL;
+    calc->nq_calc = n;
+    calc->q_input = (double *)malloc((size_t)(n > 0 ? 2*n : 1)*sizeof(double));
+    if (calc->q_input == NULL || !allocate_results(calc)) {
+        sas_calculator_free(calc);
+        return NULL;
+    }
+    for (int k=0; k < n; k++) {
+        calc->q_input[2*k] = qx[k];
+        calc->q_input[2*k+1] = qy[k];
+    }
+    return calc;
+}
+
+void
+sas_calculator_free(SasCalculator *calc)
+{
+    if (calc == NULL) return;
+    free(calc->q_input);
+    free(calc->row);
+    free(calc->column);
+    free(calc->weight);
+    free(calc->pars);
+    free(calc->pd);
+    free(calc->values);
+    free(calc->scratch);
+    free(calc->details);
+    free(calc->length);
+    free(calc->offset);
+    free(calc->result);
+    free(calc->Iq_calc);
+    free(calc);
+}
+
+const char *
+sas_calculator_error(const SasCalculator *calc)
+{
+    return calc->error;
+}
+
+void
+sas_set_cutoff(SasCalculator *calc, double cutoff)
+{
+    calc->cutoff = cutoff;
+}
+
+int
+sas_set_index(SasCalculator *calc, int index, double value)
+{
+    if (index < 0 || index >= calc->model->nvalues) {
+        return SAS_UNKNOWN_PARAMETER;
+    }
+    calc->pars[index] = value;
+    return SAS_OK;
+}
+
+int
+sas_set(SasCalculator *calc, const char *name, double value)
+{
+    return sas_set_index(calc, sas_parameter_index(calc->model, name), value);
+}
+
+int
+sas_set_dispersity_index(SasCalculator *calc, int index, SasDistribution type,
+                         double width, int npts, double nsigmas)
+{
+    const SasModel *model = calc->model;
+    const int k = index - NUM_COMMON_PARS;
+    Dispersity *pd;
+    if (k < 0 || k >= model->npars || !model->pars[index].pd_2d) {
+        return SAS_UNKNOWN_PARAMETER;
+    }
+    pd = calc->pd + k;
+    if (npts > pd->capacity) {
+        const int old = pd->capacity;
+        pd->capacity = npts;
+        if (!resize_values(calc)) {
+            pd->capacity = old;
+            snprintf(calc->error, ERROR_LEN, "out of memory");
+            return SAS_ERROR;
+        }
+    }
+    pd->type = type;
+    pd->width = width;
+    pd->npts = npts;
+    pd->nsigmas = nsigmas;
+    return SAS_OK;
+}
+
+int
+sas_set_dispersity(SasCalculator *calc, const char *name, SasDistribution type,
+                   double width, int npts, double nsigmas)
+{
+    return sas_set_dispersity_index(
+        calc, sas_parameter_index(calc->model, name),
+        type, width, npts, nsigmas);
+}
+
+// ===== Evaluation =====
+
+// Fill x, w with the dispersity points for the parameter, returning the
+// number of points.  See Dispersion.get_weights in sasmodels/weights.py.
+static int
+dispersity_points(const Dispersity *pd, double center, const Parameter *p,
+                  double *x, double *w)
+{
+    const double sigma = p->relative ? pd->width*center : pd->width;
+    const double ns = pd->type == SAS_UNIFORM ? 1. : pd->nsigmas;
+    const int log_scale = (pd->type == SAS_LOGNORMAL || pd->type == SAS_SCHULZ);
+    const double lb = log_scale && p->lower < 1e-8 ? 1e-8 : p->lower;
+    const double ub = log_scale && p->upper < 1e-8 ? 1e-8 : p->upper;
+    double total = 0.;
+    int n = 0;
+
+    // For orientation, the jitter is relative to 0 not the angle.
+    if (!p->relative) center = 0.;
+    if (sigma == 0. || pd->npts < 2) {
+        if (lb <= center && center <= ub) {
+            x[0] = center;
+            w[0] = 1.;
+            return 1;
+        }
+        return 0;
+    }
+    for (int k=0; k < pd->npts; k++) {
+        const double xk = k == pd->npts - 1 ? center + ns*sigma
+            : center + (-ns*sigma + k*(2.*ns*sigma)/(pd->npts - 1));
+        double wk;
+        if (xk < lb || xk > ub) continue;
+        switch (pd->type) {
+        case SAS_GAUSSIAN:
+            wk = exp((xk - center)*(xk - center)/(-2.*sigma*sigma));
+            break;
+        case SAS_RECTANGLE:
+            if (fabs(xk - center) > fabs(sigma)*sqrt(3.)) continue;
+            wk = 1.;
+            break;
+        case SAS_UNIFORM:
+            wk = 1.;
+            break;
+        case SAS_LOGNORMAL: {
+            const double sig = fabs(sigma/center);
+            const double t = (log(xk) - log(center))/sig;
+            wk = exp(-0.5*t*t)/(xk*sig);
+            break;
+        }
+        case SAS_SCHULZ: {
+            const double R = xk/center, z = (center/sigma)*(center/sigma);
+            wk = exp(z*log(z) + (z-1.)*log(R) - R*z - log(center) - lgamma(z));
+            break;
+        }
+        case SAS_BOLTZMANN:
+            wk = exp(-fabs(xk - center)/fabs(sigma));
+            break;
+        default:
+            wk = 0.;
+            break;
+        }
+        x[n] = xk;
+        w[n] = wk;
+        total += wk;
+        n++;
+    }
+    for (int k=0; k < n; k++) w[k] /= total;
+    return n;
+}
+
+// Convert magnetism from polar to rectangular, returning true if any of the
+// magnetic moments are nonzero.  See convert_magnetism in details.py.
+static int
+convert_magnetism(const SasModel *model, double *values)
+{
+    double *mag = values + model->nvalues - NUM_MAGNETIC_PARS*model->nmagnetic;
+    int magnetic = 0;
+    for (int k=0; k < model->nmagnetic; k++) {
+        if (mag[NUM_MAGNETIC_PARS*k] != 0.) magnetic = 1;
+    }
+    if (!magnetic) return 0;
+    for (int k=0; k < model->nmagnetic; k++, mag += NUM_MAGNETIC_PARS) {
+        const double M0 = mag[0];
+        const double theta = mag[1]*DEGREES, phi = mag[2]*DEGREES;
+        mag[0] = M0*sin(theta)*cos(phi);
+        mag[1] = M0*sin(theta)*sin(phi);
+        mag[2] = M0*cos(theta);
+    }
+    return 1;
+}
+
+int
+sas_calculate(SasCalculator *calc, double *Iq)
+{
+    const SasModel *model = calc->model;
+    const int npars = model->npars, nvalues = model->nvalues;
+    const int max_pd = model->max_pd;
+    const int nout = (model->have_fq && !calc->is_2d) ? 2 : 1;
+    int32_t *pd_par = calc->details;
+    int32_t *pd_length = calc->details + max_pd;
+    int32_t *pd_offset = calc->details + 2*max_pd;
+    int32_t *pd_stride = calc->details + 3*max_pd;
+    int32_t *tail = calc->details + 4*max_pd;
+    double *values = calc->values;
+    double *pd_values = values + nvalues;
+    int num_weights = 0, num_active = 0, num_eval = 1, magnetic;
+    double total_weight, shell_volume;
+    KernelFunction *kernel;
+
+    // Parameter values, then the dispersity values followed by the weights.
+    memcpy(values, calc->pars, (size_t)nvalues*sizeof(double));
+    for (int k=0; k < npars; k++) {
+        const Parameter *p = model->pars + NUM_COMMON_PARS + k;
+        const Dispersity *pd = calc->pd + k;
+        const double value = calc->pars[NUM_COMMON_PARS + k];
+        const int active = calc->is_2d ? p->pd_2d : p->pd_1d;
+        int n;
+        if (pd->type == SAS_NONE || pd->npts == 0 || pd->width == 0.
+                || !active) {
+            pd_values[num_weights] = p->relative ? value : 0.;
+            calc->scratch[num_weights] = 1.;
+            n = 1;
+        } else {
+            n = dispersity_points(pd, value, p, pd_values + num_weights,
+                                  calc->scratch + num_weights);
+        }
+        calc->length[k] = n;
+        calc->offset[k] = num_weights;
+        num_weights += n;
+        if (n > 1) num_active++;
+    }
+    memcpy(pd_values + num_weights, calc->scratch,
+           (size_t)num_weights*sizeof(double));
+    if (num_active > max_pd) {
+        snprintf(calc->error, ERROR_LEN, "Too many polydisperse parameters");
+        return SAS_TOO_MANY_DISPERSE;
+    }
+    magnetic = convert_magnetism(model, values);
+
+    // Dispersity loops in order of decreasing length.  See make_details.
+    for (int j=0; j < max_pd; j++) {
+        int best = -1;
+        for (int k=npars-1; k >= 0; k--) {
+            int used = 0;
+            for (int i=0; i < j; i++) used |= (pd_par[i] == k);
+            if (!used && (best < 0 || calc->length[k] > calc->length[best])) {
+                best = k;
+            }
+        }
+        pd_par[j] = best;
+        pd_length[j] = calc->length[best];
+        pd_offset[j] = calc->offset[best];
+        pd_stride[j] = num_eval;
+        num_eval *= calc->length[best];
+    }
+    tail[0] = num_eval;
+    tail[1] = num_weights;
+    tail[2] = num_active;
+    tail[3] = model->theta_par;
+
+    kernel = !calc->is_2d ? model->Iq : magnetic ? model->Imagnetic : model->Iqxy;
+    kernel(calc->nq_calc, 0, num_eval, calc->details, values, calc->q_input,
+           calc->result, calc->cutoff, 0);
+
+    // Normalize as in Kernel.Iq.
+    total_weight = calc->result[nout*calc->nq_calc];
+    if (total_weight == 0.) total_weight = 1.;
+    shell_volume = calc->result[nout*calc->nq_calc + 2]/total_weight;
+    if (shell_volume == 0.) shell_volume = 1.;
+    {
+        const double scale = values[0]/(shell_volume*total_weight);
+        const double background = values[1];
+        double *out = calc->row != NULL ? calc->Iq_calc : Iq;
+        for (int i=0; i < calc->nq_calc; i++) {
+            out[i] = scale*calc->result[nout*i] + background;
+        }
+    }
+
+    // Pinhole resolution.
+    if (calc->row != NULL) {
+        for (int i=0; i < calc->nq; i++) {
+            double sum = 0.;
+            for (int k=calc->row[i]; k < calc->row[i+1]; k++) {
+                sum += calc->weight[k]*calc->Iq_calc[calc->column[k]];
+            }
+            Iq[i] = sum;
+        }
+    }
+    return SAS_OK;
+}
@@ -0,0 +1,115 @@
+// Standalone C interface for evaluating sasmodels kernels.
+//
+// The model DLLs built by sasmodels (see sasmodels.core.precompile_dlls or
+// sasmodels.kerneldll.make_dll) contain the plain C kernels along with a
+// description of the model parameters.  This library loads such a DLL and
+// evaluates I(q), including the dispersity mesh from sasmodels/weights.py,
+// the kernel argument packing from sasmodels/details.py and pinhole
+// resolution from sasmodels/resolution.py, without Python.
+//
+// Build with, e.g.,
+//
+//     cc -std=c99 -O2 -fPIC -shared libsasmodels.c -o libsasmodels.so -ldl -lm
+//
+// or compile libsasmodels.c directly into the application.  Only double
+// precision model DLLs are supported.
+//
+// A SasModel is read-only once loaded and can be shared between threads.
+// Each thread creates its own SasCalculator, which holds the q points, the
+// resolution matrix, the parameter values and the work buffers.  All memory
+// is allocated when the calculator is created or when a dispersity is set
+// with a larger number of points than before, so sas_calculate does not
+// allocate.
+//
+// Example:
+//
+//     char error[256];
+//     SasModel *model = sas_model_load("sas64_sphere.so", error, sizeof(error));
+//     SasCalculator *calc = sas_calculator_new(model, nq, q, dq);
+//     sas_set(calc, "radius", 50.);
+//     sas_set_dispersity(calc, "radius", SAS_GAUSSIAN, 0.1, 35, 3.);
+//     sas_calculate(calc, Iq);
+//     sas_calculator_free(calc);
+//     sas_model_free(model);
+
+#ifndef LIBSASMODELS_H
+#define LIBSASMODELS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Status codes returned by the library functions.
+#define SAS_OK 0
+#define SAS_ERROR -1            // see sas_calculator_error
+#define SAS_UNKNOWN_PARAMETER -2
+#define SAS_TOO_MANY_DISPERSE -3
+
+// Dispersity distributions, matching the types in sasmodels/weights.py.
+typedef enum {
+    SAS_NONE = 0,
+    SAS_GAUSSIAN,
+    SAS_RECTANGLE,
+    SAS_UNIFORM,
+    SAS_LOGNORMAL,
+    SAS_SCHULZ,
+    SAS_BOLTZMANN,
+} SasDistribution;
+
+typedef struct SasModel SasModel;
+typedef struct SasCalculator SasCalculator;
+
+// Load the model DLL at path.  Returns NULL on failure, with the reason
+// written to error if it is not NULL.
+SasModel *sas_model_load(const char *path, char *error, int error_len);
+void sas_model_free(SasModel *model);
+
+// Model name and parameters.  Parameters are numbered as in
+// ModelInfo.parameters.call_parameters, starting with scale and background,
+// with vector parameters expanded to name1, name2, ....
+const char *sas_model_name(const SasModel *model);
+int sas_model_num_parameters(const SasModel *model);
+const char *sas_parameter_name(const SasModel *model, int index);
+double sas_parameter_default(const SasModel *model, int index);
+int sas_parameter_index(const SasModel *model, const char *name);
+
+// Create a calculator for 1D data at the nq points q.  If dq is not NULL,
+// it gives the 1-sigma gaussian pinhole resolution at each point.  Returns
+// NULL if out of memory.
+SasCalculator *sas_calculator_new(const SasModel *model, int nq,
+                                  const double *q, const double *dq);
+// Create a calculator for 2D data at the n points (qx, qy).
+SasCalculator *sas_calculator_new_2d(const SasModel *model, int n,
+                                     const double *qx, const double *qy);
+void sas_calculator_free(SasCalculator *calc);
+const char *sas_calculator_error(const SasCalculator *calc);
+
+// Skip dispersity points where the product of the weights is below cutoff,
+// as in sasmodels.direct_model.call_kernel.  The default of 0 keeps all
+// points.
+void sas_set_cutoff(SasCalculator *calc, double cutoff);
+
+// Set parameter values, by name or by index.  Parameters start at their
+// default values.
+int sas_set(SasCalculator *calc, const char *name, double value);
+int sas_set_index(SasCalculator *calc, int index, double value);
+
+// Set the dispersity for a parameter, with width relative to the value for
+// size parameters and absolute for angles, as in sasmodels.  Use SAS_NONE
+// or npts < 2 to turn it off.  Returns SAS_ERROR if memory for npts points
+// could not be allocated.
+int sas_set_dispersity(SasCalculator *calc, const char *name,
+                       SasDistribution type, double width, int npts,
+                       double nsigmas);
+int sas_set_dispersity_index(SasCalculator *calc, int index,
+                             SasDistribution type, double width, int npts,
+                             double nsigmas);
+
+// Compute I(q) at the calculator points, storing nq values in Iq.
+int sas_calculate(SasCalculator *calc, double *Iq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LIBSASMODELS_H
@@ -0,0 +1,318 @@
+r"""
+Size dispersity by convolution in log q
+
+For a model whose shape is fixed up to a single length $R$, such as the
+sphere, the form factor scales as
+
+.. math::
+
+    F(q; R) = (R/R_0)^3 F(q R/R_0; R_0)
+
+so the size average is a correlation in $\ln q$ and $\ln R$:
+
+.. math::
+
+    \sum_k w_k F^2(q; R_k) = \sum_k w_k (R_k/R_0)^6 F^2(e^{\ln q + \ln R_k/R_0}; R_0)
+
+Rather than evaluating the kernel at every $(q, R_k)$ pair, the kernel is
+evaluated once at $R_0$ on a uniform grid in $\ln q$ with step $h$.  The
+weights $w_k (R_k/R_0)^6$ are spread onto the same grid using cubic
+Lagrange interpolation, the correlation is computed with an FFT, and the
+result is interpolated back to the data $q$ values.  This reduces the cost
+from $n_q n_R$ kernel calls to about $\ln(q_\max R_\max/q_\min R_\min)/h$
+kernel calls.  The step is chosen so that there are at least
+$1/\text{STEP}$ grid points per radian of $q R_\max$ at $q_\max$, which
+keeps the interpolation error near $10^{-7}$ relative for moderate
+$q R_\max$, rising to $10^{-5}$ for $q R_\max$ in the thousands.
+
+Models opt in by naming the length parameter in *scale_invariant*.  The
+length must be the only parameter which changes the size of the shape,
+with form volume and effective radius proportional to $R^3$ and $R$
+respectively, and the model must not reject points with *valid*.  The
+convolution is used for 1D data when the flagged parameter is the only
+polydisperse parameter, the model is not magnetic, and the grid is much
+smaller than the dispersity mesh.  Otherwise the calculation is passed
+through to the underlying kernel.
+"""
+from __future__ import division, print_function
+
+import numpy as np  # type: ignore
+from scipy.fft import rfft, irfft, next_fast_len  # type: ignore
+
+from . import trace
+from .details import make_kernel_args
+from .kernel import KernelModel, Kernel, KernelStats
+
+# pylint: disable=unused-import
+try:
+    from typing import List, Optional, Tuple
+    from .details import CallDetails
+    from .modelinfo import ModelInfo
+except ImportError:
+    pass
+# pylint: enable=unused-import
+
+#: Grid step in $\ln q$ relative to $1/(q_\max R_\max)$.
+STEP = 0.1
+#: Largest grid step, used when $q_\max R_\max < 1$.
+MAX_STEP = 2.0**-4
+#: Use the FFT when the dispersity mesh is this many times larger than the
+#: grid.  The grid needs an FFT and interpolation on top of the kernel
+#: evaluation, and the direct calculation is already parallel.
+MESH_RATIO = 20
+
+
+class LogFFTModel(KernelModel):
+    """
+    Wrap *model*, whose info declares *scale_invariant*, so that size
+    dispersity in the flagged parameter is computed by FFT.
+    """
+    def __init__(self, model_info, model):
+        # type: (ModelInfo, KernelModel) -> None
+        self.info = model_info
+        self.dtype = model.dtype
+        self._model = model
+
+    def __getattr__(self, name):
+        # Pass through backend specific attributes such as dllpath.
+        if name.startswith('__') or name == '_model':
+            raise AttributeError(name)
+        return getattr(self._model, name)
+
+    def __getstate__(self):
+        return self.info, self._model
+
+    def __setstate__(self, state):
+        self.info, self._model = state
+        self.dtype = self._model.dtype
+
+    def make_kernel(self, q_vectors):
+        # type: (List[np.ndarray]) -> Kernel
+        kernel = self._model.make_kernel(q_vectors)
+        if len(q_vectors) != 1:
+            return kernel
+        return LogFFTKernel(self._model, kernel, q_vectors[0])
+    make_kernel.__doc__ = KernelModel.make_kernel.__doc__
+
+    def release(self):
+        # type: () -> None
+        self._model.release()
+
+
+class LogFFTKernel(Kernel):
+    """
+    Kernel which computes size dispersity by FFT when it can, or calls
+    *kernel* otherwise.  The grid kernel created from *model* is kept for
+    the next call.
+    """
+    def __init__(self, model, kernel, q):
+        # type: (KernelModel, Kernel, np.ndarray) -> None
+        self.info = kernel.info
+        self.dtype = kernel.dtype
+        self.dim = kernel.dim
+        self.q_input = kernel.q_input
+        self._model = model
+        self._kernel = kernel
+        self._q = np.asarray(q, 'd')
+        self._grid = None  # type: Optional[Tuple[int, int, int, Kernel]]
+
+        partable = self.info.parameters
+        offset = 0
+        for p in partable.kernel_parameters:
+            if p.id == self.info.scale_invariant:
+                break
+            offset += p.length
+        self._index = offset
+        # Evaluate the grid at the default size, which must be positive.
+        default = partable[self.info.scale_invariant].default
+        self._R0 = default if default > 0 else 1.
+        self._usable = (not self.info.valid and self._q.size > 0
+                        and (self._q > 0).all()
+                        and all(p.length == 1
+                                for p in partable.kernel_parameters))
+
+    def _mesh_Fq(self, call_details, values, cutoff, magnetic,
+                 radius_effective_mode):
+        # type: (CallDetails, np.ndarray, np.ndarray, float, bool, int) -> np.ndarray
+        # Called from Kernel.Fq when the closed form average doesn't apply.
+        if (not self._usable or magnetic or call_details.num_active != 1
+                or call_details.pd_par[0] != self._index):
+            result = self._kernel._mesh_Fq(call_details, values, cutoff,
+                                           magnetic, radius_effective_mode)
+            self.stats = self._kernel.stats
+            return result
+
+        nvalues = self.info.parameters.nvalues
+        start = nvalues + call_details.pd_offset[0]
+        n = call_details.pd_length[0]
+        R = np.asarray(values[start:start+n], 'd')
+        w = np.asarray(values[start+call_details.num_weights:
+                              start+call_details.num_weights+n], 'd')
+        keep = w > cutoff
+        R, w = R[keep], w[keep]
+        total_weight = np.sum(w)
+        if total_weight == 0.:
+            total_weight = 1.
+        R0 = self._R0
+        positive = R > 0
+        scale = np.where(positive, R, 0.)/R0
+        Rmax = np.max(R) if len(R) else 0.
+
+        # Compare the grid size to the size of the dispersity mesh.
+        qR = max(np.max(self._q)*Rmax, 1.)
+        m = max(int(np.ceil(np.log2(qR/STEP))), -int(np.log2(MAX_STEP)))
+        h = 2.0**-m
+        x = np.log(self._q)/h
+        s = np.log(scale[positive])/h
+        if len(s):
+            jmin, jmax = int(np.floor(s.min()))-1, int(np.floor(s.max()))+2
+        else:
+            jmin = jmax = 0
+        imin, imax = int(np.floor(x.min()))-1, int(np.floor(x.max()))+2
+        ngrid = (imax - imin) + (jmax - jmin) + 1
+        if MESH_RATIO*ngrid > len(self._q)*len(R):
+            result = self._kernel._mesh_Fq(call_details, values, cutoff,
+                                           magnetic, radius_effective_mode)
+            self.stats = self._kernel.stats
+            return result
+
+        with trace.span("logfft", self.info.id, details=lambda: {
+                'nq': len(self._q), 'npd': len(R), 'ngrid': ngrid}):
+            tmin, tmax = imin + jmin, imax + jmax
+            G1, G2, radius0, shell0, ratio = self._grid_Fq(
+                values, R0, tmin, tmax, m, radius_effective_mode)
+
+            # Tilt the grid by the Porod slope so that the FFT round off is
+            # relative to the local value rather than to the peak.
+            t = np.arange(tmin, tmax+1)*h + np.log(R0)
+            tail = len(t)//4
+            if t[-1] > 2 and tail > 1 and (G2[-tail:] > 0).all():
+                slope = -np.polyfit(t[-tail:], np.log(G2[-tail:]), 1)[0]
+                p = min(max(slope, 0.), 6.)
+            else:
+                p = 0.
+
+            j = np.floor(s).astype(int)
+            F2 = _correlate(G2, p, j, s-j, w[positive]*scale[positive]**6,
+                            jmin, jmax, x, imin, imax, h)/total_weight
+            if G1 is not None:
+                F1 = _correlate(G1, p/2, j, s-j,
+                                w[positive]*scale[positive]**3,
+                                jmin, jmax, x, imin, imax, h)/total_weight
+            else:
+                F1 = None
+
+        shell_volume = shell0*np.sum(w*scale**3)/total_weight
+        radius_effective = radius0*np.sum(w*scale)/total_weight
+        if shell_volume == 0.:
+            shell_volume = 1.
+        # The form factor is evaluated once per point of the log-q grid
+        # rather than once per dispersity point.
+        lo, hi = self._grid[:2]
+        self.stats = KernelStats(hi - lo + 1, np.sum(~keep), 0)
+        return F1, F2, radius_effective, shell_volume, ratio
+
+    def _grid_Fq(self, values, R0, tmin, tmax, m, radius_effective_mode):
+        """
+        Evaluate the monodisperse kernel at size *R0* for $q$ on the grid
+        $e^{t h}$ for $t$ in *tmin* to *tmax*.
+        """
+        # Grow the grid in blocks of 1/h points so that small changes in the
+        # dispersity don't require a new kernel.
+        if (self._grid is None or self._grid[2] != m
+                or self._grid[0] > tmin or self._grid[1] < tmax):
+            if self._grid is not None:
+                self._grid[3].release()
+            block = 2**m
+            lo, hi = (tmin//block)*block, -((-tmax)//block)*block
+            q = np.exp(np.arange(lo, hi+1)*2.0**-m)
+            self._grid = (lo, hi, m, self._model.make_kernel([q]))
+        lo, _, _, kernel = self._grid
+
+        nvalues = self.info.parameters.nvalues
+        scalars = np.array(values[:nvalues], 'd')
+        scalars[2+self._index] = R0
+        mesh = [(v, np.array([v]), np.array([1.])) for v in scalars]
+        details, grid_values, _ = make_kernel_args(kernel, mesh)
+        F1, F2, radius, shell, ratio = kernel.Fq(
+            details, grid_values, 0., False, radius_effective_mode)
+        index = slice(tmin-lo, tmax-lo+1)
+        F1 = np.asarray(F1[index], 'd') if F1 is not None else None
+        return F1, np.asarray(F2[index], 'd'), radius, shell, ratio
+
+    def release(self):
+        # type: () -> None
+        if self._grid is not None:
+            self._grid[3].release()
+            self._grid = None
+        self._kernel.release()
+
+
+def _lagrange(f):
+    # type: (np.ndarray) -> np.ndarray
+    """Cubic Lagrange weights for nodes -1, 0, 1, 2 at offsets *f*."""
+    return np.array([
+        -f*(f-1)*(f-2)/6,
+        (f+1)*(f-1)*(f-2)/2,
+        -(f+1)*f*(f-2)/2,
+        (f+1)*f*(f-1)/6,
+    ])
+
+
+def _correlate(G, p, j, f, a, jmin, jmax, x, imin, imax, h):
+    r"""
+    Return $I(x) = \sum_k a_k G(x + s_k)$ interpolated from the grid.
+
+    *G* is the kernel on the grid $t = $ *imin+jmin* to *imax+jmax*, and
+    the weights *a* are at grid positions $s_k = j_k + f_k$.  The kernel is
+    multiplied by $e^{p t h}$ before the FFT and the result divided by
+    $e^{p x h}$ afterward.
+    """
+    A = np.zeros(jmax - jmin + 1)
+    weights = _lagrange(f)
+    for k in range(4):
+        np.add.at(A, j - 1 + k - jmin, a*weights[k])
+    A *= np.exp(-p*h*np.arange(jmin, jmax+1))
+    tilted = G*np.exp(p*h*np.arange(imin+jmin, imax+jmax+1))
+    # Indices into G for the points we need never wrap around, so the FFT
+    # need only be as long as G.
+    nfft = next_fast_len(len(tilted), real=True)
+    I = irfft(rfft(tilted, nfft)*np.conj(rfft(A, nfft)), nfft)[:imax-imin+1]
+    I *= np.exp(-p*h*np.arange(imin, imax+1))
+    i = np.floor(x).astype(int)
+    weights = _lagrange(x - i)
+    return sum(weights[k]*I[i - 1 + k - imin] for k in range(4))
+
+
+def test_logfft():
+    """
+    Check the sphere size average against the direct calculation.
+    """
+    from .core import load_model_info, build_model
+    from .direct_model import call_kernel
+
+    info = load_model_info('sphere')
+    model = build_model(info, dtype='double', platform='dll')
+    assert isinstance(model, LogFFTModel)
+    q = np.logspace(-3, np.log10(0.5), 1000)
+    pars = dict(radius=50., radius_pd=0.2, radius_pd_n=200,
+                radius_pd_type='lognormal', sld=4, sld_solvent=1)
+
+    kernel = model.make_kernel([q])
+    direct = model._model.make_kernel([q])
+    try:
+        target = call_kernel(direct, pars)
+        actual = call_kernel(kernel, pars)
+        lo, hi = kernel._grid[:2]
+        assert kernel.stats.evaluated == hi - lo + 1 != 200
+        assert np.max(abs(actual/target - 1)) < 1e-6
+        # The grid kernel is reused when the distribution changes a little.
+        grid = kernel._grid[3]
+        call_kernel(kernel, dict(pars, radius_pd=0.19))
+        assert kernel._grid[3] is grid
+        # Monodisperse models use the underlying kernel.
+        mono = dict(pars, radius_pd=0.)
+        assert (call_kernel(kernel, mono) == call_kernel(direct, mono)).all()
+    finally:
+        kernel.release()
+        direct.release()
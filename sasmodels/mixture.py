@@ -21,6 +21,7 @@ from .modelinfo import Parameter, ParameterTable, ModelInfo
 from .modelinfo import NUM_MAGFIELD_PARS, NUM_MAGNETIC_PARS, NUM_COMMON_PARS
 from .kernel import KernelModel, Kernel
 from .details import make_details
+from . import trace
 
 # pylint: disable=unused-import
 try:
@@ -211,6 +212,11 @@ class MixtureKernel(Kernel):
         self.results = None  # type: Callable[[], OrderedDict]
 
     def Iq(self, call_details, values, cutoff, magnetic):
+        # type: (CallDetails, np.ndarray, np.ndarray, float, bool) -> np.ndarray
+        with trace.span("mixture", self.info.id):
+            return self._Iq(call_details, values, cutoff, magnetic)
+
+    def _Iq(self, call_details, values, cutoff, magnetic):
         # type: (CallDetails, np.ndarray, np.ndarray, float, bool) -> np.ndarray
         scale, background = values[0:2]
         total = 0.0
@@ -61,12 +61,15 @@ except ImportError:
 import numpy as np  # type: ignore
 
 from .core import list_models, load_model_info, build_model
-from .direct_model import call_kernel, call_Fq
+from .direct_model import call_kernel, call_Fq, get_mesh, get_dispersion
+from .details import make_kernel_args
+from .generate import F64
 from .exception import annotate_exception
 from .modelinfo import expand_pars
 from .kernelcl import use_opencl
 from .kernelcuda import use_cuda
 from . import product
+from . import analytic
 
 # pylint: disable=unused-import
 try:
@@ -236,6 +239,11 @@ def _hide_model_case_from_nose():
                 model = build_model(self.info, dtype=self.dtype,
                                     platform=self.platform)
                 results = [self.run_one(model, test) for test in P_tests]
+                # The closed form is computed in double precision, so only
+                # compare it to the double precision dispersity loop.
+                if (self.info.concentric_shells is not None
+                        and model.dtype == F64):
+                    self._check_analytic(model)
                 for test in S_tests:
                     # pull the S model name out of the test defn
                     pars = test[0].copy()
@@ -356,6 +364,45 @@ def _hide_model_case_from_nose():
                                       % (str(user_pars), str(test[2:])))
                 return None
 
+        def _check_analytic(self, model):
+            # type: (KernelModel) -> None
+            """
+            Compare the closed form radius dispersity from :mod:`.analytic`
+            with the dispersity loop.
+            """
+            q = np.logspace(-4, 0, 50)
+            # The wide Gaussian checks the truncation at R = 0.
+            for pd_type, pd, nsigmas, npts in (('gaussian', 0.1, 7, 400),
+                                               ('gaussian', 0.4, 7, 4000),
+                                               ('schulz', 0.1, 8, 200)):
+                pars = dict(radius_pd=pd, radius_pd_n=npts,
+                            radius_pd_nsigma=nsigmas, radius_pd_type=pd_type)
+                name = '%s %g radius' % (pd_type, pd)
+                kernel = model.make_kernel([q])
+                try:
+                    mesh = get_mesh(self.info, pars, dim=kernel.dim)
+                    call_details, values, magnetic = make_kernel_args(
+                        kernel, mesh, get_dispersion(self.info, pars))
+                    actual = analytic.Fq(kernel, call_details, values, 0.,
+                                         magnetic, 1)
+                    kernel.analytic = False
+                    target = call_Fq(kernel, pars)
+                finally:
+                    kernel.release()
+                if actual is None:
+                    self._failures.append('%s: closed form not used' % name)
+                    continue
+                if target[0] is not None:
+                    # <F> decays exponentially with q, so at high q the
+                    # loop result is dominated by the truncated tails and
+                    # by the mesh step at the cut at R = 0.
+                    keep = abs(target[0]) > 1e-3*abs(target[0]).max()
+                    self._check_vectors(q[keep], target[0][keep],
+                                        actual[0][keep], 'F '+name)
+                self._check_vectors(q, target[1], actual[1], 'F^2 '+name)
+                self._check_scalar(target[2], actual[2], 'R_eff '+name)
+                self._check_scalar(target[3], actual[3], 'volume '+name)
+
         def _check_scalar(self, target, actual, name):
             if not is_near(target, actual, 5):
                 self._failures.append('%s: expected:%s; actual:%s'
@@ -946,6 +946,7 @@ def make_model_info(kernel_module):
     # TODO: find Fq by inspection
     info.radius_effective_modes = getattr(kernel_module, 'radius_effective_modes', None)
     info.have_Fq = getattr(kernel_module, 'have_Fq', False)
+    info.scale_invariant = getattr(kernel_module, 'scale_invariant', None)
     info.profile_axes = getattr(kernel_module, 'profile_axes', ['x', 'y'])
     # Note: custom.load_custom_kernel_module assumes the C sources are defined
     # by this attribute.
@@ -963,6 +964,7 @@ def make_model_info(kernel_module):
     info.Iqabc = getattr(kernel_module, 'Iqabc', None) # type: ignore
     info.Imagnetic = getattr(kernel_module, 'Imagnetic', None) # type: ignore
     info.profile = getattr(kernel_module, 'profile', None) # type: ignore
+    info.concentric_shells = getattr(kernel_module, 'concentric_shells', None) # type: ignore
     info.sesans = getattr(kernel_module, 'sesans', None) # type: ignore
     # Default single and opencl to True for C models.  Python models have callable Iq.
     info.opencl = getattr(kernel_module, 'opencl', not callable(info.Iq))
@@ -1099,6 +1101,11 @@ class ModelInfo(object):
     #: True if the model defines an Fq function with signature
     #: ``void Fq(double q, double *F1, double *F2, ...)``
     have_Fq = False
+    #: Name of the length parameter which sets the size of the shape if
+    #: changing it only rescales the form factor, with $F(q; R)$ equal to
+    #: $(R/R_0)^3 F(qR/R_0; R_0)$.  Size dispersity in this parameter can
+    #: then be computed by FFT; see :mod:`.logfft`.
+    scale_invariant = None  # type: Optional[str]
     #: List of options for computing the effective radius of the shape,
     #: or None if the model is not usable as a form factor model.
     radius_effective_modes = None   # type: List[str]
@@ -1164,6 +1171,15 @@ class ModelInfo(object):
     #: :attr:`profile_axes` to set the axis labels.  Note that *y* values
     #: will be scaled by 1e6 before plotting.
     profile = None          # type: Optional[Callable[[np.ndarray], None]]
+    #: Returns *contrast, offset, radius_offset* for spheres made from
+    #: concentric shells of uniform density, given the kernel parameters.
+    #: The interfaces are at *radius* + *offset*, with *contrast* the change
+    #: in SLD across each interface, from inside to outside.  Effective
+    #: radius mode *k* is *radius* + *radius_offset[k-1]*.  The form volume
+    #: must be the volume within the outermost interface.  If defined,
+    #: dispersity in *radius* can be computed in closed form; see
+    #: :mod:`.analytic`.
+    concentric_shells = None  # type: Optional[Callable[..., Tuple[List[float], List[float], List[float]]]]
     #: Axis labels for the :attr:`profile` plot.  The default is *['x', 'y']*.
     #: Only the *x* component is used for now.
     profile_axes = None     # type: Tuple[str, str]
@@ -82,9 +82,9 @@ static double Iq(double q, double dnn,
     const double theta_m = M_PI_2;
     const double theta_b = M_PI_2;
 
-    double outer_sum = 0.0;
+    SAS_ACC outer_sum = 0.0;
     for(int i=0; i<GAUSS_N; i++) {
-        double inner_sum = 0.0;
+        SAS_ACC inner_sum = 0.0;
         const double theta = GAUSS_Z[i]*theta_m + theta_b;
         double sin_theta, cos_theta;
         SINCOS(theta, sin_theta, cos_theta);
@@ -26,7 +26,7 @@ _cap_kernel(double qab, double qc, double h, double radius_cap,
     const double m = radius_cap*qc; // cos argument slope
     const double b = (half_length+h)*qc; // cos argument intercept
     const double qab_r = radius_cap*qab; // Q*R*sin(theta)
-    double total = 0.0;
+    SAS_ACC total = 0.0;
     for (int i=0; i<GAUSS_N; i++) {
         const double t = GAUSS_Z[i]*zm + zb;
         const double radical = 1.0 - t*t;
@@ -117,8 +117,8 @@ Fq(double q,double *F1, double *F2, double sld, double solvent_sld,
     // translate a point in [-1,1] to a point in [0, pi/2]
     const double zm = M_PI_4;
     const double zb = M_PI_4;
-    double total_F1 = 0.0;
-    double total_F2 = 0.0;
+    SAS_ACC total_F1 = 0.0;
+    SAS_ACC total_F2 = 0.0;
     for (int i=0; i<GAUSS_N ;i++) {
         const double theta = GAUSS_Z[i]*zm + zb;
         double sin_theta, cos_theta; // slots to hold sincos function output
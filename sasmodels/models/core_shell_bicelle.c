@@ -93,8 +93,8 @@ Fq(double q,
     const double uplim = M_PI_4;
     const double halflength = 0.5*length;
 
-    double total_F1 = 0.0;
-    double total_F2 = 0.0;
+    SAS_ACC total_F1 = 0.0;
+    SAS_ACC total_F2 = 0.0;
     for(int i=0;i<GAUSS_N;i++) {
         double theta = (GAUSS_Z[i] + 1.0)*uplim;
         double sin_theta, cos_theta; // slots to hold sincos function output
@@ -94,8 +94,8 @@ Fq(double q,
     const double dr3 = vol3*(rhoh-rhosolv);
 
     //initialize integral
-    double outer_total_F1 = 0.0;
-    double outer_total_F2 = 0.0;
+    SAS_ACC outer_total_F1 = 0.0;
+    SAS_ACC outer_total_F2 = 0.0;
     for(int i=0;i<GAUSS_N;i++) {
         //setup inner integral over the ellipsoidal cross-section
         // since we generate these lots of times, why not store them somewhere?
@@ -106,8 +106,8 @@ Fq(double q,
         const double qc = q*cos_theta;
         const double si1 = sas_sinx_x(halfheight*qc);
         const double si2 = sas_sinx_x((halfheight+thick_face)*qc);
-        double inner_total_F1 = 0;
-        double inner_total_F2 = 0;
+        SAS_ACC inner_total_F1 = 0;
+        SAS_ACC inner_total_F2 = 0;
         for(int j=0;j<GAUSS_N;j++) {
             //76 gauss points for the inner integral (WAS 20 points,so this may make unecessarily slow, but playing safe)
             //const double beta = ( GAUSS_Z[j]*(vbj-vaj) + vaj + vbj )/2.0;
@@ -75,8 +75,8 @@ Fq(double q,
     const double shell_r = (radius + thickness);
     const double shell_h = (0.5*length + thickness);
     const double shell_vd = form_volume(radius,thickness,length) * (shell_sld-solvent_sld);
-    double total_F1 = 0.0;
-    double total_F2 = 0.0;
+    SAS_ACC total_F1 = 0.0;
+    SAS_ACC total_F2 = 0.0;
     for (int i=0; i<GAUSS_N ;i++) {
         // translate a point in [-1,1] to a point in [0, pi/2]
         //const double theta = ( GAUSS_Z[i]*(upper-lower) + upper + lower )/2.0;
@@ -107,8 +107,8 @@ Fq(double q,
     // translate from [-1, 1] => [0, 1]
     const double m = 0.5;
     const double b = 0.5;
-    double total_F1 = 0.0;     //initialize intergral
-    double total_F2 = 0.0;     //initialize intergral
+    SAS_ACC total_F1 = 0.0;     //initialize intergral
+    SAS_ACC total_F2 = 0.0;     //initialize intergral
     for(int i=0;i<GAUSS_N;i++) {
         const double cos_theta = GAUSS_Z[i]*m + b;
         const double sin_theta = sqrt(1.0 - cos_theta*cos_theta);
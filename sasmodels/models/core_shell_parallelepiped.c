@@ -133,8 +133,8 @@ Fq(double q,
 
     // outer integral (with gauss points), integration limits = 0, 1
     // substitute d_cos_alpha for sin_alpha d_alpha
-    double outer_sum_F1 = 0; //initialize integral
-    double outer_sum_F2 = 0; //initialize integral
+    SAS_ACC outer_sum_F1 = 0; //initialize integral
+    SAS_ACC outer_sum_F2 = 0; //initialize integral
     for( int i=0; i<GAUSS_N; i++) {
         const double cos_alpha = 0.5 * ( GAUSS_Z[i] + 1.0 );
         const double mu = half_q * sqrt(1.0-cos_alpha*cos_alpha);
@@ -143,8 +143,8 @@ Fq(double q,
 
         // inner integral (with gauss points), integration limits = 0, 1
         // substitute beta = PI/2 u (so 2/PI * d_(PI/2 * beta) = d_beta)
-        double inner_sum_F1 = 0.0;
-        double inner_sum_F2 = 0.0;
+        SAS_ACC inner_sum_F1 = 0.0;
+        SAS_ACC inner_sum_F2 = 0.0;
         for(int j=0; j<GAUSS_N; j++) {
             const double u = 0.5 * ( GAUSS_Z[j] + 1.0 );
             double sin_beta, cos_beta;
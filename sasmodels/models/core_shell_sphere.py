@@ -86,6 +86,11 @@ source = ["lib/sas_3j1x_x.c", "lib/core_shell.c", "core_shell_sphere.c"]
 have_Fq = True
 radius_effective_modes = ["outer radius", "core radius"]
 
+def concentric_shells(radius, thickness, sld_core, sld_shell, sld_solvent):
+    """Interfaces for the closed form radius dispersity."""
+    return ([sld_core - sld_shell, sld_shell - sld_solvent], [0., thickness],
+            [thickness, 0.])
+
 def random():
     """Return a random parameter set for the model."""
     outer_radius = 10**np.random.uniform(1.3, 4.3)
@@ -64,8 +64,8 @@ Fq(double q,
     const double zm = M_PI_4;
     const double zb = M_PI_4;
 
-    double total_F1 = 0.0;
-    double total_F2 = 0.0;
+    SAS_ACC total_F1 = 0.0;
+    SAS_ACC total_F2 = 0.0;
     for (int i=0; i<GAUSS_N ;i++) {
         const double theta = GAUSS_Z[i]*zm + zb;
         double sin_theta, cos_theta; // slots to hold sincos function output
@@ -68,8 +68,8 @@ Fq(double q,
     // const double u = GAUSS_Z[i]*(upper-lower)/2 + (upper+lower)/2;
     const double zm = 0.5;
     const double zb = 0.5;
-    double total_F2 = 0.0;
-    double total_F1 = 0.0;
+    SAS_ACC total_F2 = 0.0;
+    SAS_ACC total_F1 = 0.0;
     for (int i=0;i<GAUSS_N;i++) {
         const double u = GAUSS_Z[i]*zm + zb;
         const double r = radius_equatorial*sqrt(1.0 + u*u*v_square_minus_one);
@@ -83,15 +83,15 @@ Fq(double q, double *F1, double *F2, double radius_minor, double r_ratio, double
     const double rB = 0.5*(square(radius_major) - square(radius_minor));
 
     //initialize integral
-    double outer_sum_F1 = 0.0;
-    double outer_sum_F2 = 0.0;
+    SAS_ACC outer_sum_F1 = 0.0;
+    SAS_ACC outer_sum_F2 = 0.0;
     for(int i=0;i<GAUSS_N;i++) {
         //setup inner integral over the ellipsoidal cross-section
         const double cos_val = ( GAUSS_Z[i]*(vb-va) + va + vb )/2.0;
         const double sin_val = sqrt(1.0 - cos_val*cos_val);
         //const double arg = radius_minor*sin_val;
-        double inner_sum_F1 = 0.0;
-        double inner_sum_F2 = 0.0;
+        SAS_ACC inner_sum_F1 = 0.0;
+        SAS_ACC inner_sum_F2 = 0.0;
         for(int j=0;j<GAUSS_N;j++) {
             const double theta = ( GAUSS_Z[j]*(vbj-vaj) + vaj + vbj )/2.0;
             const double r = sin_val*sqrt(rA - rB*cos(theta));
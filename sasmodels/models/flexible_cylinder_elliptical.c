@@ -14,7 +14,7 @@ double form_volume(double length, double kuhn_length, double radius)
 double
 elliptical_crosssection(double q, double a, double b)
 {
-    double sum=0.0;
+    SAS_ACC sum=0.0;
 
     for(int i=0;i<GAUSS_N;i++) {
         const double zi = ( GAUSS_Z[i] + 1.0 )*M_PI_4;
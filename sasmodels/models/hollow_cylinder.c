@@ -73,8 +73,8 @@ Fq(double q, double *F1, double *F2, double radius, double thickness, double len
     const double lower = 0.0;
     const double upper = 1.0;        //limits of numerical integral
 
-    double total_F1 = 0.0;            //initialize intergral
-    double total_F2 = 0.0;
+    SAS_ACC total_F1 = 0.0;            //initialize intergral
+    SAS_ACC total_F2 = 0.0;
     for (int i=0;i<GAUSS_N;i++) {
         const double cos_theta = 0.5*( GAUSS_Z[i] * (upper-lower) + lower + upper );
         const double sin_theta = sqrt(1.0 - cos_theta*cos_theta);
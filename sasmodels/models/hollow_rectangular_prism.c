@@ -78,8 +78,8 @@ Fq(double q,
     const double v2a = 0.0;
     const double v2b = M_PI_2;  //phi integration limits
 
-    double outer_sum_F1 = 0.0;
-    double outer_sum_F2 = 0.0;
+    SAS_ACC outer_sum_F1 = 0.0;
+    SAS_ACC outer_sum_F2 = 0.0;
     for(int i=0; i<GAUSS_N; i++) {
 
         const double theta = 0.5 * ( GAUSS_Z[i]*(v1b-v1a) + v1a + v1b );
@@ -89,8 +89,8 @@ Fq(double q,
         const double termC1 = sas_sinx_x(q * c_half * cos(theta));
         const double termC2 = sas_sinx_x(q * (c_half-thickness)*cos(theta));
 
-        double inner_sum_F1 = 0.0;
-        double inner_sum_F2 = 0.0;
+        SAS_ACC inner_sum_F1 = 0.0;
+        SAS_ACC inner_sum_F2 = 0.0;
         for(int j=0; j<GAUSS_N; j++) {
 
             const double phi = 0.5 * ( GAUSS_Z[j]*(v2b-v2a) + v2a + v2b );
@@ -70,8 +70,8 @@ Fq(double q,
     const double v2a = 0.0;
     const double v2b = M_PI_2;  //phi integration limits
 
-    double outer_sum_F1 = 0.0;
-    double outer_sum_F2 = 0.0;
+    SAS_ACC outer_sum_F1 = 0.0;
+    SAS_ACC outer_sum_F2 = 0.0;
     for(int i=0; i<GAUSS_N; i++) {
         const double theta = 0.5 * ( GAUSS_Z[i]*(v1b-v1a) + v1a + v1b );
 
@@ -84,8 +84,8 @@ Fq(double q,
         const double termAL_theta = 8.0 * cos_c / (q*q*sin_theta*sin_theta);
         const double termAT_theta = 8.0 * sin_c / (q*q*sin_theta*cos_theta);
 
-        double inner_sum_F1 = 0.0;
-        double inner_sum_F2 = 0.0;
+        SAS_ACC inner_sum_F1 = 0.0;
+        SAS_ACC inner_sum_F2 = 0.0;
         for(int j=0; j<GAUSS_N; j++) {
             const double phi = 0.5 * ( GAUSS_Z[j]*(v2b-v2a) + v2a + v2b );
 
@@ -120,7 +120,7 @@ parameters = [
      "Solvent scattering length density"],
     ]
 
-source = ["lamellar_hg_stack_caille.c"]
+source = ["lib/lattice_sum.c", "lamellar_hg_stack_caille.c"]
 
 # No volume normalization despite having a volume parameter
 # This should perhaps be volume normalized?
@@ -150,5 +150,10 @@ def random():
 tests = [[{'scale': 1.0, 'background': 0.0, 'length_tail': 10.0, 'length_head': 2.0,
            'Nlayers': 30.0, 'd_spacing': 40., 'Caille_parameter': 0.001, 'sld': 0.4,
            'sld_head': 2.0, 'sld_solvent': 6.0, 'length_tail_pd': 0.0,
-           'length_head_pd': 0.0, 'd_spacing_pd': 0.0}, [0.001], [6838238.571488]]]
+           'length_head_pd': 0.0, 'd_spacing_pd': 0.0}, [0.001], [6838238.571488]],
+         # Large stack, from the term by term sum of the layers
+         [{'scale': 1.0, 'background': 0.0, 'Nlayers': 400.0},
+          [0.001, 0.0314, 0.1575, 0.5],
+          [1574583.7096, 0.053729565499, 5.6627450255, 0.00021556982681]],
+        ]
 # ADDED by: RKH  ON: 18Mar2016  converted from sasview previously, now renaming everything & sorting the docs
@@ -105,7 +105,7 @@ parameters = [
     ]
 # pylint: enable=bad-whitespace, line-too-long
 
-source = ["lamellar_stack_caille.c"]
+source = ["lib/lattice_sum.c", "lamellar_stack_caille.c"]
 
 def random():
     """Return a random parameter set for the model."""
@@ -133,6 +133,13 @@ tests = [
     [{'scale': 1.0, 'background': 0.0, 'thickness': 30., 'Nlayers': 20.0,
       'd_spacing': 400., 'Caille_parameter': 0.1, 'sld': 6.3,
       'sld_solvent': 1.0, 'thickness_pd': 0.0, 'd_spacing_pd': 0.0},
-     [0.001], [28895.13397]]
+     [0.001], [28895.13397]],
+    # Large stack, against a direct sum of the layers using math.fsum
+    [{'scale': 1.0, 'background': 0.0, 'thickness': 30., 'Nlayers': 1000.0,
+      'd_spacing': 400., 'Caille_parameter': 0.05, 'sld': 6.3,
+      'sld_solvent': 1.0},
+     [0.001, 0.0157, 0.0314, 0.05, 0.1575, 0.3],
+     [828.77137747, 46560.807852, 1184.4312382, 10.146477917,
+      0.14165169244, 0.020821254012]],
     ]
 # ADDED by: RKH  ON: 18Mar2016  converted from sasview previously, now renaming everything & sorting the docs
@@ -0,0 +1,81 @@
+// Finite lattice sums for stacks of layers.
+//
+// For a stack of n layers with spacing d, where the positions of layers k
+// apart are correlated by r_k, the structure factor is
+//
+//     S(q) = 1 + (2/n) sum_{k=1}^{n-1} (n - k) r_k cos(k x),   x = q d
+//
+// Evaluated term by term this needs a cosine and an exponential per layer.
+// Instead, cos(k x) is stepped by multiplying e^{i x} by itself, and for
+// geometric r_k = r^k the sum has a closed form.  The stepped terms and the
+// sums are SAS_ACC so that they stay in double in mixed precision kernels.
+
+// Use the closed form when |1 - r e^{ix}|^2 exceeds this.  The absolute
+// error in S(q) is about 2 epsilon/|1 - r e^{ix}|^2, so closer to a Bragg
+// peak with little disorder the terms are summed directly.
+#define LATTICE_SUM_CLOSED_FORM 0.01
+// Stop the Caille sum once the remaining terms contribute less than this
+// to S(q).
+#define LATTICE_SUM_TOLERANCE 1e-15
+
+// S(q) for r_k = r^k with log_r = log(r), as in a paracrystal with gaussian
+// spacing disorder.
+static double
+lattice_sum_geometric(int n, double log_r, double x)
+{
+    if (n < 2) {
+        return 1.0;
+    }
+    const double r = exp(log_r);
+    double s, c;
+    SINCOS(x, s, c);
+    // z = r e^{ix} and w = 1 - z
+    const double zr = r*c, zi = r*s;
+    const double wr = 1.0 - zr, wi = -zi;
+    const double w2 = wr*wr + wi*wi;
+    if (w2 > LATTICE_SUM_CLOSED_FORM) {
+        // sum_{k=1}^{n-1} (n-k) z^k = ((n-1) z - n z^2 + z^{n+1})/(1 - z)^2
+        double sn, cn;
+        SINCOS((n+1)*x, sn, cn);
+        const double rn = exp((n+1)*log_r);
+        const double ar = (n-1)*zr - n*(zr*zr - zi*zi) + rn*cn;
+        const double ai = (n-1)*zi - n*(2.0*zr*zi) + rn*sn;
+        const double br = wr*wr - wi*wi, bi = 2.0*wr*wi;
+        return 1.0 + 2.0*(ar*br + ai*bi)/(w2*w2*n);
+    }
+    SAS_ACC pr = zr, pi = zi, sum = 0.0;
+    for (int k=1; k < n; k++) {
+        sum += (n-k)*pr;
+        const SAS_ACC t = pr*zr - pi*zi;
+        pi = pr*zi + pi*zr;
+        pr = t;
+    }
+    return 1.0 + 2.0*sum/n;
+}
+
+// S(q) for the Caille model, with r_k = exp(-eta (log(pi k) + gamma)).
+static double
+lattice_sum_caille(int n, double eta, double x)
+{
+    if (n < 2) {
+        return 1.0;
+    }
+    const double euler_gamma = 0.577215664901533;
+    const double scale = exp(-eta*(log(M_PI) + euler_gamma));
+    double s, c;
+    SINCOS(x, s, c);
+    SAS_ACC pr = c, pi = s, sum = 0.0;
+    for (int k=1; k < n; k++) {
+        const double power = exp(-eta*log((double)k));
+        sum += (n-k)*power*pr;
+        // For eta > 1 the rest of the sum is below (n-k) k^{1-eta}/(eta-1).
+        if (eta > 1.0 && 2.0*scale*(n-k)*k*power
+                < LATTICE_SUM_TOLERANCE*(eta - 1.0)*n) {
+            break;
+        }
+        const SAS_ACC t = pr*c - pi*s;
+        pi = pr*s + pi*c;
+        pr = t;
+    }
+    return 1.0 + 2.0*scale*sum/n;
+}
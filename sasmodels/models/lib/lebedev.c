@@ -0,0 +1,5756 @@
+// Lebedev quadrature on the positive octant of the unit sphere.
+//
+// Generated by explore/lebedev.py; do not edit.
+//
+// Orientation averages for shapes whose |F(q)| is unchanged when any of
+// qa, qb, qc changes sign need only the points with ua, ub, uc >= 0.  Points
+// on the coordinate planes carry the weight of their mirror images, and the
+// weights for each rule sum to one, so that
+//
+//     <f> = sum_k LebedevW[k] f(LebedevX[k], LebedevY[k], LebedevZ[k])
+//
+// for k in [start, end) returned by lebedev_octant.
+//
+// Orders: 17 (19 points), 41 (85 points), 65 (199 points), 89 (361 points), 131 (760 points).
+
+#define LEBEDEV_ORDERS 5
+
+constant int LebedevStart[6] = {
+    0,
+    19,
+    104,
+    303,
+    664,
+    1424,
+};
+
+// Largest q R_max for each rule.
+constant double LebedevQrMax[5] = {
+    2.8,
+    8.5,
+    16.1,
+    24.7,
+    38.5,
+};
+
+constant double LebedevX[1424] = {
+    1,
+    0,
+    0,
+    0.57735026918962573,
+    0.18511563534473621,
+    0.18511563534473621,
+    0.96512403508659406,
+    0.69042104838229224,
+    0.69042104838229224,
+    0.21595729184584844,
+    0.39568947305594188,
+    0.39568947305594188,
+    0.82876998125259227,
+    0.47836902881215021,
+    0.87815891060406615,
+    0.47836902881215021,
+    0.87815891060406615,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0.57735026918962573,
+    0.70409549382274694,
+    0.70409549382274694,
+    0.092190407076898254,
+    0.68077440664552435,
+    0.68077440664552435,
+    0.2703560883591648,
+    0.63725469392587519,
+    0.63725469392587519,
+    0.43337386877715439,
+    0.50444197078003583,
+    0.50444197078003583,
+    0.70076857537357296,
+    0.42157617840109668,
+    0.42157617840109668,
+    0.80283687733527376,
+    0.3317920736472123,
+    0.3317920736472123,
+    0.88307872793413256,
+    0.2384736701421887,
+    0.2384736701421887,
+    0.94141415822040253,
+    0.14590364491577629,
+    0.14590364491577629,
+    0.97848058376269387,
+    0.06095034115507196,
+    0.06095034115507196,
+    0.99627812975401642,
+    0.61168434420098761,
+    0.79110192962690196,
+    0.61168434420098761,
+    0.79110192962690196,
+    0,
+    0,
+    0.39647553481998582,
+    0.91804528771145399,
+    0.39647553481998582,
+    0.91804528771145399,
+    0,
+    0,
+    0.17247820099077241,
+    0.98501333502800192,
+    0.17247820099077241,
+    0.98501333502800192,
+    0,
+    0,
+    0.56102638086220602,
+    0.35182809277335192,
+    0.74931061190411585,
+    0.74931061190411585,
+    0.56102638086220602,
+    0.35182809277335192,
+    0.47423928425519801,
+    0.26347166559379498,
+    0.84004748835905041,
+    0.84004748835905041,
+    0.47423928425519801,
+    0.26347166559379498,
+    0.59841264978853803,
+    0.18166408403602091,
+    0.78032074247992034,
+    0.78032074247992034,
+    0.59841264978853803,
+    0.18166408403602091,
+    0.37910354076955632,
+    0.17207952256568779,
+    0.9092134750923736,
+    0.9092134750923736,
+    0.37910354076955632,
+    0.17207952256568779,
+    0.27786731905862438,
+    0.082130215819325114,
+    0.95710207431007255,
+    0.95710207431007255,
+    0.27786731905862438,
+    0.082130215819325114,
+    0.50335642710751172,
+    0.089992058420748755,
+    0.85937985589072119,
+    0.85937985589072119,
+    0.50335642710751172,
+    0.089992058420748755,
+    1,
+    0,
+    0,
+    0.57735026918962573,
+    0.032292906634138543,
+    0.032292906634138543,
+    0.99895662386423845,
+    0.080367332714622222,
+    0.080367332714622222,
+    0.99352009726259405,
+    0.1354289960531653,
+    0.1354289960531653,
+    0.98148763316511711,
+    0.19389638611144261,
+    0.19389638611144261,
+    0.96166958094027533,
+    0.25373437150112749,
+    0.25373437150112749,
+    0.9334011664005224,
+    0.31352514347525701,
+    0.31352514347525701,
+    0.89632804754600814,
+    0.37215583393753382,
+    0.37215583393753382,
+    0.85029410825461882,
+    0.42868095751956958,
+    0.42868095751956958,
+    0.79527685325313602,
+    0.48225101282829941,
+    0.48225101282829941,
+    0.7313466491699806,
+    0.53206793335662628,
+    0.53206793335662628,
+    0.65864059136012676,
+    0.61729981953942736,
+    0.61729981953942736,
+    0.48773134571522136,
+    0.65106798491274809,
+    0.65106798491274809,
+    0.39015504359588543,
+    0.67773152516873603,
+    0.67773152516873603,
+    0.28523667293130073,
+    0.69631094106487412,
+    0.69631094106487412,
+    0.17407511799995667,
+    0.70589350098317494,
+    0.70589350098317494,
+    0.058555363028785182,
+    0.99555461940918566,
+    0.094185985013862425,
+    0.99555461940918566,
+    0.094185985013862425,
+    0,
+    0,
+    0.97341159017942092,
+    0.22906303958598634,
+    0.97341159017942092,
+    0.22906303958598634,
+    0,
+    0,
+    0.92756937323886257,
+    0.37365098398005542,
+    0.92756937323886257,
+    0.37365098398005542,
+    0,
+    0,
+    0.8568022422795103,
+    0.51564514700014707,
+    0.8568022422795103,
+    0.51564514700014707,
+    0,
+    0,
+    0.76234955537193716,
+    0.64716547762083976,
+    0.76234955537193716,
+    0.64716547762083976,
+    0,
+    0,
+    0.5707522908892223,
+    0.43870280398895012,
+    0.69410494323044358,
+    0.69410494323044358,
+    0.5707522908892223,
+    0.43870280398895012,
+    0.51964633884030831,
+    0.38589084147626168,
+    0.76227025456501074,
+    0.76227025456501074,
+    0.51964633884030831,
+    0.38589084147626168,
+    0.4646337531215351,
+    0.33019373723438539,
+    0.82163712875659778,
+    0.82163712875659778,
+    0.4646337531215351,
+    0.33019373723438539,
+    0.40639016975576908,
+    0.27254235735637772,
+    0.87210532240808258,
+    0.87210532240808258,
+    0.40639016975576908,
+    0.27254235735637772,
+    0.34563294666430872,
+    0.21395102374952499,
+    0.91365355885952593,
+    0.91365355885952593,
+    0.34563294666430872,
+    0.21395102374952499,
+    0.28313951210503319,
+    0.1555922309786647,
+    0.9463736441511913,
+    0.9463736441511913,
+    0.28313951210503319,
+    0.1555922309786647,
+    0.21976820229253299,
+    0.098928789796860969,
+    0.97052307124067727,
+    0.97052307124067727,
+    0.21976820229253299,
+    0.098928789796860969,
+    0.1564696098650355,
+    0.0459864291067551,
+    0.98661163054501488,
+    0.98661163054501488,
+    0.1564696098650355,
+    0.0459864291067551,
+    0.60273566737212947,
+    0.3376625140173426,
+    0.72297561639723473,
+    0.72297561639723473,
+    0.60273566737212947,
+    0.3376625140173426,
+    0.54960323202550965,
+    0.28223013097279881,
+    0.78630937964530889,
+    0.78630937964530889,
+    0.54960323202550965,
+    0.28223013097279881,
+    0.49217077552345673,
+    0.224863234259254,
+    0.84095448961231367,
+    0.84095448961231367,
+    0.49217077552345673,
+    0.224863234259254,
+    0.43094229985984828,
+    0.16662247234564789,
+    0.8868628337578075,
+    0.8868628337578075,
+    0.43094229985984828,
+    0.16662247234564789,
+    0.36641081823136717,
+    0.1086964901822169,
+    0.92408234768611786,
+    0.92408234768611786,
+    0.36641081823136717,
+    0.1086964901822169,
+    0.29901890577584361,
+    0.052519897841200848,
+    0.9528007946676823,
+    0.9528007946676823,
+    0.29901890577584361,
+    0.052519897841200848,
+    0.62687240131449984,
+    0.2297523657550023,
+    0.74447622050685558,
+    0.74447622050685558,
+    0.62687240131449984,
+    0.2297523657550023,
+    0.57073241448346068,
+    0.17230806070938001,
+    0.80285393644949632,
+    0.80285393644949632,
+    0.57073241448346068,
+    0.17230806070938001,
+    0.50963609019603651,
+    0.1140238465390513,
+    0.85280104244198507,
+    0.85280104244198507,
+    0.50963609019603651,
+    0.1140238465390513,
+    0.44387299383124562,
+    0.056115220958825367,
+    0.8943309495505728,
+    0.8943309495505728,
+    0.44387299383124562,
+    0.056115220958825367,
+    0.64199784710823893,
+    0.11641744231408729,
+    0.75781643122423281,
+    0.75781643122423281,
+    0.64199784710823893,
+    0.11641744231408729,
+    0.58172180618026115,
+    0.057975895314452193,
+    0.81131900987026206,
+    0.81131900987026206,
+    0.58172180618026115,
+    0.057975895314452193,
+    1,
+    0,
+    0,
+    0.57735026918962573,
+    0.020655625388187032,
+    0.020655625388187032,
+    0.99957325408378439,
+    0.052509181730223793,
+    0.052509181730223793,
+    0.99723897420229457,
+    0.089934800820383756,
+    0.089934800820383756,
+    0.99187875428541961,
+    0.13060239244360189,
+    0.13060239244360189,
+    0.98279500923438501,
+    0.17320603885314181,
+    0.17320603885314181,
+    0.96953562915944858,
+    0.21687270848202489,
+    0.21687270848202489,
+    0.95180484167256751,
+    0.2609528309173586,
+    0.2609528309173586,
+    0.92941230897402738,
+    0.30492529279389519,
+    0.30492529279389519,
+    0.90224227989443873,
+    0.34834841380844039,
+    0.34834841380844039,
+    0.87023374170063472,
+    0.39083215491064061,
+    0.39083215491064061,
+    0.83336693801458794,
+    0.43202100718948139,
+    0.43202100718948139,
+    0.79165377450876351,
+    0.47158247958900529,
+    0.47158247958900529,
+    0.74513081394435077,
+    0.50919847940784535,
+    0.50919847940784535,
+    0.6938543198233158,
+    0.54455801456508035,
+    0.54455801456508035,
+    0.63789743497358209,
+    0.60725757968417682,
+    0.60725757968417682,
+    0.51232456883525634,
+    0.63394845057558025,
+    0.63394845057558025,
+    0.44296582715333949,
+    0.65707182574869583,
+    0.65707182574869583,
+    0.36947697034395932,
+    0.67625573300907094,
+    0.67625573300907094,
+    0.29215812010746578,
+    0.69111616969237899,
+    0.69111616969237899,
+    0.2114636611322844,
+    0.70128419116599605,
+    0.70128419116599605,
+    0.12806625801244212,
+    0.70645592724100204,
+    0.70645592724100204,
+    0.042895754243421923,
+    0.061235549898947653,
+    0.99812334279315074,
+    0.061235549898947653,
+    0.99812334279315074,
+    0,
+    0,
+    0.15330703483123931,
+    0.98817860383194556,
+    0.15330703483123931,
+    0.98817860383194556,
+    0,
+    0,
+    0.2563902605244206,
+    0.96657334657449545,
+    0.2563902605244206,
+    0.96657334657449545,
+    0,
+    0,
+    0.36293469916633608,
+    0.93181457605096585,
+    0.36293469916633608,
+    0.93181457605096585,
+    0,
+    0,
+    0.4683949968987538,
+    0.88351917176720984,
+    0.4683949968987538,
+    0.88351917176720984,
+    0,
+    0,
+    0.56944792406579525,
+    0.8220274093831399,
+    0.56944792406579525,
+    0.8220274093831399,
+    0,
+    0,
+    0.66344654309939555,
+    0.74822368610560697,
+    0.66344654309939555,
+    0.74822368610560697,
+    0,
+    0,
+    0.10339585735523051,
+    0.03034544009063584,
+    0.99417727340121909,
+    0.99417727340121909,
+    0.10339585735523051,
+    0.03034544009063584,
+    0.1473521412414395,
+    0.066188030442471346,
+    0.98686700780688252,
+    0.98686700780688252,
+    0.1473521412414395,
+    0.066188030442471346,
+    0.19245521587059669,
+    0.10544311289877149,
+    0.97562428210168017,
+    0.97562428210168017,
+    0.19245521587059669,
+    0.10544311289877149,
+    0.23810943628903281,
+    0.14682635512388581,
+    0.96007599584155501,
+    0.96007599584155501,
+    0.23810943628903281,
+    0.14682635512388581,
+    0.28381217079367599,
+    0.18944861081878861,
+    0.93997865697483385,
+    0.93997865697483385,
+    0.28381217079367599,
+    0.18944861081878861,
+    0.3291323133373415,
+    0.23263742387615791,
+    0.91517853412843708,
+    0.91517853412843708,
+    0.3291323133373415,
+    0.23263742387615791,
+    0.37368969787414602,
+    0.27584858084857677,
+    0.88558656840907179,
+    0.88558656840907179,
+    0.37368969787414602,
+    0.27584858084857677,
+    0.41714060407600129,
+    0.31861793319969212,
+    0.85116175259151849,
+    0.85116175259151849,
+    0.41714060407600129,
+    0.31861793319969212,
+    0.45916779852569151,
+    0.36053297963037939,
+    0.8118995648452525,
+    0.8118995648452525,
+    0.45916779852569151,
+    0.36053297963037939,
+    0.49947338317184181,
+    0.40121472535865088,
+    0.76782360191534671,
+    0.76782360191534671,
+    0.49947338317184181,
+    0.40121472535865088,
+    0.53777318304450961,
+    0.44030500255706922,
+    0.71897949089066204,
+    0.71897949089066204,
+    0.53777318304450961,
+    0.44030500255706922,
+    0.57379178300013312,
+    0.4774565904277483,
+    0.66543083338438536,
+    0.66543083338438536,
+    0.57379178300013312,
+    0.4774565904277483,
+    0.2027323586271389,
+    0.035441225049761473,
+    0.97859261714589352,
+    0.97859261714589352,
+    0.2027323586271389,
+    0.035441225049761473,
+    0.25169423751872733,
+    0.074183043886463282,
+    0.96495952599039381,
+    0.96495952599039381,
+    0.25169423751872733,
+    0.074183043886463282,
+    0.30002279952571809,
+    0.1150502745727186,
+    0.94696871864148335,
+    0.94696871864148335,
+    0.30002279952571809,
+    0.1150502745727186,
+    0.34748066910463421,
+    0.15719633712093639,
+    0.92441684114600409,
+    0.92441684114600409,
+    0.34748066910463421,
+    0.15719633712093639,
+    0.39381031803592093,
+    0.19996318772471,
+    0.89717788479399074,
+    0.89717788479399074,
+    0.39381031803592093,
+    0.19996318772471,
+    0.43875195904557029,
+    0.24280734578465349,
+    0.8651828195628285,
+    0.8651828195628285,
+    0.43875195904557029,
+    0.24280734578465349,
+    0.48205039600777871,
+    0.28525751329061549,
+    0.82840543625690799,
+    0.82840543625690799,
+    0.48205039600777871,
+    0.28525751329061549,
+    0.52345737784751012,
+    0.32688842086746389,
+    0.78685216774168254,
+    0.78685216774168254,
+    0.52345737784751012,
+    0.32688842086746389,
+    0.56273186472352821,
+    0.36730333216759392,
+    0.74055459663914236,
+    0.74055459663914236,
+    0.56273186472352821,
+    0.36730333216759392,
+    0.59963906071569539,
+    0.40612115518302899,
+    0.68956406821759553,
+    0.68956406821759553,
+    0.59963906071569539,
+    0.40612115518302899,
+    0.30847807537919469,
+    0.038601255231000588,
+    0.95044790499266141,
+    0.95044790499266141,
+    0.30847807537919469,
+    0.038601255231000588,
+    0.35899882759202228,
+    0.079289389871048666,
+    0.9299639963146048,
+    0.9299639963146048,
+    0.35899882759202228,
+    0.079289389871048666,
+    0.4078628415881973,
+    0.1212614643030087,
+    0.90495500425528963,
+    0.90495500425528963,
+    0.4078628415881973,
+    0.1212614643030087,
+    0.45492872588897348,
+    0.16387708273826929,
+    0.87531945946278933,
+    0.87531945946278933,
+    0.45492872588897348,
+    0.16387708273826929,
+    0.50002785129572791,
+    0.20659657982601759,
+    0.84100535142932908,
+    0.84100535142932908,
+    0.50002785129572791,
+    0.20659657982601759,
+    0.54297850449281992,
+    0.2489436378852235,
+    0.80199838454650985,
+    0.80199838454650985,
+    0.54297850449281992,
+    0.2489436378852235,
+    0.58359398504917115,
+    0.29048113689468907,
+    0.75831310797242368,
+    0.75831310797242368,
+    0.58359398504917115,
+    0.29048113689468907,
+    0.62168703534448555,
+    0.33079419576666091,
+    0.70998621826882835,
+    0.70998621826882835,
+    0.62168703534448555,
+    0.33079419576666091,
+    0.41511046627090908,
+    0.040648291460525537,
+    0.90886248530439884,
+    0.90886248530439884,
+    0.41511046627090908,
+    0.040648291460525537,
+    0.46498042750092178,
+    0.082584245472947557,
+    0.88146074469639546,
+    0.88146074469639546,
+    0.46498042750092178,
+    0.082584245472947557,
+    0.51246957570096618,
+    0.12518419620272889,
+    0.84953154797332187,
+    0.84953154797332187,
+    0.51246957570096618,
+    0.12518419620272889,
+    0.55747111006062244,
+    0.16791075059763311,
+    0.81303870835373937,
+    0.81303870835373937,
+    0.55747111006062244,
+    0.16791075059763311,
+    0.59985973332872267,
+    0.21028050573587151,
+    0.7719782440187416,
+    0.7719782440187416,
+    0.59985973332872267,
+    0.21028050573587151,
+    0.63950071485166005,
+    0.25184180877741069,
+    0.72637079997473597,
+    0.72637079997473597,
+    0.63950071485166005,
+    0.25184180877741069,
+    0.51884562247462518,
+    0.041943216760775177,
+    0.85383838436010673,
+    0.85383838436010673,
+    0.51884562247462518,
+    0.041943216760775177,
+    0.56641907079427778,
+    0.084576615519214984,
+    0.81976596193539397,
+    0.81976596193539397,
+    0.56641907079427778,
+    0.084576615519214984,
+    0.61104643532831526,
+    0.1273652932519396,
+    0.78128121438276399,
+    0.78128121438276399,
+    0.61104643532831526,
+    0.1273652932519396,
+    0.65264303020515635,
+    0.1698173239076354,
+    0.73838956630323582,
+    0.73838956630323582,
+    0.65264303020515635,
+    0.1698173239076354,
+    0.61675518803775475,
+    0.042663988515488638,
+    0.78599797844044361,
+    0.78599797844044361,
+    0.61675518803775475,
+    0.042663988515488638,
+    0.66071954183553827,
+    0.085519258142383495,
+    0.74574536104719602,
+    0.74574536104719602,
+    0.66071954183553827,
+    0.085519258142383495,
+    1,
+    0,
+    0,
+    0,
+    0.70710678118654757,
+    0.70710678118654757,
+    0.57735026918962573,
+    0.01182361662400277,
+    0.01182361662400277,
+    0.99986019231683443,
+    0.030621450091389581,
+    0.030621450091389581,
+    0.99906188676608065,
+    0.053297940368342428,
+    0.053297940368342428,
+    0.99715528334607206,
+    0.078481655328622196,
+    0.078481655328622196,
+    0.99382154311212167,
+    0.1054038157636201,
+    0.1054038157636201,
+    0.98882762463684115,
+    0.13355777977662109,
+    0.13355777977662109,
+    0.98200032531678882,
+    0.1625769955502252,
+    0.1625769955502252,
+    0.97320986484710692,
+    0.1921787193412792,
+    0.1921787193412792,
+    0.96235891416076758,
+    0.22213405346905479,
+    0.22213405346905479,
+    0.94937501788219292,
+    0.2522504912791132,
+    0.2522504912791132,
+    0.93420521262669687,
+    0.28236108606796972,
+    0.28236108606796972,
+    0.91681210405896862,
+    0.31231739662675601,
+    0.31231739662675601,
+    0.89717093551260962,
+    0.34198470369537892,
+    0.34198470369537892,
+    0.87526734480201407,
+    0.37123864569997578,
+    0.37123864569997578,
+    0.85109560912843141,
+    0.3999627649876828,
+    0.3999627649876828,
+    0.82465724591906386,
+    0.42804664586480928,
+    0.42804664586480928,
+    0.79595988462219192,
+    0.45538443601857109,
+    0.45538443601857109,
+    0.76501635986696115,
+    0.48187360944378338,
+    0.48187360944378338,
+    0.73184400594883625,
+    0.50741387092606294,
+    0.50741387092606294,
+    0.6964641607316614,
+    0.53190613045707069,
+    0.53190613045707069,
+    0.65890191740832815,
+    0.55525149786772865,
+    0.55525149786772865,
+    0.61918619835336075,
+    0.59810090252461834,
+    0.59810090252461834,
+    0.53343286437795889,
+    0.6173990192228116,
+    0.6173990192228116,
+    0.48748015562217573,
+    0.63513652394111308,
+    0.63513652394111308,
+    0.43954885042734415,
+    0.65120102282271997,
+    0.65120102282271997,
+    0.38971073342838108,
+    0.665475836394812,
+    0.665475836394812,
+    0.33805890366806024,
+    0.67784104148533697,
+    0.67784104148533697,
+    0.2847157265697618,
+    0.68817608874841096,
+    0.68817608874841096,
+    0.2298419930079757,
+    0.69636452670945981,
+    0.69636452670945981,
+    0.17364588069234502,
+    0.70230106171535789,
+    0.70230106171535789,
+    0.11638916370075933,
+    0.70590046366287529,
+    0.70590046366287529,
+    0.058387248617102441,
+    0.035524703124725748,
+    0.9993687985262999,
+    0.035524703124725748,
+    0.9993687985262999,
+    0,
+    0,
+    0.091511766208412837,
+    0.99580399509412332,
+    0.091511766208412837,
+    0.99580399509412332,
+    0,
+    0,
+    0.15661979300689799,
+    0.98765896970486544,
+    0.15661979300689799,
+    0.98765896970486544,
+    0,
+    0,
+    0.2265467599271907,
+    0.97400029033183133,
+    0.2265467599271907,
+    0.97400029033183133,
+    0,
+    0,
+    0.29882423185813611,
+    0.95430816744613212,
+    0.29882423185813611,
+    0.95430816744613212,
+    0,
+    0,
+    0.37174824197038858,
+    0.92833358475923167,
+    0.37174824197038858,
+    0.92833358475923167,
+    0,
+    0,
+    0.44400944917588892,
+    0.89602210298771301,
+    0.44400944917588892,
+    0.89602210298771301,
+    0,
+    0,
+    0.51453370967566425,
+    0.8574701520212813,
+    0.51453370967566425,
+    0.8574701520212813,
+    0,
+    0,
+    0.58240536728602299,
+    0.81289851036672023,
+    0.58240536728602299,
+    0.81289851036672023,
+    0,
+    0,
+    0.64682839610433696,
+    0.76263557876163302,
+    0.64682839610433696,
+    0.76263557876163302,
+    0,
+    0,
+    0.060959642591043729,
+    0.017878282753429311,
+    0.99798010450156804,
+    0.99798010450156804,
+    0.060959642591043729,
+    0.017878282753429311,
+    0.088119622709593878,
+    0.039538887407920963,
+    0.99532487584509943,
+    0.99532487584509943,
+    0.088119622709593878,
+    0.039538887407920963,
+    0.1165936722428831,
+    0.063781217977229895,
+    0.99112959386059107,
+    0.99112959386059107,
+    0.1165936722428831,
+    0.063781217977229895,
+    0.14602328570317849,
+    0.089858908137450372,
+    0.98519164463610487,
+    0.98519164463610487,
+    0.14602328570317849,
+    0.089858908137450372,
+    0.1761197110181755,
+    0.1172606510576162,
+    0.97735959968909003,
+    0.97735959968909003,
+    0.1761197110181755,
+    0.1172606510576162,
+    0.20664711904637181,
+    0.14561028769709949,
+    0.96751982527832603,
+    0.96751982527832603,
+    0.20664711904637181,
+    0.14561028769709949,
+    0.23740760263281521,
+    0.17461538230117751,
+    0.95558730552260518,
+    0.95558730552260518,
+    0.23740760263281521,
+    0.17461538230117751,
+    0.26823054743370511,
+    0.20403830702955841,
+    0.94149919951528716,
+    0.94149919951528716,
+    0.26823054743370511,
+    0.20403830702955841,
+    0.29896533121423691,
+    0.23367886340036981,
+    0.92521020289006384,
+    0.92521020289006384,
+    0.29896533121423691,
+    0.23367886340036981,
+    0.3294762752772209,
+    0.26336327526542191,
+    0.90668912493253084,
+    0.90668912493253084,
+    0.3294762752772209,
+    0.26336327526542191,
+    0.35963908872760858,
+    0.29293690980516007,
+    0.88591630120061504,
+    0.88591630120061504,
+    0.35963908872760858,
+    0.29293690980516007,
+    0.38933830463988123,
+    0.32225927852755121,
+    0.86288159207567128,
+    0.86288159207567128,
+    0.38933830463988123,
+    0.32225927852755121,
+    0.41846537893583469,
+    0.3512004791195743,
+    0.83758280193558765,
+    0.83758280193558765,
+    0.41846537893583469,
+    0.3512004791195743,
+    0.44691723190761662,
+    0.37963856776845373,
+    0.81002441054992336,
+    0.81002441054992336,
+    0.44691723190761662,
+    0.37963856776845373,
+    0.47459508132769762,
+    0.40745753782638788,
+    0.78021654920157502,
+    0.78021654920157502,
+    0.47459508132769762,
+    0.40745753782638788,
+    0.50140346014102621,
+    0.43454569060278281,
+    0.74817418622748333,
+    0.74817418622748333,
+    0.50140346014102621,
+    0.43454569060278281,
+    0.52724934045512395,
+    0.4607942515205134,
+    0.71391651525601141,
+    0.71391651525601141,
+    0.52724934045512395,
+    0.4607942515205134,
+    0.55204130518463657,
+    0.48609612841817201,
+    0.67746656840533992,
+    0.67746656840533992,
+    0.55204130518463657,
+    0.48609612841817201,
+    0.57568872375030766,
+    0.51034473953427895,
+    0.63885110955247693,
+    0.63885110955247693,
+    0.57568872375030766,
+    0.51034473953427895,
+    0.1225039430588352,
+    0.02136455922655793,
+    0.99223804580558816,
+    0.99223804580558816,
+    0.1225039430588352,
+    0.02136455922655793,
+    0.1539113217321372,
+    0.045209261661371881,
+    0.98704986079868329,
+    0.98704986079868329,
+    0.1539113217321372,
+    0.045209261661371881,
+    0.18562130986377121,
+    0.070864681778648186,
+    0.98006271544267454,
+    0.98006271544267454,
+    0.18562130986377121,
+    0.070864681778648186,
+    0.2174998728035131,
+    0.097852394887729177,
+    0.97114299366529522,
+    0.97114299366529522,
+    0.2174998728035131,
+    0.097852394887729177,
+    0.24941283369383299,
+    0.12581063962672101,
+    0.96019004438992583,
+    0.96019004438992583,
+    0.24941283369383299,
+    0.12581063962672101,
+    0.28123215621434799,
+    0.15445291250470011,
+    0.94712869882072726,
+    0.94712869882072726,
+    0.28123215621434799,
+    0.15445291250470011,
+    0.31283722764561112,
+    0.18354335122027529,
+    0.93190380792324201,
+    0.93190380792324201,
+    0.31283722764561112,
+    0.18354335122027529,
+    0.3441145160177973,
+    0.21288132586195849,
+    0.91447621126254119,
+    0.91447621126254119,
+    0.3441145160177973,
+    0.21288132586195849,
+    0.374956771485351,
+    0.24229137348808291,
+    0.89481970801415667,
+    0.89481970801415667,
+    0.374956771485351,
+    0.24229137348808291,
+    0.40526217320156099,
+    0.2716163748391453,
+    0.87291873384135188,
+    0.87291873384135188,
+    0.40526217320156099,
+    0.2716163748391453,
+    0.43493354535223849,
+    0.300712767124028,
+    0.84876654199841217,
+    0.84876654199841217,
+    0.43493354535223849,
+    0.300712767124028,
+    0.46387766415249648,
+    0.32944706772164789,
+    0.82236375301324627,
+    0.82236375301324627,
+    0.46387766415249648,
+    0.32944706772164789,
+    0.49200464104626868,
+    0.3576932543699155,
+    0.79371718449784823,
+    0.79371718449784823,
+    0.49200464104626868,
+    0.3576932543699155,
+    0.51922735548617038,
+    0.3853307059757764,
+    0.76283890851676395,
+    0.76283890851676395,
+    0.51922735548617038,
+    0.3853307059757764,
+    0.54546090811365222,
+    0.41224250444526939,
+    0.7297455140311051,
+    0.7297455140311051,
+    0.54546090811365222,
+    0.41224250444526939,
+    0.57062206614241395,
+    0.4383139587781027,
+    0.69445758054155504,
+    0.69445758054155504,
+    0.57062206614241395,
+    0.4383139587781027,
+    0.59462867551815179,
+    0.46343125363005527,
+    0.65699939985543665,
+    0.65699939985543665,
+    0.59462867551815179,
+    0.46343125363005527,
+    0.19053707909242951,
+    0.023713115377819789,
+    0.98139355492585312,
+    0.98139355492585312,
+    0.19053707909242951,
+    0.023713115377819789,
+    0.22425187177480091,
+    0.049178780592548058,
+    0.97328954866726491,
+    0.97328954866726491,
+    0.22425187177480091,
+    0.049178780592548058,
+    0.25771908080259359,
+    0.075954989604951423,
+    0.9632298349534123,
+    0.9632298349534123,
+    0.25771908080259359,
+    0.075954989604951423,
+    0.29087245349271867,
+    0.10369910831911,
+    0.95112549683674641,
+    0.95112549683674641,
+    0.29087245349271867,
+    0.10369910831911,
+    0.32363540200562191,
+    0.1321348584450234,
+    0.9369100841342104,
+    0.9369100841342104,
+    0.32363540200562191,
+    0.1321348584450234,
+    0.35592673593045432,
+    0.16103165713147891,
+    0.92053515090483229,
+    0.92053515090483229,
+    0.35592673593045432,
+    0.16103165713147891,
+    0.38766371236769559,
+    0.19019120803957071,
+    0.90196682339083034,
+    0.90196682339083034,
+    0.38766371236769559,
+    0.19019120803957071,
+    0.41876367052188418,
+    0.219438495013795,
+    0.88118314507094353,
+    0.88118314507094353,
+    0.41876367052188418,
+    0.219438495013795,
+    0.4491449019883107,
+    0.24861553347638579,
+    0.85817199530872768,
+    0.85817199530872768,
+    0.4491449019883107,
+    0.24861553347638579,
+    0.47872709324254448,
+    0.27757689318123352,
+    0.83292943192529711,
+    0.83292943192529711,
+    0.47872709324254448,
+    0.27757689318123352,
+    0.50743151530555741,
+    0.30618637865911202,
+    0.80545835323641946,
+    0.80545835323641946,
+    0.50743151530555741,
+    0.30618637865911202,
+    0.5351810507738336,
+    0.33431447181525559,
+    0.77576741155290996,
+    0.77576741155290996,
+    0.5351810507738336,
+    0.33431447181525559,
+    0.56190010259753809,
+    0.3618362729028427,
+    0.74387014075889324,
+    0.74387014075889324,
+    0.56190010259753809,
+    0.3618362729028427,
+    0.58751440352680462,
+    0.38862975836204078,
+    0.70978428875539701,
+    0.70978428875539701,
+    0.58751440352680462,
+    0.38862975836204078,
+    0.61195073087344953,
+    0.41457422777920311,
+    0.67353137465505519,
+    0.67353137465505519,
+    0.61195073087344953,
+    0.41457422777920311,
+    0.26197338701194628,
+    0.02540047186389353,
+    0.96474077374524847,
+    0.96474077374524847,
+    0.26197338701194628,
+    0.02540047186389353,
+    0.29681497432379489,
+    0.052081070185439893,
+    0.95351372991976591,
+    0.95351372991976591,
+    0.29681497432379489,
+    0.052081070185439893,
+    0.33104515048604882,
+    0.079718284708855988,
+    0.94024151334789885,
+    0.94024151334789885,
+    0.33104515048604882,
+    0.079718284708855988,
+    0.36462155673766761,
+    0.1080465999177927,
+    0.92486596467185678,
+    0.92486596467185678,
+    0.36462155673766761,
+    0.1080465999177927,
+    0.39749167852793599,
+    0.1368413849366629,
+    0.90734491835776543,
+    0.90734491835776543,
+    0.39749167852793599,
+    0.1368413849366629,
+    0.42959674037720291,
+    0.1659073184763559,
+    0.88764936902656955,
+    0.88764936902656955,
+    0.42959674037720291,
+    0.1659073184763559,
+    0.46087428544734471,
+    0.1950703730454614,
+    0.86576119257755135,
+    0.86576119257755135,
+    0.46087428544734471,
+    0.1950703730454614,
+    0.49125988589499031,
+    0.2241721144376724,
+    0.84167130616350716,
+    0.84167130616350716,
+    0.49125988589499031,
+    0.2241721144376724,
+    0.5206882758945558,
+    0.25306552554064887,
+    0.8153781693967469,
+    0.8153781693967469,
+    0.5206882758945558,
+    0.25306552554064887,
+    0.54909409140198195,
+    0.2816118409731066,
+    0.78688655460057877,
+    0.78688655460057877,
+    0.54909409140198195,
+    0.2816118409731066,
+    0.57641233020255422,
+    0.30967805045932378,
+    0.75620653967958651,
+    0.75620653967958651,
+    0.57641233020255422,
+    0.30967805045932378,
+    0.60257860042135059,
+    0.33713483663949873,
+    0.7233527025167632,
+    0.7233527025167632,
+    0.60257860042135059,
+    0.33713483663949873,
+    0.62752919647949557,
+    0.36385478276943961,
+    0.68834352224859541,
+    0.68834352224859541,
+    0.62752919647949557,
+    0.36385478276943961,
+    0.33481894798617712,
+    0.026648419355374431,
+    0.94190558646569766,
+    0.94190558646569766,
+    0.33481894798617712,
+    0.026648419355374431,
+    0.36995155458552947,
+    0.05424000066843495,
+    0.92746637113549202,
+    0.92746637113549202,
+    0.36995155458552947,
+    0.05424000066843495,
+    0.40420030714746691,
+    0.082519927154308545,
+    0.91094048835494246,
+    0.91094048835494246,
+    0.40420030714746691,
+    0.082519927154308545,
+    0.43753201001826242,
+    0.111269518248371,
+    0.89229189983892299,
+    0.89229189983892299,
+    0.43753201001826242,
+    0.111269518248371,
+    0.46990544903359471,
+    0.14029641164678161,
+    0.87149629135617812,
+    0.87149629135617812,
+    0.46990544903359471,
+    0.14029641164678161,
+    0.50127398794319522,
+    0.1694275117584291,
+    0.84853916071733115,
+    0.84853916071733115,
+    0.50127398794319522,
+    0.1694275117584291,
+    0.53158748837549663,
+    0.19850382353126891,
+    0.82341421790378266,
+    0.82341421790378266,
+    0.53158748837549663,
+    0.19850382353126891,
+    0.56079371096221164,
+    0.2273765660020893,
+    0.79612204527844155,
+    0.79612204527844155,
+    0.56079371096221164,
+    0.2273765660020893,
+    0.58883932234955205,
+    0.2559041492849764,
+    0.76666897604745476,
+    0.76666897604745476,
+    0.58883932234955205,
+    0.2559041492849764,
+    0.6156705979160163,
+    0.28394972519768991,
+    0.73506616601629227,
+    0.73506616601629227,
+    0.6156705979160163,
+    0.28394972519768991,
+    0.6412338809078123,
+    0.31137910605006902,
+    0.70132885459773109,
+    0.70132885459773109,
+    0.6412338809078123,
+    0.31137910605006902,
+    0.40760512592571668,
+    0.027577922908584629,
+    0.91274175947369085,
+    0.91274175947369085,
+    0.40760512592571668,
+    0.027577922908584629,
+    0.44237881257915201,
+    0.055841368349842928,
+    0.8950881117308378,
+    0.8950881117308378,
+    0.44237881257915201,
+    0.055841368349842928,
+    0.47604809173282581,
+    0.084577720877271431,
+    0.87534268917306979,
+    0.87534268917306979,
+    0.47604809173282581,
+    0.084577720877271431,
+    0.50858387259462967,
+    0.1135975846359248,
+    0.853485813181176,
+    0.853485813181176,
+    0.50858387259462967,
+    0.1135975846359248,
+    0.53995136373912178,
+    0.1427286904765053,
+    0.82950650733500852,
+    0.82950650733500852,
+    0.53995136373912178,
+    0.1427286904765053,
+    0.57011184336363796,
+    0.17181127400576349,
+    0.80340112781911821,
+    0.80340112781911821,
+    0.57011184336363796,
+    0.17181127400576349,
+    0.59902405306060214,
+    0.20069448559853509,
+    0.77517217913518299,
+    0.77517217913518299,
+    0.59902405306060214,
+    0.20069448559853509,
+    0.62664526851396951,
+    0.22923350905989071,
+    0.74482729929369806,
+    0.74482729929369806,
+    0.62664526851396951,
+    0.22923350905989071,
+    0.65293209714159417,
+    0.25728715123537138,
+    0.7123784095068203,
+    0.7123784095068203,
+    0.65293209714159417,
+    0.25728715123537138,
+    0.47915838346101258,
+    0.02826094197735932,
+    0.87727336829381841,
+    0.87727336829381841,
+    0.47915838346101258,
+    0.02826094197735932,
+    0.51303739527969405,
+    0.056998713596836489,
+    0.8564717027975487,
+    0.8564717027975487,
+    0.51303739527969405,
+    0.056998713596836489,
+    0.54562524296284765,
+    0.086027125285543946,
+    0.83360208010587333,
+    0.83360208010587333,
+    0.54562524296284765,
+    0.086027125285543946,
+    0.57689563296823854,
+    0.11517481372212809,
+    0.8086570292443197,
+    0.8086570292443197,
+    0.57689563296823854,
+    0.11517481372212809,
+    0.60681869446990455,
+    0.1442811654136362,
+    0.78163547600446304,
+    0.78163547600446304,
+    0.60681869446990455,
+    0.1442811654136362,
+    0.63536222480249072,
+    0.17319303216576801,
+    0.75254170442790513,
+    0.75254170442790513,
+    0.63536222480249072,
+    0.17319303216576801,
+    0.66249270357317969,
+    0.20176199587560609,
+    0.72138444309022287,
+    0.72138444309022287,
+    0.66249270357317969,
+    0.20176199587560609,
+    0.54849335080284878,
+    0.028742197559073909,
+    0.83566077459968069,
+    0.83566077459968069,
+    0.54849335080284878,
+    0.028742197559073909,
+    0.58102076821421056,
+    0.057783121237136949,
+    0.81183494492653063,
+    0.81183494492653063,
+    0.58102076821421056,
+    0.057783121237136949,
+    0.61209551971813525,
+    0.086952623714395258,
+    0.78598875053665285,
+    0.78598875053665285,
+    0.61209551971813525,
+    0.086952623714395258,
+    0.64169442842943192,
+    0.1160893767057166,
+    0.75812368195348101,
+    0.75812368195348101,
+    0.64169442842943192,
+    0.1160893767057166,
+    0.66979263917312604,
+    0.1450378826743251,
+    0.72824572302132151,
+    0.72824572302132151,
+    0.66979263917312604,
+    0.1450378826743251,
+    0.6147594390585488,
+    0.029049576223414562,
+    0.78817951902447869,
+    0.78817951902447869,
+    0.6147594390585488,
+    0.029049576223414562,
+    0.64553900263567832,
+    0.058238091526171973,
+    0.76150359209364404,
+    0.76150359209364404,
+    0.64553900263567832,
+    0.058238091526171973,
+    0.67472585883654768,
+    0.08740384899884715,
+    0.73287487513044813,
+    0.73287487513044813,
+    0.67472585883654768,
+    0.08740384899884715,
+    0.67721357503953472,
+    0.02919946135808105,
+    0.73520688601139372,
+    0.73520688601139372,
+    0.67721357503953472,
+    0.02919946135808105,
+};
+constant double LebedevY[1424] = {
+    0,
+    1,
+    0,
+    0.57735026918962573,
+    0.18511563534473621,
+    0.96512403508659406,
+    0.18511563534473621,
+    0.69042104838229224,
+    0.21595729184584844,
+    0.69042104838229224,
+    0.39568947305594188,
+    0.82876998125259227,
+    0.39568947305594188,
+    0.87815891060406615,
+    0.47836902881215021,
+    0,
+    0,
+    0.47836902881215021,
+    0.87815891060406615,
+    0,
+    1,
+    0,
+    0.57735026918962573,
+    0.70409549382274694,
+    0.092190407076898254,
+    0.70409549382274694,
+    0.68077440664552435,
+    0.2703560883591648,
+    0.68077440664552435,
+    0.63725469392587519,
+    0.43337386877715439,
+    0.63725469392587519,
+    0.50444197078003583,
+    0.70076857537357296,
+    0.50444197078003583,
+    0.42157617840109668,
+    0.80283687733527376,
+    0.42157617840109668,
+    0.3317920736472123,
+    0.88307872793413256,
+    0.3317920736472123,
+    0.2384736701421887,
+    0.94141415822040253,
+    0.2384736701421887,
+    0.14590364491577629,
+    0.97848058376269387,
+    0.14590364491577629,
+    0.06095034115507196,
+    0.99627812975401642,
+    0.06095034115507196,
+    0.79110192962690196,
+    0.61168434420098761,
+    0,
+    0,
+    0.61168434420098761,
+    0.79110192962690196,
+    0.91804528771145399,
+    0.39647553481998582,
+    0,
+    0,
+    0.39647553481998582,
+    0.91804528771145399,
+    0.98501333502800192,
+    0.17247820099077241,
+    0,
+    0,
+    0.17247820099077241,
+    0.98501333502800192,
+    0.35182809277335192,
+    0.56102638086220602,
+    0.56102638086220602,
+    0.35182809277335192,
+    0.74931061190411585,
+    0.74931061190411585,
+    0.26347166559379498,
+    0.47423928425519801,
+    0.47423928425519801,
+    0.26347166559379498,
+    0.84004748835905041,
+    0.84004748835905041,
+    0.18166408403602091,
+    0.59841264978853803,
+    0.59841264978853803,
+    0.18166408403602091,
+    0.78032074247992034,
+    0.78032074247992034,
+    0.17207952256568779,
+    0.37910354076955632,
+    0.37910354076955632,
+    0.17207952256568779,
+    0.9092134750923736,
+    0.9092134750923736,
+    0.082130215819325114,
+    0.27786731905862438,
+    0.27786731905862438,
+    0.082130215819325114,
+    0.95710207431007255,
+    0.95710207431007255,
+    0.089992058420748755,
+    0.50335642710751172,
+    0.50335642710751172,
+    0.089992058420748755,
+    0.85937985589072119,
+    0.85937985589072119,
+    0,
+    1,
+    0,
+    0.57735026918962573,
+    0.032292906634138543,
+    0.99895662386423845,
+    0.032292906634138543,
+    0.080367332714622222,
+    0.99352009726259405,
+    0.080367332714622222,
+    0.1354289960531653,
+    0.98148763316511711,
+    0.1354289960531653,
+    0.19389638611144261,
+    0.96166958094027533,
+    0.19389638611144261,
+    0.25373437150112749,
+    0.9334011664005224,
+    0.25373437150112749,
+    0.31352514347525701,
+    0.89632804754600814,
+    0.31352514347525701,
+    0.37215583393753382,
+    0.85029410825461882,
+    0.37215583393753382,
+    0.42868095751956958,
+    0.79527685325313602,
+    0.42868095751956958,
+    0.48225101282829941,
+    0.7313466491699806,
+    0.48225101282829941,
+    0.53206793335662628,
+    0.65864059136012676,
+    0.53206793335662628,
+    0.61729981953942736,
+    0.48773134571522136,
+    0.61729981953942736,
+    0.65106798491274809,
+    0.39015504359588543,
+    0.65106798491274809,
+    0.67773152516873603,
+    0.28523667293130073,
+    0.67773152516873603,
+    0.69631094106487412,
+    0.17407511799995667,
+    0.69631094106487412,
+    0.70589350098317494,
+    0.058555363028785182,
+    0.70589350098317494,
+    0.094185985013862425,
+    0.99555461940918566,
+    0,
+    0,
+    0.99555461940918566,
+    0.094185985013862425,
+    0.22906303958598634,
+    0.97341159017942092,
+    0,
+    0,
+    0.97341159017942092,
+    0.22906303958598634,
+    0.37365098398005542,
+    0.92756937323886257,
+    0,
+    0,
+    0.92756937323886257,
+    0.37365098398005542,
+    0.51564514700014707,
+    0.8568022422795103,
+    0,
+    0,
+    0.8568022422795103,
+    0.51564514700014707,
+    0.64716547762083976,
+    0.76234955537193716,
+    0,
+    0,
+    0.76234955537193716,
+    0.64716547762083976,
+    0.43870280398895012,
+    0.5707522908892223,
+    0.5707522908892223,
+    0.43870280398895012,
+    0.69410494323044358,
+    0.69410494323044358,
+    0.38589084147626168,
+    0.51964633884030831,
+    0.51964633884030831,
+    0.38589084147626168,
+    0.76227025456501074,
+    0.76227025456501074,
+    0.33019373723438539,
+    0.4646337531215351,
+    0.4646337531215351,
+    0.33019373723438539,
+    0.82163712875659778,
+    0.82163712875659778,
+    0.27254235735637772,
+    0.40639016975576908,
+    0.40639016975576908,
+    0.27254235735637772,
+    0.87210532240808258,
+    0.87210532240808258,
+    0.21395102374952499,
+    0.34563294666430872,
+    0.34563294666430872,
+    0.21395102374952499,
+    0.91365355885952593,
+    0.91365355885952593,
+    0.1555922309786647,
+    0.28313951210503319,
+    0.28313951210503319,
+    0.1555922309786647,
+    0.9463736441511913,
+    0.9463736441511913,
+    0.098928789796860969,
+    0.21976820229253299,
+    0.21976820229253299,
+    0.098928789796860969,
+    0.97052307124067727,
+    0.97052307124067727,
+    0.0459864291067551,
+    0.1564696098650355,
+    0.1564696098650355,
+    0.0459864291067551,
+    0.98661163054501488,
+    0.98661163054501488,
+    0.3376625140173426,
+    0.60273566737212947,
+    0.60273566737212947,
+    0.3376625140173426,
+    0.72297561639723473,
+    0.72297561639723473,
+    0.28223013097279881,
+    0.54960323202550965,
+    0.54960323202550965,
+    0.28223013097279881,
+    0.78630937964530889,
+    0.78630937964530889,
+    0.224863234259254,
+    0.49217077552345673,
+    0.49217077552345673,
+    0.224863234259254,
+    0.84095448961231367,
+    0.84095448961231367,
+    0.16662247234564789,
+    0.43094229985984828,
+    0.43094229985984828,
+    0.16662247234564789,
+    0.8868628337578075,
+    0.8868628337578075,
+    0.1086964901822169,
+    0.36641081823136717,
+    0.36641081823136717,
+    0.1086964901822169,
+    0.92408234768611786,
+    0.92408234768611786,
+    0.052519897841200848,
+    0.29901890577584361,
+    0.29901890577584361,
+    0.052519897841200848,
+    0.9528007946676823,
+    0.9528007946676823,
+    0.2297523657550023,
+    0.62687240131449984,
+    0.62687240131449984,
+    0.2297523657550023,
+    0.74447622050685558,
+    0.74447622050685558,
+    0.17230806070938001,
+    0.57073241448346068,
+    0.57073241448346068,
+    0.17230806070938001,
+    0.80285393644949632,
+    0.80285393644949632,
+    0.1140238465390513,
+    0.50963609019603651,
+    0.50963609019603651,
+    0.1140238465390513,
+    0.85280104244198507,
+    0.85280104244198507,
+    0.056115220958825367,
+    0.44387299383124562,
+    0.44387299383124562,
+    0.056115220958825367,
+    0.8943309495505728,
+    0.8943309495505728,
+    0.11641744231408729,
+    0.64199784710823893,
+    0.64199784710823893,
+    0.11641744231408729,
+    0.75781643122423281,
+    0.75781643122423281,
+    0.057975895314452193,
+    0.58172180618026115,
+    0.58172180618026115,
+    0.057975895314452193,
+    0.81131900987026206,
+    0.81131900987026206,
+    0,
+    1,
+    0,
+    0.57735026918962573,
+    0.020655625388187032,
+    0.99957325408378439,
+    0.020655625388187032,
+    0.052509181730223793,
+    0.99723897420229457,
+    0.052509181730223793,
+    0.089934800820383756,
+    0.99187875428541961,
+    0.089934800820383756,
+    0.13060239244360189,
+    0.98279500923438501,
+    0.13060239244360189,
+    0.17320603885314181,
+    0.96953562915944858,
+    0.17320603885314181,
+    0.21687270848202489,
+    0.95180484167256751,
+    0.21687270848202489,
+    0.2609528309173586,
+    0.92941230897402738,
+    0.2609528309173586,
+    0.30492529279389519,
+    0.90224227989443873,
+    0.30492529279389519,
+    0.34834841380844039,
+    0.87023374170063472,
+    0.34834841380844039,
+    0.39083215491064061,
+    0.83336693801458794,
+    0.39083215491064061,
+    0.43202100718948139,
+    0.79165377450876351,
+    0.43202100718948139,
+    0.47158247958900529,
+    0.74513081394435077,
+    0.47158247958900529,
+    0.50919847940784535,
+    0.6938543198233158,
+    0.50919847940784535,
+    0.54455801456508035,
+    0.63789743497358209,
+    0.54455801456508035,
+    0.60725757968417682,
+    0.51232456883525634,
+    0.60725757968417682,
+    0.63394845057558025,
+    0.44296582715333949,
+    0.63394845057558025,
+    0.65707182574869583,
+    0.36947697034395932,
+    0.65707182574869583,
+    0.67625573300907094,
+    0.29215812010746578,
+    0.67625573300907094,
+    0.69111616969237899,
+    0.2114636611322844,
+    0.69111616969237899,
+    0.70128419116599605,
+    0.12806625801244212,
+    0.70128419116599605,
+    0.70645592724100204,
+    0.042895754243421923,
+    0.70645592724100204,
+    0.99812334279315074,
+    0.061235549898947653,
+    0,
+    0,
+    0.061235549898947653,
+    0.99812334279315074,
+    0.98817860383194556,
+    0.15330703483123931,
+    0,
+    0,
+    0.15330703483123931,
+    0.98817860383194556,
+    0.96657334657449545,
+    0.2563902605244206,
+    0,
+    0,
+    0.2563902605244206,
+    0.96657334657449545,
+    0.93181457605096585,
+    0.36293469916633608,
+    0,
+    0,
+    0.36293469916633608,
+    0.93181457605096585,
+    0.88351917176720984,
+    0.4683949968987538,
+    0,
+    0,
+    0.4683949968987538,
+    0.88351917176720984,
+    0.8220274093831399,
+    0.56944792406579525,
+    0,
+    0,
+    0.56944792406579525,
+    0.8220274093831399,
+    0.74822368610560697,
+    0.66344654309939555,
+    0,
+    0,
+    0.66344654309939555,
+    0.74822368610560697,
+    0.03034544009063584,
+    0.10339585735523051,
+    0.10339585735523051,
+    0.03034544009063584,
+    0.99417727340121909,
+    0.99417727340121909,
+    0.066188030442471346,
+    0.1473521412414395,
+    0.1473521412414395,
+    0.066188030442471346,
+    0.98686700780688252,
+    0.98686700780688252,
+    0.10544311289877149,
+    0.19245521587059669,
+    0.19245521587059669,
+    0.10544311289877149,
+    0.97562428210168017,
+    0.97562428210168017,
+    0.14682635512388581,
+    0.23810943628903281,
+    0.23810943628903281,
+    0.14682635512388581,
+    0.96007599584155501,
+    0.96007599584155501,
+    0.18944861081878861,
+    0.28381217079367599,
+    0.28381217079367599,
+    0.18944861081878861,
+    0.93997865697483385,
+    0.93997865697483385,
+    0.23263742387615791,
+    0.3291323133373415,
+    0.3291323133373415,
+    0.23263742387615791,
+    0.91517853412843708,
+    0.91517853412843708,
+    0.27584858084857677,
+    0.37368969787414602,
+    0.37368969787414602,
+    0.27584858084857677,
+    0.88558656840907179,
+    0.88558656840907179,
+    0.31861793319969212,
+    0.41714060407600129,
+    0.41714060407600129,
+    0.31861793319969212,
+    0.85116175259151849,
+    0.85116175259151849,
+    0.36053297963037939,
+    0.45916779852569151,
+    0.45916779852569151,
+    0.36053297963037939,
+    0.8118995648452525,
+    0.8118995648452525,
+    0.40121472535865088,
+    0.49947338317184181,
+    0.49947338317184181,
+    0.40121472535865088,
+    0.76782360191534671,
+    0.76782360191534671,
+    0.44030500255706922,
+    0.53777318304450961,
+    0.53777318304450961,
+    0.44030500255706922,
+    0.71897949089066204,
+    0.71897949089066204,
+    0.4774565904277483,
+    0.57379178300013312,
+    0.57379178300013312,
+    0.4774565904277483,
+    0.66543083338438536,
+    0.66543083338438536,
+    0.035441225049761473,
+    0.2027323586271389,
+    0.2027323586271389,
+    0.035441225049761473,
+    0.97859261714589352,
+    0.97859261714589352,
+    0.074183043886463282,
+    0.25169423751872733,
+    0.25169423751872733,
+    0.074183043886463282,
+    0.96495952599039381,
+    0.96495952599039381,
+    0.1150502745727186,
+    0.30002279952571809,
+    0.30002279952571809,
+    0.1150502745727186,
+    0.94696871864148335,
+    0.94696871864148335,
+    0.15719633712093639,
+    0.34748066910463421,
+    0.34748066910463421,
+    0.15719633712093639,
+    0.92441684114600409,
+    0.92441684114600409,
+    0.19996318772471,
+    0.39381031803592093,
+    0.39381031803592093,
+    0.19996318772471,
+    0.89717788479399074,
+    0.89717788479399074,
+    0.24280734578465349,
+    0.43875195904557029,
+    0.43875195904557029,
+    0.24280734578465349,
+    0.8651828195628285,
+    0.8651828195628285,
+    0.28525751329061549,
+    0.48205039600777871,
+    0.48205039600777871,
+    0.28525751329061549,
+    0.82840543625690799,
+    0.82840543625690799,
+    0.32688842086746389,
+    0.52345737784751012,
+    0.52345737784751012,
+    0.32688842086746389,
+    0.78685216774168254,
+    0.78685216774168254,
+    0.36730333216759392,
+    0.56273186472352821,
+    0.56273186472352821,
+    0.36730333216759392,
+    0.74055459663914236,
+    0.74055459663914236,
+    0.40612115518302899,
+    0.59963906071569539,
+    0.59963906071569539,
+    0.40612115518302899,
+    0.68956406821759553,
+    0.68956406821759553,
+    0.038601255231000588,
+    0.30847807537919469,
+    0.30847807537919469,
+    0.038601255231000588,
+    0.95044790499266141,
+    0.95044790499266141,
+    0.079289389871048666,
+    0.35899882759202228,
+    0.35899882759202228,
+    0.079289389871048666,
+    0.9299639963146048,
+    0.9299639963146048,
+    0.1212614643030087,
+    0.4078628415881973,
+    0.4078628415881973,
+    0.1212614643030087,
+    0.90495500425528963,
+    0.90495500425528963,
+    0.16387708273826929,
+    0.45492872588897348,
+    0.45492872588897348,
+    0.16387708273826929,
+    0.87531945946278933,
+    0.87531945946278933,
+    0.20659657982601759,
+    0.50002785129572791,
+    0.50002785129572791,
+    0.20659657982601759,
+    0.84100535142932908,
+    0.84100535142932908,
+    0.2489436378852235,
+    0.54297850449281992,
+    0.54297850449281992,
+    0.2489436378852235,
+    0.80199838454650985,
+    0.80199838454650985,
+    0.29048113689468907,
+    0.58359398504917115,
+    0.58359398504917115,
+    0.29048113689468907,
+    0.75831310797242368,
+    0.75831310797242368,
+    0.33079419576666091,
+    0.62168703534448555,
+    0.62168703534448555,
+    0.33079419576666091,
+    0.70998621826882835,
+    0.70998621826882835,
+    0.040648291460525537,
+    0.41511046627090908,
+    0.41511046627090908,
+    0.040648291460525537,
+    0.90886248530439884,
+    0.90886248530439884,
+    0.082584245472947557,
+    0.46498042750092178,
+    0.46498042750092178,
+    0.082584245472947557,
+    0.88146074469639546,
+    0.88146074469639546,
+    0.12518419620272889,
+    0.51246957570096618,
+    0.51246957570096618,
+    0.12518419620272889,
+    0.84953154797332187,
+    0.84953154797332187,
+    0.16791075059763311,
+    0.55747111006062244,
+    0.55747111006062244,
+    0.16791075059763311,
+    0.81303870835373937,
+    0.81303870835373937,
+    0.21028050573587151,
+    0.59985973332872267,
+    0.59985973332872267,
+    0.21028050573587151,
+    0.7719782440187416,
+    0.7719782440187416,
+    0.25184180877741069,
+    0.63950071485166005,
+    0.63950071485166005,
+    0.25184180877741069,
+    0.72637079997473597,
+    0.72637079997473597,
+    0.041943216760775177,
+    0.51884562247462518,
+    0.51884562247462518,
+    0.041943216760775177,
+    0.85383838436010673,
+    0.85383838436010673,
+    0.084576615519214984,
+    0.56641907079427778,
+    0.56641907079427778,
+    0.084576615519214984,
+    0.81976596193539397,
+    0.81976596193539397,
+    0.1273652932519396,
+    0.61104643532831526,
+    0.61104643532831526,
+    0.1273652932519396,
+    0.78128121438276399,
+    0.78128121438276399,
+    0.1698173239076354,
+    0.65264303020515635,
+    0.65264303020515635,
+    0.1698173239076354,
+    0.73838956630323582,
+    0.73838956630323582,
+    0.042663988515488638,
+    0.61675518803775475,
+    0.61675518803775475,
+    0.042663988515488638,
+    0.78599797844044361,
+    0.78599797844044361,
+    0.085519258142383495,
+    0.66071954183553827,
+    0.66071954183553827,
+    0.085519258142383495,
+    0.74574536104719602,
+    0.74574536104719602,
+    0,
+    1,
+    0,
+    0.70710678118654757,
+    0,
+    0.70710678118654757,
+    0.57735026918962573,
+    0.01182361662400277,
+    0.99986019231683443,
+    0.01182361662400277,
+    0.030621450091389581,
+    0.99906188676608065,
+    0.030621450091389581,
+    0.053297940368342428,
+    0.99715528334607206,
+    0.053297940368342428,
+    0.078481655328622196,
+    0.99382154311212167,
+    0.078481655328622196,
+    0.1054038157636201,
+    0.98882762463684115,
+    0.1054038157636201,
+    0.13355777977662109,
+    0.98200032531678882,
+    0.13355777977662109,
+    0.1625769955502252,
+    0.97320986484710692,
+    0.1625769955502252,
+    0.1921787193412792,
+    0.96235891416076758,
+    0.1921787193412792,
+    0.22213405346905479,
+    0.94937501788219292,
+    0.22213405346905479,
+    0.2522504912791132,
+    0.93420521262669687,
+    0.2522504912791132,
+    0.28236108606796972,
+    0.91681210405896862,
+    0.28236108606796972,
+    0.31231739662675601,
+    0.89717093551260962,
+    0.31231739662675601,
+    0.34198470369537892,
+    0.87526734480201407,
+    0.34198470369537892,
+    0.37123864569997578,
+    0.85109560912843141,
+    0.37123864569997578,
+    0.3999627649876828,
+    0.82465724591906386,
+    0.3999627649876828,
+    0.42804664586480928,
+    0.79595988462219192,
+    0.42804664586480928,
+    0.45538443601857109,
+    0.76501635986696115,
+    0.45538443601857109,
+    0.48187360944378338,
+    0.73184400594883625,
+    0.48187360944378338,
+    0.50741387092606294,
+    0.6964641607316614,
+    0.50741387092606294,
+    0.53190613045707069,
+    0.65890191740832815,
+    0.53190613045707069,
+    0.55525149786772865,
+    0.61918619835336075,
+    0.55525149786772865,
+    0.59810090252461834,
+    0.53343286437795889,
+    0.59810090252461834,
+    0.6173990192228116,
+    0.48748015562217573,
+    0.6173990192228116,
+    0.63513652394111308,
+    0.43954885042734415,
+    0.63513652394111308,
+    0.65120102282271997,
+    0.38971073342838108,
+    0.65120102282271997,
+    0.665475836394812,
+    0.33805890366806024,
+    0.665475836394812,
+    0.67784104148533697,
+    0.2847157265697618,
+    0.67784104148533697,
+    0.68817608874841096,
+    0.2298419930079757,
+    0.68817608874841096,
+    0.69636452670945981,
+    0.17364588069234502,
+    0.69636452670945981,
+    0.70230106171535789,
+    0.11638916370075933,
+    0.70230106171535789,
+    0.70590046366287529,
+    0.058387248617102441,
+    0.70590046366287529,
+    0.9993687985262999,
+    0.035524703124725748,
+    0,
+    0,
+    0.035524703124725748,
+    0.9993687985262999,
+    0.99580399509412332,
+    0.091511766208412837,
+    0,
+    0,
+    0.091511766208412837,
+    0.99580399509412332,
+    0.98765896970486544,
+    0.15661979300689799,
+    0,
+    0,
+    0.15661979300689799,
+    0.98765896970486544,
+    0.97400029033183133,
+    0.2265467599271907,
+    0,
+    0,
+    0.2265467599271907,
+    0.97400029033183133,
+    0.95430816744613212,
+    0.29882423185813611,
+    0,
+    0,
+    0.29882423185813611,
+    0.95430816744613212,
+    0.92833358475923167,
+    0.37174824197038858,
+    0,
+    0,
+    0.37174824197038858,
+    0.92833358475923167,
+    0.89602210298771301,
+    0.44400944917588892,
+    0,
+    0,
+    0.44400944917588892,
+    0.89602210298771301,
+    0.8574701520212813,
+    0.51453370967566425,
+    0,
+    0,
+    0.51453370967566425,
+    0.8574701520212813,
+    0.81289851036672023,
+    0.58240536728602299,
+    0,
+    0,
+    0.58240536728602299,
+    0.81289851036672023,
+    0.76263557876163302,
+    0.64682839610433696,
+    0,
+    0,
+    0.64682839610433696,
+    0.76263557876163302,
+    0.017878282753429311,
+    0.060959642591043729,
+    0.060959642591043729,
+    0.017878282753429311,
+    0.99798010450156804,
+    0.99798010450156804,
+    0.039538887407920963,
+    0.088119622709593878,
+    0.088119622709593878,
+    0.039538887407920963,
+    0.99532487584509943,
+    0.99532487584509943,
+    0.063781217977229895,
+    0.1165936722428831,
+    0.1165936722428831,
+    0.063781217977229895,
+    0.99112959386059107,
+    0.99112959386059107,
+    0.089858908137450372,
+    0.14602328570317849,
+    0.14602328570317849,
+    0.089858908137450372,
+    0.98519164463610487,
+    0.98519164463610487,
+    0.1172606510576162,
+    0.1761197110181755,
+    0.1761197110181755,
+    0.1172606510576162,
+    0.97735959968909003,
+    0.97735959968909003,
+    0.14561028769709949,
+    0.20664711904637181,
+    0.20664711904637181,
+    0.14561028769709949,
+    0.96751982527832603,
+    0.96751982527832603,
+    0.17461538230117751,
+    0.23740760263281521,
+    0.23740760263281521,
+    0.17461538230117751,
+    0.95558730552260518,
+    0.95558730552260518,
+    0.20403830702955841,
+    0.26823054743370511,
+    0.26823054743370511,
+    0.20403830702955841,
+    0.94149919951528716,
+    0.94149919951528716,
+    0.23367886340036981,
+    0.29896533121423691,
+    0.29896533121423691,
+    0.23367886340036981,
+    0.92521020289006384,
+    0.92521020289006384,
+    0.26336327526542191,
+    0.3294762752772209,
+    0.3294762752772209,
+    0.26336327526542191,
+    0.90668912493253084,
+    0.90668912493253084,
+    0.29293690980516007,
+    0.35963908872760858,
+    0.35963908872760858,
+    0.29293690980516007,
+    0.88591630120061504,
+    0.88591630120061504,
+    0.32225927852755121,
+    0.38933830463988123,
+    0.38933830463988123,
+    0.32225927852755121,
+    0.86288159207567128,
+    0.86288159207567128,
+    0.3512004791195743,
+    0.41846537893583469,
+    0.41846537893583469,
+    0.3512004791195743,
+    0.83758280193558765,
+    0.83758280193558765,
+    0.37963856776845373,
+    0.44691723190761662,
+    0.44691723190761662,
+    0.37963856776845373,
+    0.81002441054992336,
+    0.81002441054992336,
+    0.40745753782638788,
+    0.47459508132769762,
+    0.47459508132769762,
+    0.40745753782638788,
+    0.78021654920157502,
+    0.78021654920157502,
+    0.43454569060278281,
+    0.50140346014102621,
+    0.50140346014102621,
+    0.43454569060278281,
+    0.74817418622748333,
+    0.74817418622748333,
+    0.4607942515205134,
+    0.52724934045512395,
+    0.52724934045512395,
+    0.4607942515205134,
+    0.71391651525601141,
+    0.71391651525601141,
+    0.48609612841817201,
+    0.55204130518463657,
+    0.55204130518463657,
+    0.48609612841817201,
+    0.67746656840533992,
+    0.67746656840533992,
+    0.51034473953427895,
+    0.57568872375030766,
+    0.57568872375030766,
+    0.51034473953427895,
+    0.63885110955247693,
+    0.63885110955247693,
+    0.02136455922655793,
+    0.1225039430588352,
+    0.1225039430588352,
+    0.02136455922655793,
+    0.99223804580558816,
+    0.99223804580558816,
+    0.045209261661371881,
+    0.1539113217321372,
+    0.1539113217321372,
+    0.045209261661371881,
+    0.98704986079868329,
+    0.98704986079868329,
+    0.070864681778648186,
+    0.18562130986377121,
+    0.18562130986377121,
+    0.070864681778648186,
+    0.98006271544267454,
+    0.98006271544267454,
+    0.097852394887729177,
+    0.2174998728035131,
+    0.2174998728035131,
+    0.097852394887729177,
+    0.97114299366529522,
+    0.97114299366529522,
+    0.12581063962672101,
+    0.24941283369383299,
+    0.24941283369383299,
+    0.12581063962672101,
+    0.96019004438992583,
+    0.96019004438992583,
+    0.15445291250470011,
+    0.28123215621434799,
+    0.28123215621434799,
+    0.15445291250470011,
+    0.94712869882072726,
+    0.94712869882072726,
+    0.18354335122027529,
+    0.31283722764561112,
+    0.31283722764561112,
+    0.18354335122027529,
+    0.93190380792324201,
+    0.93190380792324201,
+    0.21288132586195849,
+    0.3441145160177973,
+    0.3441145160177973,
+    0.21288132586195849,
+    0.91447621126254119,
+    0.91447621126254119,
+    0.24229137348808291,
+    0.374956771485351,
+    0.374956771485351,
+    0.24229137348808291,
+    0.89481970801415667,
+    0.89481970801415667,
+    0.2716163748391453,
+    0.40526217320156099,
+    0.40526217320156099,
+    0.2716163748391453,
+    0.87291873384135188,
+    0.87291873384135188,
+    0.300712767124028,
+    0.43493354535223849,
+    0.43493354535223849,
+    0.300712767124028,
+    0.84876654199841217,
+    0.84876654199841217,
+    0.32944706772164789,
+    0.46387766415249648,
+    0.46387766415249648,
+    0.32944706772164789,
+    0.82236375301324627,
+    0.82236375301324627,
+    0.3576932543699155,
+    0.49200464104626868,
+    0.49200464104626868,
+    0.3576932543699155,
+    0.79371718449784823,
+    0.79371718449784823,
+    0.3853307059757764,
+    0.51922735548617038,
+    0.51922735548617038,
+    0.3853307059757764,
+    0.76283890851676395,
+    0.76283890851676395,
+    0.41224250444526939,
+    0.54546090811365222,
+    0.54546090811365222,
+    0.41224250444526939,
+    0.7297455140311051,
+    0.7297455140311051,
+    0.4383139587781027,
+    0.57062206614241395,
+    0.57062206614241395,
+    0.4383139587781027,
+    0.69445758054155504,
+    0.69445758054155504,
+    0.46343125363005527,
+    0.59462867551815179,
+    0.59462867551815179,
+    0.46343125363005527,
+    0.65699939985543665,
+    0.65699939985543665,
+    0.023713115377819789,
+    0.19053707909242951,
+    0.19053707909242951,
+    0.023713115377819789,
+    0.98139355492585312,
+    0.98139355492585312,
+    0.049178780592548058,
+    0.22425187177480091,
+    0.22425187177480091,
+    0.049178780592548058,
+    0.97328954866726491,
+    0.97328954866726491,
+    0.075954989604951423,
+    0.25771908080259359,
+    0.25771908080259359,
+    0.075954989604951423,
+    0.9632298349534123,
+    0.9632298349534123,
+    0.10369910831911,
+    0.29087245349271867,
+    0.29087245349271867,
+    0.10369910831911,
+    0.95112549683674641,
+    0.95112549683674641,
+    0.1321348584450234,
+    0.32363540200562191,
+    0.32363540200562191,
+    0.1321348584450234,
+    0.9369100841342104,
+    0.9369100841342104,
+    0.16103165713147891,
+    0.35592673593045432,
+    0.35592673593045432,
+    0.16103165713147891,
+    0.92053515090483229,
+    0.92053515090483229,
+    0.19019120803957071,
+    0.38766371236769559,
+    0.38766371236769559,
+    0.19019120803957071,
+    0.90196682339083034,
+    0.90196682339083034,
+    0.219438495013795,
+    0.41876367052188418,
+    0.41876367052188418,
+    0.219438495013795,
+    0.88118314507094353,
+    0.88118314507094353,
+    0.24861553347638579,
+    0.4491449019883107,
+    0.4491449019883107,
+    0.24861553347638579,
+    0.85817199530872768,
+    0.85817199530872768,
+    0.27757689318123352,
+    0.47872709324254448,
+    0.47872709324254448,
+    0.27757689318123352,
+    0.83292943192529711,
+    0.83292943192529711,
+    0.30618637865911202,
+    0.50743151530555741,
+    0.50743151530555741,
+    0.30618637865911202,
+    0.80545835323641946,
+    0.80545835323641946,
+    0.33431447181525559,
+    0.5351810507738336,
+    0.5351810507738336,
+    0.33431447181525559,
+    0.77576741155290996,
+    0.77576741155290996,
+    0.3618362729028427,
+    0.56190010259753809,
+    0.56190010259753809,
+    0.3618362729028427,
+    0.74387014075889324,
+    0.74387014075889324,
+    0.38862975836204078,
+    0.58751440352680462,
+    0.58751440352680462,
+    0.38862975836204078,
+    0.70978428875539701,
+    0.70978428875539701,
+    0.41457422777920311,
+    0.61195073087344953,
+    0.61195073087344953,
+    0.41457422777920311,
+    0.67353137465505519,
+    0.67353137465505519,
+    0.02540047186389353,
+    0.26197338701194628,
+    0.26197338701194628,
+    0.02540047186389353,
+    0.96474077374524847,
+    0.96474077374524847,
+    0.052081070185439893,
+    0.29681497432379489,
+    0.29681497432379489,
+    0.052081070185439893,
+    0.95351372991976591,
+    0.95351372991976591,
+    0.079718284708855988,
+    0.33104515048604882,
+    0.33104515048604882,
+    0.079718284708855988,
+    0.94024151334789885,
+    0.94024151334789885,
+    0.1080465999177927,
+    0.36462155673766761,
+    0.36462155673766761,
+    0.1080465999177927,
+    0.92486596467185678,
+    0.92486596467185678,
+    0.1368413849366629,
+    0.39749167852793599,
+    0.39749167852793599,
+    0.1368413849366629,
+    0.90734491835776543,
+    0.90734491835776543,
+    0.1659073184763559,
+    0.42959674037720291,
+    0.42959674037720291,
+    0.1659073184763559,
+    0.88764936902656955,
+    0.88764936902656955,
+    0.1950703730454614,
+    0.46087428544734471,
+    0.46087428544734471,
+    0.1950703730454614,
+    0.86576119257755135,
+    0.86576119257755135,
+    0.2241721144376724,
+    0.49125988589499031,
+    0.49125988589499031,
+    0.2241721144376724,
+    0.84167130616350716,
+    0.84167130616350716,
+    0.25306552554064887,
+    0.5206882758945558,
+    0.5206882758945558,
+    0.25306552554064887,
+    0.8153781693967469,
+    0.8153781693967469,
+    0.2816118409731066,
+    0.54909409140198195,
+    0.54909409140198195,
+    0.2816118409731066,
+    0.78688655460057877,
+    0.78688655460057877,
+    0.30967805045932378,
+    0.57641233020255422,
+    0.57641233020255422,
+    0.30967805045932378,
+    0.75620653967958651,
+    0.75620653967958651,
+    0.33713483663949873,
+    0.60257860042135059,
+    0.60257860042135059,
+    0.33713483663949873,
+    0.7233527025167632,
+    0.7233527025167632,
+    0.36385478276943961,
+    0.62752919647949557,
+    0.62752919647949557,
+    0.36385478276943961,
+    0.68834352224859541,
+    0.68834352224859541,
+    0.026648419355374431,
+    0.33481894798617712,
+    0.33481894798617712,
+    0.026648419355374431,
+    0.94190558646569766,
+    0.94190558646569766,
+    0.05424000066843495,
+    0.36995155458552947,
+    0.36995155458552947,
+    0.05424000066843495,
+    0.92746637113549202,
+    0.92746637113549202,
+    0.082519927154308545,
+    0.40420030714746691,
+    0.40420030714746691,
+    0.082519927154308545,
+    0.91094048835494246,
+    0.91094048835494246,
+    0.111269518248371,
+    0.43753201001826242,
+    0.43753201001826242,
+    0.111269518248371,
+    0.89229189983892299,
+    0.89229189983892299,
+    0.14029641164678161,
+    0.46990544903359471,
+    0.46990544903359471,
+    0.14029641164678161,
+    0.87149629135617812,
+    0.87149629135617812,
+    0.1694275117584291,
+    0.50127398794319522,
+    0.50127398794319522,
+    0.1694275117584291,
+    0.84853916071733115,
+    0.84853916071733115,
+    0.19850382353126891,
+    0.53158748837549663,
+    0.53158748837549663,
+    0.19850382353126891,
+    0.82341421790378266,
+    0.82341421790378266,
+    0.2273765660020893,
+    0.56079371096221164,
+    0.56079371096221164,
+    0.2273765660020893,
+    0.79612204527844155,
+    0.79612204527844155,
+    0.2559041492849764,
+    0.58883932234955205,
+    0.58883932234955205,
+    0.2559041492849764,
+    0.76666897604745476,
+    0.76666897604745476,
+    0.28394972519768991,
+    0.6156705979160163,
+    0.6156705979160163,
+    0.28394972519768991,
+    0.73506616601629227,
+    0.73506616601629227,
+    0.31137910605006902,
+    0.6412338809078123,
+    0.6412338809078123,
+    0.31137910605006902,
+    0.70132885459773109,
+    0.70132885459773109,
+    0.027577922908584629,
+    0.40760512592571668,
+    0.40760512592571668,
+    0.027577922908584629,
+    0.91274175947369085,
+    0.91274175947369085,
+    0.055841368349842928,
+    0.44237881257915201,
+    0.44237881257915201,
+    0.055841368349842928,
+    0.8950881117308378,
+    0.8950881117308378,
+    0.084577720877271431,
+    0.47604809173282581,
+    0.47604809173282581,
+    0.084577720877271431,
+    0.87534268917306979,
+    0.87534268917306979,
+    0.1135975846359248,
+    0.50858387259462967,
+    0.50858387259462967,
+    0.1135975846359248,
+    0.853485813181176,
+    0.853485813181176,
+    0.1427286904765053,
+    0.53995136373912178,
+    0.53995136373912178,
+    0.1427286904765053,
+    0.82950650733500852,
+    0.82950650733500852,
+    0.17181127400576349,
+    0.57011184336363796,
+    0.57011184336363796,
+    0.17181127400576349,
+    0.80340112781911821,
+    0.80340112781911821,
+    0.20069448559853509,
+    0.59902405306060214,
+    0.59902405306060214,
+    0.20069448559853509,
+    0.77517217913518299,
+    0.77517217913518299,
+    0.22923350905989071,
+    0.62664526851396951,
+    0.62664526851396951,
+    0.22923350905989071,
+    0.74482729929369806,
+    0.74482729929369806,
+    0.25728715123537138,
+    0.65293209714159417,
+    0.65293209714159417,
+    0.25728715123537138,
+    0.7123784095068203,
+    0.7123784095068203,
+    0.02826094197735932,
+    0.47915838346101258,
+    0.47915838346101258,
+    0.02826094197735932,
+    0.87727336829381841,
+    0.87727336829381841,
+    0.056998713596836489,
+    0.51303739527969405,
+    0.51303739527969405,
+    0.056998713596836489,
+    0.8564717027975487,
+    0.8564717027975487,
+    0.086027125285543946,
+    0.54562524296284765,
+    0.54562524296284765,
+    0.086027125285543946,
+    0.83360208010587333,
+    0.83360208010587333,
+    0.11517481372212809,
+    0.57689563296823854,
+    0.57689563296823854,
+    0.11517481372212809,
+    0.8086570292443197,
+    0.8086570292443197,
+    0.1442811654136362,
+    0.60681869446990455,
+    0.60681869446990455,
+    0.1442811654136362,
+    0.78163547600446304,
+    0.78163547600446304,
+    0.17319303216576801,
+    0.63536222480249072,
+    0.63536222480249072,
+    0.17319303216576801,
+    0.75254170442790513,
+    0.75254170442790513,
+    0.20176199587560609,
+    0.66249270357317969,
+    0.66249270357317969,
+    0.20176199587560609,
+    0.72138444309022287,
+    0.72138444309022287,
+    0.028742197559073909,
+    0.54849335080284878,
+    0.54849335080284878,
+    0.028742197559073909,
+    0.83566077459968069,
+    0.83566077459968069,
+    0.057783121237136949,
+    0.58102076821421056,
+    0.58102076821421056,
+    0.057783121237136949,
+    0.81183494492653063,
+    0.81183494492653063,
+    0.086952623714395258,
+    0.61209551971813525,
+    0.61209551971813525,
+    0.086952623714395258,
+    0.78598875053665285,
+    0.78598875053665285,
+    0.1160893767057166,
+    0.64169442842943192,
+    0.64169442842943192,
+    0.1160893767057166,
+    0.75812368195348101,
+    0.75812368195348101,
+    0.1450378826743251,
+    0.66979263917312604,
+    0.66979263917312604,
+    0.1450378826743251,
+    0.72824572302132151,
+    0.72824572302132151,
+    0.029049576223414562,
+    0.6147594390585488,
+    0.6147594390585488,
+    0.029049576223414562,
+    0.78817951902447869,
+    0.78817951902447869,
+    0.058238091526171973,
+    0.64553900263567832,
+    0.64553900263567832,
+    0.058238091526171973,
+    0.76150359209364404,
+    0.76150359209364404,
+    0.08740384899884715,
+    0.67472585883654768,
+    0.67472585883654768,
+    0.08740384899884715,
+    0.73287487513044813,
+    0.73287487513044813,
+    0.02919946135808105,
+    0.67721357503953472,
+    0.67721357503953472,
+    0.02919946135808105,
+    0.73520688601139372,
+    0.73520688601139372,
+};
+constant double LebedevZ[1424] = {
+    0,
+    0,
+    1,
+    0.57735026918962573,
+    0.96512403508659406,
+    0.18511563534473621,
+    0.18511563534473621,
+    0.21595729184584844,
+    0.69042104838229224,
+    0.69042104838229224,
+    0.82876998125259227,
+    0.39568947305594188,
+    0.39568947305594188,
+    0,
+    0,
+    0.87815891060406615,
+    0.47836902881215021,
+    0.87815891060406615,
+    0.47836902881215021,
+    0,
+    0,
+    1,
+    0.57735026918962573,
+    0.092190407076898254,
+    0.70409549382274694,
+    0.70409549382274694,
+    0.2703560883591648,
+    0.68077440664552435,
+    0.68077440664552435,
+    0.43337386877715439,
+    0.63725469392587519,
+    0.63725469392587519,
+    0.70076857537357296,
+    0.50444197078003583,
+    0.50444197078003583,
+    0.80283687733527376,
+    0.42157617840109668,
+    0.42157617840109668,
+    0.88307872793413256,
+    0.3317920736472123,
+    0.3317920736472123,
+    0.94141415822040253,
+    0.2384736701421887,
+    0.2384736701421887,
+    0.97848058376269387,
+    0.14590364491577629,
+    0.14590364491577629,
+    0.99627812975401642,
+    0.06095034115507196,
+    0.06095034115507196,
+    0,
+    0,
+    0.79110192962690196,
+    0.61168434420098761,
+    0.79110192962690196,
+    0.61168434420098761,
+    0,
+    0,
+    0.91804528771145399,
+    0.39647553481998582,
+    0.91804528771145399,
+    0.39647553481998582,
+    0,
+    0,
+    0.98501333502800192,
+    0.17247820099077241,
+    0.98501333502800192,
+    0.17247820099077241,
+    0.74931061190411585,
+    0.74931061190411585,
+    0.35182809277335192,
+    0.56102638086220602,
+    0.35182809277335192,
+    0.56102638086220602,
+    0.84004748835905041,
+    0.84004748835905041,
+    0.26347166559379498,
+    0.47423928425519801,
+    0.26347166559379498,
+    0.47423928425519801,
+    0.78032074247992034,
+    0.78032074247992034,
+    0.18166408403602091,
+    0.59841264978853803,
+    0.18166408403602091,
+    0.59841264978853803,
+    0.9092134750923736,
+    0.9092134750923736,
+    0.17207952256568779,
+    0.37910354076955632,
+    0.17207952256568779,
+    0.37910354076955632,
+    0.95710207431007255,
+    0.95710207431007255,
+    0.082130215819325114,
+    0.27786731905862438,
+    0.082130215819325114,
+    0.27786731905862438,
+    0.85937985589072119,
+    0.85937985589072119,
+    0.089992058420748755,
+    0.50335642710751172,
+    0.089992058420748755,
+    0.50335642710751172,
+    0,
+    0,
+    1,
+    0.57735026918962573,
+    0.99895662386423845,
+    0.032292906634138543,
+    0.032292906634138543,
+    0.99352009726259405,
+    0.080367332714622222,
+    0.080367332714622222,
+    0.98148763316511711,
+    0.1354289960531653,
+    0.1354289960531653,
+    0.96166958094027533,
+    0.19389638611144261,
+    0.19389638611144261,
+    0.9334011664005224,
+    0.25373437150112749,
+    0.25373437150112749,
+    0.89632804754600814,
+    0.31352514347525701,
+    0.31352514347525701,
+    0.85029410825461882,
+    0.37215583393753382,
+    0.37215583393753382,
+    0.79527685325313602,
+    0.42868095751956958,
+    0.42868095751956958,
+    0.7313466491699806,
+    0.48225101282829941,
+    0.48225101282829941,
+    0.65864059136012676,
+    0.53206793335662628,
+    0.53206793335662628,
+    0.48773134571522136,
+    0.61729981953942736,
+    0.61729981953942736,
+    0.39015504359588543,
+    0.65106798491274809,
+    0.65106798491274809,
+    0.28523667293130073,
+    0.67773152516873603,
+    0.67773152516873603,
+    0.17407511799995667,
+    0.69631094106487412,
+    0.69631094106487412,
+    0.058555363028785182,
+    0.70589350098317494,
+    0.70589350098317494,
+    0,
+    0,
+    0.094185985013862425,
+    0.99555461940918566,
+    0.094185985013862425,
+    0.99555461940918566,
+    0,
+    0,
+    0.22906303958598634,
+    0.97341159017942092,
+    0.22906303958598634,
+    0.97341159017942092,
+    0,
+    0,
+    0.37365098398005542,
+    0.92756937323886257,
+    0.37365098398005542,
+    0.92756937323886257,
+    0,
+    0,
+    0.51564514700014707,
+    0.8568022422795103,
+    0.51564514700014707,
+    0.8568022422795103,
+    0,
+    0,
+    0.64716547762083976,
+    0.76234955537193716,
+    0.64716547762083976,
+    0.76234955537193716,
+    0.69410494323044358,
+    0.69410494323044358,
+    0.43870280398895012,
+    0.5707522908892223,
+    0.43870280398895012,
+    0.5707522908892223,
+    0.76227025456501074,
+    0.76227025456501074,
+    0.38589084147626168,
+    0.51964633884030831,
+    0.38589084147626168,
+    0.51964633884030831,
+    0.82163712875659778,
+    0.82163712875659778,
+    0.33019373723438539,
+    0.4646337531215351,
+    0.33019373723438539,
+    0.4646337531215351,
+    0.87210532240808258,
+    0.87210532240808258,
+    0.27254235735637772,
+    0.40639016975576908,
+    0.27254235735637772,
+    0.40639016975576908,
+    0.91365355885952593,
+    0.91365355885952593,
+    0.21395102374952499,
+    0.34563294666430872,
+    0.21395102374952499,
+    0.34563294666430872,
+    0.9463736441511913,
+    0.9463736441511913,
+    0.1555922309786647,
+    0.28313951210503319,
+    0.1555922309786647,
+    0.28313951210503319,
+    0.97052307124067727,
+    0.97052307124067727,
+    0.098928789796860969,
+    0.21976820229253299,
+    0.098928789796860969,
+    0.21976820229253299,
+    0.98661163054501488,
+    0.98661163054501488,
+    0.0459864291067551,
+    0.1564696098650355,
+    0.0459864291067551,
+    0.1564696098650355,
+    0.72297561639723473,
+    0.72297561639723473,
+    0.3376625140173426,
+    0.60273566737212947,
+    0.3376625140173426,
+    0.60273566737212947,
+    0.78630937964530889,
+    0.78630937964530889,
+    0.28223013097279881,
+    0.54960323202550965,
+    0.28223013097279881,
+    0.54960323202550965,
+    0.84095448961231367,
+    0.84095448961231367,
+    0.224863234259254,
+    0.49217077552345673,
+    0.224863234259254,
+    0.49217077552345673,
+    0.8868628337578075,
+    0.8868628337578075,
+    0.16662247234564789,
+    0.43094229985984828,
+    0.16662247234564789,
+    0.43094229985984828,
+    0.92408234768611786,
+    0.92408234768611786,
+    0.1086964901822169,
+    0.36641081823136717,
+    0.1086964901822169,
+    0.36641081823136717,
+    0.9528007946676823,
+    0.9528007946676823,
+    0.052519897841200848,
+    0.29901890577584361,
+    0.052519897841200848,
+    0.29901890577584361,
+    0.74447622050685558,
+    0.74447622050685558,
+    0.2297523657550023,
+    0.62687240131449984,
+    0.2297523657550023,
+    0.62687240131449984,
+    0.80285393644949632,
+    0.80285393644949632,
+    0.17230806070938001,
+    0.57073241448346068,
+    0.17230806070938001,
+    0.57073241448346068,
+    0.85280104244198507,
+    0.85280104244198507,
+    0.1140238465390513,
+    0.50963609019603651,
+    0.1140238465390513,
+    0.50963609019603651,
+    0.8943309495505728,
+    0.8943309495505728,
+    0.056115220958825367,
+    0.44387299383124562,
+    0.056115220958825367,
+    0.44387299383124562,
+    0.75781643122423281,
+    0.75781643122423281,
+    0.11641744231408729,
+    0.64199784710823893,
+    0.11641744231408729,
+    0.64199784710823893,
+    0.81131900987026206,
+    0.81131900987026206,
+    0.057975895314452193,
+    0.58172180618026115,
+    0.057975895314452193,
+    0.58172180618026115,
+    0,
+    0,
+    1,
+    0.57735026918962573,
+    0.99957325408378439,
+    0.020655625388187032,
+    0.020655625388187032,
+    0.99723897420229457,
+    0.052509181730223793,
+    0.052509181730223793,
+    0.99187875428541961,
+    0.089934800820383756,
+    0.089934800820383756,
+    0.98279500923438501,
+    0.13060239244360189,
+    0.13060239244360189,
+    0.96953562915944858,
+    0.17320603885314181,
+    0.17320603885314181,
+    0.95180484167256751,
+    0.21687270848202489,
+    0.21687270848202489,
+    0.92941230897402738,
+    0.2609528309173586,
+    0.2609528309173586,
+    0.90224227989443873,
+    0.30492529279389519,
+    0.30492529279389519,
+    0.87023374170063472,
+    0.34834841380844039,
+    0.34834841380844039,
+    0.83336693801458794,
+    0.39083215491064061,
+    0.39083215491064061,
+    0.79165377450876351,
+    0.43202100718948139,
+    0.43202100718948139,
+    0.74513081394435077,
+    0.47158247958900529,
+    0.47158247958900529,
+    0.6938543198233158,
+    0.50919847940784535,
+    0.50919847940784535,
+    0.63789743497358209,
+    0.54455801456508035,
+    0.54455801456508035,
+    0.51232456883525634,
+    0.60725757968417682,
+    0.60725757968417682,
+    0.44296582715333949,
+    0.63394845057558025,
+    0.63394845057558025,
+    0.36947697034395932,
+    0.65707182574869583,
+    0.65707182574869583,
+    0.29215812010746578,
+    0.67625573300907094,
+    0.67625573300907094,
+    0.2114636611322844,
+    0.69111616969237899,
+    0.69111616969237899,
+    0.12806625801244212,
+    0.70128419116599605,
+    0.70128419116599605,
+    0.042895754243421923,
+    0.70645592724100204,
+    0.70645592724100204,
+    0,
+    0,
+    0.99812334279315074,
+    0.061235549898947653,
+    0.99812334279315074,
+    0.061235549898947653,
+    0,
+    0,
+    0.98817860383194556,
+    0.15330703483123931,
+    0.98817860383194556,
+    0.15330703483123931,
+    0,
+    0,
+    0.96657334657449545,
+    0.2563902605244206,
+    0.96657334657449545,
+    0.2563902605244206,
+    0,
+    0,
+    0.93181457605096585,
+    0.36293469916633608,
+    0.93181457605096585,
+    0.36293469916633608,
+    0,
+    0,
+    0.88351917176720984,
+    0.4683949968987538,
+    0.88351917176720984,
+    0.4683949968987538,
+    0,
+    0,
+    0.8220274093831399,
+    0.56944792406579525,
+    0.8220274093831399,
+    0.56944792406579525,
+    0,
+    0,
+    0.74822368610560697,
+    0.66344654309939555,
+    0.74822368610560697,
+    0.66344654309939555,
+    0.99417727340121909,
+    0.99417727340121909,
+    0.03034544009063584,
+    0.10339585735523051,
+    0.03034544009063584,
+    0.10339585735523051,
+    0.98686700780688252,
+    0.98686700780688252,
+    0.066188030442471346,
+    0.1473521412414395,
+    0.066188030442471346,
+    0.1473521412414395,
+    0.97562428210168017,
+    0.97562428210168017,
+    0.10544311289877149,
+    0.19245521587059669,
+    0.10544311289877149,
+    0.19245521587059669,
+    0.96007599584155501,
+    0.96007599584155501,
+    0.14682635512388581,
+    0.23810943628903281,
+    0.14682635512388581,
+    0.23810943628903281,
+    0.93997865697483385,
+    0.93997865697483385,
+    0.18944861081878861,
+    0.28381217079367599,
+    0.18944861081878861,
+    0.28381217079367599,
+    0.91517853412843708,
+    0.91517853412843708,
+    0.23263742387615791,
+    0.3291323133373415,
+    0.23263742387615791,
+    0.3291323133373415,
+    0.88558656840907179,
+    0.88558656840907179,
+    0.27584858084857677,
+    0.37368969787414602,
+    0.27584858084857677,
+    0.37368969787414602,
+    0.85116175259151849,
+    0.85116175259151849,
+    0.31861793319969212,
+    0.41714060407600129,
+    0.31861793319969212,
+    0.41714060407600129,
+    0.8118995648452525,
+    0.8118995648452525,
+    0.36053297963037939,
+    0.45916779852569151,
+    0.36053297963037939,
+    0.45916779852569151,
+    0.76782360191534671,
+    0.76782360191534671,
+    0.40121472535865088,
+    0.49947338317184181,
+    0.40121472535865088,
+    0.49947338317184181,
+    0.71897949089066204,
+    0.71897949089066204,
+    0.44030500255706922,
+    0.53777318304450961,
+    0.44030500255706922,
+    0.53777318304450961,
+    0.66543083338438536,
+    0.66543083338438536,
+    0.4774565904277483,
+    0.57379178300013312,
+    0.4774565904277483,
+    0.57379178300013312,
+    0.97859261714589352,
+    0.97859261714589352,
+    0.035441225049761473,
+    0.2027323586271389,
+    0.035441225049761473,
+    0.2027323586271389,
+    0.96495952599039381,
+    0.96495952599039381,
+    0.074183043886463282,
+    0.25169423751872733,
+    0.074183043886463282,
+    0.25169423751872733,
+    0.94696871864148335,
+    0.94696871864148335,
+    0.1150502745727186,
+    0.30002279952571809,
+    0.1150502745727186,
+    0.30002279952571809,
+    0.92441684114600409,
+    0.92441684114600409,
+    0.15719633712093639,
+    0.34748066910463421,
+    0.15719633712093639,
+    0.34748066910463421,
+    0.89717788479399074,
+    0.89717788479399074,
+    0.19996318772471,
+    0.39381031803592093,
+    0.19996318772471,
+    0.39381031803592093,
+    0.8651828195628285,
+    0.8651828195628285,
+    0.24280734578465349,
+    0.43875195904557029,
+    0.24280734578465349,
+    0.43875195904557029,
+    0.82840543625690799,
+    0.82840543625690799,
+    0.28525751329061549,
+    0.48205039600777871,
+    0.28525751329061549,
+    0.48205039600777871,
+    0.78685216774168254,
+    0.78685216774168254,
+    0.32688842086746389,
+    0.52345737784751012,
+    0.32688842086746389,
+    0.52345737784751012,
+    0.74055459663914236,
+    0.74055459663914236,
+    0.36730333216759392,
+    0.56273186472352821,
+    0.36730333216759392,
+    0.56273186472352821,
+    0.68956406821759553,
+    0.68956406821759553,
+    0.40612115518302899,
+    0.59963906071569539,
+    0.40612115518302899,
+    0.59963906071569539,
+    0.95044790499266141,
+    0.95044790499266141,
+    0.038601255231000588,
+    0.30847807537919469,
+    0.038601255231000588,
+    0.30847807537919469,
+    0.9299639963146048,
+    0.9299639963146048,
+    0.079289389871048666,
+    0.35899882759202228,
+    0.079289389871048666,
+    0.35899882759202228,
+    0.90495500425528963,
+    0.90495500425528963,
+    0.1212614643030087,
+    0.4078628415881973,
+    0.1212614643030087,
+    0.4078628415881973,
+    0.87531945946278933,
+    0.87531945946278933,
+    0.16387708273826929,
+    0.45492872588897348,
+    0.16387708273826929,
+    0.45492872588897348,
+    0.84100535142932908,
+    0.84100535142932908,
+    0.20659657982601759,
+    0.50002785129572791,
+    0.20659657982601759,
+    0.50002785129572791,
+    0.80199838454650985,
+    0.80199838454650985,
+    0.2489436378852235,
+    0.54297850449281992,
+    0.2489436378852235,
+    0.54297850449281992,
+    0.75831310797242368,
+    0.75831310797242368,
+    0.29048113689468907,
+    0.58359398504917115,
+    0.29048113689468907,
+    0.58359398504917115,
+    0.70998621826882835,
+    0.70998621826882835,
+    0.33079419576666091,
+    0.62168703534448555,
+    0.33079419576666091,
+    0.62168703534448555,
+    0.90886248530439884,
+    0.90886248530439884,
+    0.040648291460525537,
+    0.41511046627090908,
+    0.040648291460525537,
+    0.41511046627090908,
+    0.88146074469639546,
+    0.88146074469639546,
+    0.082584245472947557,
+    0.46498042750092178,
+    0.082584245472947557,
+    0.46498042750092178,
+    0.84953154797332187,
+    0.84953154797332187,
+    0.12518419620272889,
+    0.51246957570096618,
+    0.12518419620272889,
+    0.51246957570096618,
+    0.81303870835373937,
+    0.81303870835373937,
+    0.16791075059763311,
+    0.55747111006062244,
+    0.16791075059763311,
+    0.55747111006062244,
+    0.7719782440187416,
+    0.7719782440187416,
+    0.21028050573587151,
+    0.59985973332872267,
+    0.21028050573587151,
+    0.59985973332872267,
+    0.72637079997473597,
+    0.72637079997473597,
+    0.25184180877741069,
+    0.63950071485166005,
+    0.25184180877741069,
+    0.63950071485166005,
+    0.85383838436010673,
+    0.85383838436010673,
+    0.041943216760775177,
+    0.51884562247462518,
+    0.041943216760775177,
+    0.51884562247462518,
+    0.81976596193539397,
+    0.81976596193539397,
+    0.084576615519214984,
+    0.56641907079427778,
+    0.084576615519214984,
+    0.56641907079427778,
+    0.78128121438276399,
+    0.78128121438276399,
+    0.1273652932519396,
+    0.61104643532831526,
+    0.1273652932519396,
+    0.61104643532831526,
+    0.73838956630323582,
+    0.73838956630323582,
+    0.1698173239076354,
+    0.65264303020515635,
+    0.1698173239076354,
+    0.65264303020515635,
+    0.78599797844044361,
+    0.78599797844044361,
+    0.042663988515488638,
+    0.61675518803775475,
+    0.042663988515488638,
+    0.61675518803775475,
+    0.74574536104719602,
+    0.74574536104719602,
+    0.085519258142383495,
+    0.66071954183553827,
+    0.085519258142383495,
+    0.66071954183553827,
+    0,
+    0,
+    1,
+    0.70710678118654757,
+    0.70710678118654757,
+    0,
+    0.57735026918962573,
+    0.99986019231683443,
+    0.01182361662400277,
+    0.01182361662400277,
+    0.99906188676608065,
+    0.030621450091389581,
+    0.030621450091389581,
+    0.99715528334607206,
+    0.053297940368342428,
+    0.053297940368342428,
+    0.99382154311212167,
+    0.078481655328622196,
+    0.078481655328622196,
+    0.98882762463684115,
+    0.1054038157636201,
+    0.1054038157636201,
+    0.98200032531678882,
+    0.13355777977662109,
+    0.13355777977662109,
+    0.97320986484710692,
+    0.1625769955502252,
+    0.1625769955502252,
+    0.96235891416076758,
+    0.1921787193412792,
+    0.1921787193412792,
+    0.94937501788219292,
+    0.22213405346905479,
+    0.22213405346905479,
+    0.93420521262669687,
+    0.2522504912791132,
+    0.2522504912791132,
+    0.91681210405896862,
+    0.28236108606796972,
+    0.28236108606796972,
+    0.89717093551260962,
+    0.31231739662675601,
+    0.31231739662675601,
+    0.87526734480201407,
+    0.34198470369537892,
+    0.34198470369537892,
+    0.85109560912843141,
+    0.37123864569997578,
+    0.37123864569997578,
+    0.82465724591906386,
+    0.3999627649876828,
+    0.3999627649876828,
+    0.79595988462219192,
+    0.42804664586480928,
+    0.42804664586480928,
+    0.76501635986696115,
+    0.45538443601857109,
+    0.45538443601857109,
+    0.73184400594883625,
+    0.48187360944378338,
+    0.48187360944378338,
+    0.6964641607316614,
+    0.50741387092606294,
+    0.50741387092606294,
+    0.65890191740832815,
+    0.53190613045707069,
+    0.53190613045707069,
+    0.61918619835336075,
+    0.55525149786772865,
+    0.55525149786772865,
+    0.53343286437795889,
+    0.59810090252461834,
+    0.59810090252461834,
+    0.48748015562217573,
+    0.6173990192228116,
+    0.6173990192228116,
+    0.43954885042734415,
+    0.63513652394111308,
+    0.63513652394111308,
+    0.38971073342838108,
+    0.65120102282271997,
+    0.65120102282271997,
+    0.33805890366806024,
+    0.665475836394812,
+    0.665475836394812,
+    0.2847157265697618,
+    0.67784104148533697,
+    0.67784104148533697,
+    0.2298419930079757,
+    0.68817608874841096,
+    0.68817608874841096,
+    0.17364588069234502,
+    0.69636452670945981,
+    0.69636452670945981,
+    0.11638916370075933,
+    0.70230106171535789,
+    0.70230106171535789,
+    0.058387248617102441,
+    0.70590046366287529,
+    0.70590046366287529,
+    0,
+    0,
+    0.9993687985262999,
+    0.035524703124725748,
+    0.9993687985262999,
+    0.035524703124725748,
+    0,
+    0,
+    0.99580399509412332,
+    0.091511766208412837,
+    0.99580399509412332,
+    0.091511766208412837,
+    0,
+    0,
+    0.98765896970486544,
+    0.15661979300689799,
+    0.98765896970486544,
+    0.15661979300689799,
+    0,
+    0,
+    0.97400029033183133,
+    0.2265467599271907,
+    0.97400029033183133,
+    0.2265467599271907,
+    0,
+    0,
+    0.95430816744613212,
+    0.29882423185813611,
+    0.95430816744613212,
+    0.29882423185813611,
+    0,
+    0,
+    0.92833358475923167,
+    0.37174824197038858,
+    0.92833358475923167,
+    0.37174824197038858,
+    0,
+    0,
+    0.89602210298771301,
+    0.44400944917588892,
+    0.89602210298771301,
+    0.44400944917588892,
+    0,
+    0,
+    0.8574701520212813,
+    0.51453370967566425,
+    0.8574701520212813,
+    0.51453370967566425,
+    0,
+    0,
+    0.81289851036672023,
+    0.58240536728602299,
+    0.81289851036672023,
+    0.58240536728602299,
+    0,
+    0,
+    0.76263557876163302,
+    0.64682839610433696,
+    0.76263557876163302,
+    0.64682839610433696,
+    0.99798010450156804,
+    0.99798010450156804,
+    0.017878282753429311,
+    0.060959642591043729,
+    0.017878282753429311,
+    0.060959642591043729,
+    0.99532487584509943,
+    0.99532487584509943,
+    0.039538887407920963,
+    0.088119622709593878,
+    0.039538887407920963,
+    0.088119622709593878,
+    0.99112959386059107,
+    0.99112959386059107,
+    0.063781217977229895,
+    0.1165936722428831,
+    0.063781217977229895,
+    0.1165936722428831,
+    0.98519164463610487,
+    0.98519164463610487,
+    0.089858908137450372,
+    0.14602328570317849,
+    0.089858908137450372,
+    0.14602328570317849,
+    0.97735959968909003,
+    0.97735959968909003,
+    0.1172606510576162,
+    0.1761197110181755,
+    0.1172606510576162,
+    0.1761197110181755,
+    0.96751982527832603,
+    0.96751982527832603,
+    0.14561028769709949,
+    0.20664711904637181,
+    0.14561028769709949,
+    0.20664711904637181,
+    0.95558730552260518,
+    0.95558730552260518,
+    0.17461538230117751,
+    0.23740760263281521,
+    0.17461538230117751,
+    0.23740760263281521,
+    0.94149919951528716,
+    0.94149919951528716,
+    0.20403830702955841,
+    0.26823054743370511,
+    0.20403830702955841,
+    0.26823054743370511,
+    0.92521020289006384,
+    0.92521020289006384,
+    0.23367886340036981,
+    0.29896533121423691,
+    0.23367886340036981,
+    0.29896533121423691,
+    0.90668912493253084,
+    0.90668912493253084,
+    0.26336327526542191,
+    0.3294762752772209,
+    0.26336327526542191,
+    0.3294762752772209,
+    0.88591630120061504,
+    0.88591630120061504,
+    0.29293690980516007,
+    0.35963908872760858,
+    0.29293690980516007,
+    0.35963908872760858,
+    0.86288159207567128,
+    0.86288159207567128,
+    0.32225927852755121,
+    0.38933830463988123,
+    0.32225927852755121,
+    0.38933830463988123,
+    0.83758280193558765,
+    0.83758280193558765,
+    0.3512004791195743,
+    0.41846537893583469,
+    0.3512004791195743,
+    0.41846537893583469,
+    0.81002441054992336,
+    0.81002441054992336,
+    0.37963856776845373,
+    0.44691723190761662,
+    0.37963856776845373,
+    0.44691723190761662,
+    0.78021654920157502,
+    0.78021654920157502,
+    0.40745753782638788,
+    0.47459508132769762,
+    0.40745753782638788,
+    0.47459508132769762,
+    0.74817418622748333,
+    0.74817418622748333,
+    0.43454569060278281,
+    0.50140346014102621,
+    0.43454569060278281,
+    0.50140346014102621,
+    0.71391651525601141,
+    0.71391651525601141,
+    0.4607942515205134,
+    0.52724934045512395,
+    0.4607942515205134,
+    0.52724934045512395,
+    0.67746656840533992,
+    0.67746656840533992,
+    0.48609612841817201,
+    0.55204130518463657,
+    0.48609612841817201,
+    0.55204130518463657,
+    0.63885110955247693,
+    0.63885110955247693,
+    0.51034473953427895,
+    0.57568872375030766,
+    0.51034473953427895,
+    0.57568872375030766,
+    0.99223804580558816,
+    0.99223804580558816,
+    0.02136455922655793,
+    0.1225039430588352,
+    0.02136455922655793,
+    0.1225039430588352,
+    0.98704986079868329,
+    0.98704986079868329,
+    0.045209261661371881,
+    0.1539113217321372,
+    0.045209261661371881,
+    0.1539113217321372,
+    0.98006271544267454,
+    0.98006271544267454,
+    0.070864681778648186,
+    0.18562130986377121,
+    0.070864681778648186,
+    0.18562130986377121,
+    0.97114299366529522,
+    0.97114299366529522,
+    0.097852394887729177,
+    0.2174998728035131,
+    0.097852394887729177,
+    0.2174998728035131,
+    0.96019004438992583,
+    0.96019004438992583,
+    0.12581063962672101,
+    0.24941283369383299,
+    0.12581063962672101,
+    0.24941283369383299,
+    0.94712869882072726,
+    0.94712869882072726,
+    0.15445291250470011,
+    0.28123215621434799,
+    0.15445291250470011,
+    0.28123215621434799,
+    0.93190380792324201,
+    0.93190380792324201,
+    0.18354335122027529,
+    0.31283722764561112,
+    0.18354335122027529,
+    0.31283722764561112,
+    0.91447621126254119,
+    0.91447621126254119,
+    0.21288132586195849,
+    0.3441145160177973,
+    0.21288132586195849,
+    0.3441145160177973,
+    0.89481970801415667,
+    0.89481970801415667,
+    0.24229137348808291,
+    0.374956771485351,
+    0.24229137348808291,
+    0.374956771485351,
+    0.87291873384135188,
+    0.87291873384135188,
+    0.2716163748391453,
+    0.40526217320156099,
+    0.2716163748391453,
+    0.40526217320156099,
+    0.84876654199841217,
+    0.84876654199841217,
+    0.300712767124028,
+    0.43493354535223849,
+    0.300712767124028,
+    0.43493354535223849,
+    0.82236375301324627,
+    0.82236375301324627,
+    0.32944706772164789,
+    0.46387766415249648,
+    0.32944706772164789,
+    0.46387766415249648,
+    0.79371718449784823,
+    0.79371718449784823,
+    0.3576932543699155,
+    0.49200464104626868,
+    0.3576932543699155,
+    0.49200464104626868,
+    0.76283890851676395,
+    0.76283890851676395,
+    0.3853307059757764,
+    0.51922735548617038,
+    0.3853307059757764,
+    0.51922735548617038,
+    0.7297455140311051,
+    0.7297455140311051,
+    0.41224250444526939,
+    0.54546090811365222,
+    0.41224250444526939,
+    0.54546090811365222,
+    0.69445758054155504,
+    0.69445758054155504,
+    0.4383139587781027,
+    0.57062206614241395,
+    0.4383139587781027,
+    0.57062206614241395,
+    0.65699939985543665,
+    0.65699939985543665,
+    0.46343125363005527,
+    0.59462867551815179,
+    0.46343125363005527,
+    0.59462867551815179,
+    0.98139355492585312,
+    0.98139355492585312,
+    0.023713115377819789,
+    0.19053707909242951,
+    0.023713115377819789,
+    0.19053707909242951,
+    0.97328954866726491,
+    0.97328954866726491,
+    0.049178780592548058,
+    0.22425187177480091,
+    0.049178780592548058,
+    0.22425187177480091,
+    0.9632298349534123,
+    0.9632298349534123,
+    0.075954989604951423,
+    0.25771908080259359,
+    0.075954989604951423,
+    0.25771908080259359,
+    0.95112549683674641,
+    0.95112549683674641,
+    0.10369910831911,
+    0.29087245349271867,
+    0.10369910831911,
+    0.29087245349271867,
+    0.9369100841342104,
+    0.9369100841342104,
+    0.1321348584450234,
+    0.32363540200562191,
+    0.1321348584450234,
+    0.32363540200562191,
+    0.92053515090483229,
+    0.92053515090483229,
+    0.16103165713147891,
+    0.35592673593045432,
+    0.16103165713147891,
+    0.35592673593045432,
+    0.90196682339083034,
+    0.90196682339083034,
+    0.19019120803957071,
+    0.38766371236769559,
+    0.19019120803957071,
+    0.38766371236769559,
+    0.88118314507094353,
+    0.88118314507094353,
+    0.219438495013795,
+    0.41876367052188418,
+    0.219438495013795,
+    0.41876367052188418,
+    0.85817199530872768,
+    0.85817199530872768,
+    0.24861553347638579,
+    0.4491449019883107,
+    0.24861553347638579,
+    0.4491449019883107,
+    0.83292943192529711,
+    0.83292943192529711,
+    0.27757689318123352,
+    0.47872709324254448,
+    0.27757689318123352,
+    0.47872709324254448,
+    0.80545835323641946,
+    0.80545835323641946,
+    0.30618637865911202,
+    0.50743151530555741,
+    0.30618637865911202,
+    0.50743151530555741,
+    0.77576741155290996,
+    0.77576741155290996,
+    0.33431447181525559,
+    0.5351810507738336,
+    0.33431447181525559,
+    0.5351810507738336,
+    0.74387014075889324,
+    0.74387014075889324,
+    0.3618362729028427,
+    0.56190010259753809,
+    0.3618362729028427,
+    0.56190010259753809,
+    0.70978428875539701,
+    0.70978428875539701,
+    0.38862975836204078,
+    0.58751440352680462,
+    0.38862975836204078,
+    0.58751440352680462,
+    0.67353137465505519,
+    0.67353137465505519,
+    0.41457422777920311,
+    0.61195073087344953,
+    0.41457422777920311,
+    0.61195073087344953,
+    0.96474077374524847,
+    0.96474077374524847,
+    0.02540047186389353,
+    0.26197338701194628,
+    0.02540047186389353,
+    0.26197338701194628,
+    0.95351372991976591,
+    0.95351372991976591,
+    0.052081070185439893,
+    0.29681497432379489,
+    0.052081070185439893,
+    0.29681497432379489,
+    0.94024151334789885,
+    0.94024151334789885,
+    0.079718284708855988,
+    0.33104515048604882,
+    0.079718284708855988,
+    0.33104515048604882,
+    0.92486596467185678,
+    0.92486596467185678,
+    0.1080465999177927,
+    0.36462155673766761,
+    0.1080465999177927,
+    0.36462155673766761,
+    0.90734491835776543,
+    0.90734491835776543,
+    0.1368413849366629,
+    0.39749167852793599,
+    0.1368413849366629,
+    0.39749167852793599,
+    0.88764936902656955,
+    0.88764936902656955,
+    0.1659073184763559,
+    0.42959674037720291,
+    0.1659073184763559,
+    0.42959674037720291,
+    0.86576119257755135,
+    0.86576119257755135,
+    0.1950703730454614,
+    0.46087428544734471,
+    0.1950703730454614,
+    0.46087428544734471,
+    0.84167130616350716,
+    0.84167130616350716,
+    0.2241721144376724,
+    0.49125988589499031,
+    0.2241721144376724,
+    0.49125988589499031,
+    0.8153781693967469,
+    0.8153781693967469,
+    0.25306552554064887,
+    0.5206882758945558,
+    0.25306552554064887,
+    0.5206882758945558,
+    0.78688655460057877,
+    0.78688655460057877,
+    0.2816118409731066,
+    0.54909409140198195,
+    0.2816118409731066,
+    0.54909409140198195,
+    0.75620653967958651,
+    0.75620653967958651,
+    0.30967805045932378,
+    0.57641233020255422,
+    0.30967805045932378,
+    0.57641233020255422,
+    0.7233527025167632,
+    0.7233527025167632,
+    0.33713483663949873,
+    0.60257860042135059,
+    0.33713483663949873,
+    0.60257860042135059,
+    0.68834352224859541,
+    0.68834352224859541,
+    0.36385478276943961,
+    0.62752919647949557,
+    0.36385478276943961,
+    0.62752919647949557,
+    0.94190558646569766,
+    0.94190558646569766,
+    0.026648419355374431,
+    0.33481894798617712,
+    0.026648419355374431,
+    0.33481894798617712,
+    0.92746637113549202,
+    0.92746637113549202,
+    0.05424000066843495,
+    0.36995155458552947,
+    0.05424000066843495,
+    0.36995155458552947,
+    0.91094048835494246,
+    0.91094048835494246,
+    0.082519927154308545,
+    0.40420030714746691,
+    0.082519927154308545,
+    0.40420030714746691,
+    0.89229189983892299,
+    0.89229189983892299,
+    0.111269518248371,
+    0.43753201001826242,
+    0.111269518248371,
+    0.43753201001826242,
+    0.87149629135617812,
+    0.87149629135617812,
+    0.14029641164678161,
+    0.46990544903359471,
+    0.14029641164678161,
+    0.46990544903359471,
+    0.84853916071733115,
+    0.84853916071733115,
+    0.1694275117584291,
+    0.50127398794319522,
+    0.1694275117584291,
+    0.50127398794319522,
+    0.82341421790378266,
+    0.82341421790378266,
+    0.19850382353126891,
+    0.53158748837549663,
+    0.19850382353126891,
+    0.53158748837549663,
+    0.79612204527844155,
+    0.79612204527844155,
+    0.2273765660020893,
+    0.56079371096221164,
+    0.2273765660020893,
+    0.56079371096221164,
+    0.76666897604745476,
+    0.76666897604745476,
+    0.2559041492849764,
+    0.58883932234955205,
+    0.2559041492849764,
+    0.58883932234955205,
+    0.73506616601629227,
+    0.73506616601629227,
+    0.28394972519768991,
+    0.6156705979160163,
+    0.28394972519768991,
+    0.6156705979160163,
+    0.70132885459773109,
+    0.70132885459773109,
+    0.31137910605006902,
+    0.6412338809078123,
+    0.31137910605006902,
+    0.6412338809078123,
+    0.91274175947369085,
+    0.91274175947369085,
+    0.027577922908584629,
+    0.40760512592571668,
+    0.027577922908584629,
+    0.40760512592571668,
+    0.8950881117308378,
+    0.8950881117308378,
+    0.055841368349842928,
+    0.44237881257915201,
+    0.055841368349842928,
+    0.44237881257915201,
+    0.87534268917306979,
+    0.87534268917306979,
+    0.084577720877271431,
+    0.47604809173282581,
+    0.084577720877271431,
+    0.47604809173282581,
+    0.853485813181176,
+    0.853485813181176,
+    0.1135975846359248,
+    0.50858387259462967,
+    0.1135975846359248,
+    0.50858387259462967,
+    0.82950650733500852,
+    0.82950650733500852,
+    0.1427286904765053,
+    0.53995136373912178,
+    0.1427286904765053,
+    0.53995136373912178,
+    0.80340112781911821,
+    0.80340112781911821,
+    0.17181127400576349,
+    0.57011184336363796,
+    0.17181127400576349,
+    0.57011184336363796,
+    0.77517217913518299,
+    0.77517217913518299,
+    0.20069448559853509,
+    0.59902405306060214,
+    0.20069448559853509,
+    0.59902405306060214,
+    0.74482729929369806,
+    0.74482729929369806,
+    0.22923350905989071,
+    0.62664526851396951,
+    0.22923350905989071,
+    0.62664526851396951,
+    0.7123784095068203,
+    0.7123784095068203,
+    0.25728715123537138,
+    0.65293209714159417,
+    0.25728715123537138,
+    0.65293209714159417,
+    0.87727336829381841,
+    0.87727336829381841,
+    0.02826094197735932,
+    0.47915838346101258,
+    0.02826094197735932,
+    0.47915838346101258,
+    0.8564717027975487,
+    0.8564717027975487,
+    0.056998713596836489,
+    0.51303739527969405,
+    0.056998713596836489,
+    0.51303739527969405,
+    0.83360208010587333,
+    0.83360208010587333,
+    0.086027125285543946,
+    0.54562524296284765,
+    0.086027125285543946,
+    0.54562524296284765,
+    0.8086570292443197,
+    0.8086570292443197,
+    0.11517481372212809,
+    0.57689563296823854,
+    0.11517481372212809,
+    0.57689563296823854,
+    0.78163547600446304,
+    0.78163547600446304,
+    0.1442811654136362,
+    0.60681869446990455,
+    0.1442811654136362,
+    0.60681869446990455,
+    0.75254170442790513,
+    0.75254170442790513,
+    0.17319303216576801,
+    0.63536222480249072,
+    0.17319303216576801,
+    0.63536222480249072,
+    0.72138444309022287,
+    0.72138444309022287,
+    0.20176199587560609,
+    0.66249270357317969,
+    0.20176199587560609,
+    0.66249270357317969,
+    0.83566077459968069,
+    0.83566077459968069,
+    0.028742197559073909,
+    0.54849335080284878,
+    0.028742197559073909,
+    0.54849335080284878,
+    0.81183494492653063,
+    0.81183494492653063,
+    0.057783121237136949,
+    0.58102076821421056,
+    0.057783121237136949,
+    0.58102076821421056,
+    0.78598875053665285,
+    0.78598875053665285,
+    0.086952623714395258,
+    0.61209551971813525,
+    0.086952623714395258,
+    0.61209551971813525,
+    0.75812368195348101,
+    0.75812368195348101,
+    0.1160893767057166,
+    0.64169442842943192,
+    0.1160893767057166,
+    0.64169442842943192,
+    0.72824572302132151,
+    0.72824572302132151,
+    0.1450378826743251,
+    0.66979263917312604,
+    0.1450378826743251,
+    0.66979263917312604,
+    0.78817951902447869,
+    0.78817951902447869,
+    0.029049576223414562,
+    0.6147594390585488,
+    0.029049576223414562,
+    0.6147594390585488,
+    0.76150359209364404,
+    0.76150359209364404,
+    0.058238091526171973,
+    0.64553900263567832,
+    0.058238091526171973,
+    0.64553900263567832,
+    0.73287487513044813,
+    0.73287487513044813,
+    0.08740384899884715,
+    0.67472585883654768,
+    0.08740384899884715,
+    0.67472585883654768,
+    0.73520688601139372,
+    0.73520688601139372,
+    0.02919946135808105,
+    0.67721357503953472,
+    0.02919946135808105,
+    0.67721357503953472,
+};
+constant double LebedevW[1424] = {
+    0.007656540989874323,
+    0.007656540989874323,
+    0.007656540989874323,
+    0.078349900099900102,
+    0.065693898265528891,
+    0.065693898265528891,
+    0.065693898265528891,
+    0.079542519129424824,
+    0.079542519129424824,
+    0.079542519129424824,
+    0.076763770688567698,
+    0.076763770688567698,
+    0.076763770688567698,
+    0.038779985446652114,
+    0.038779985446652114,
+    0.038779985446652114,
+    0.038779985446652114,
+    0.038779985446652114,
+    0.038779985446652114,
+    0.00061902425906123733,
+    0.00061902425906123733,
+    0.00061902425906123733,
+    0.01481903758877991,
+    0.01497432511422195,
+    0.01497432511422195,
+    0.01497432511422195,
+    0.014870500683506534,
+    0.014870500683506534,
+    0.014870500683506534,
+    0.014816230626369702,
+    0.014816230626369702,
+    0.014816230626369702,
+    0.014773727649209934,
+    0.014773727649209934,
+    0.014773727649209934,
+    0.014547774225302148,
+    0.014547774225302148,
+    0.014547774225302148,
+    0.013996517258249231,
+    0.013996517258249231,
+    0.013996517258249231,
+    0.012937685178035287,
+    0.012937685178035287,
+    0.012937685178035287,
+    0.011077897878813534,
+    0.011077897878813534,
+    0.011077897878813534,
+    0.0078114649320408392,
+    0.0078114649320408392,
+    0.0078114649320408392,
+    0.0074286447870963107,
+    0.0074286447870963107,
+    0.0074286447870963107,
+    0.0074286447870963107,
+    0.0074286447870963107,
+    0.0074286447870963107,
+    0.0068206159855834555,
+    0.0068206159855834555,
+    0.0068206159855834555,
+    0.0068206159855834555,
+    0.0068206159855834555,
+    0.0068206159855834555,
+    0.0052012867435441918,
+    0.0052012867435441918,
+    0.0052012867435441918,
+    0.0052012867435441918,
+    0.0052012867435441918,
+    0.0052012867435441918,
+    0.014742931783242286,
+    0.014742931783242286,
+    0.014742931783242286,
+    0.014742931783242286,
+    0.014742931783242286,
+    0.014742931783242286,
+    0.014421271475019606,
+    0.014421271475019606,
+    0.014421271475019606,
+    0.014421271475019606,
+    0.014421271475019606,
+    0.014421271475019606,
+    0.014798644483549278,
+    0.014798644483549278,
+    0.014798644483549278,
+    0.014798644483549278,
+    0.014798644483549278,
+    0.014798644483549278,
+    0.013711236056853669,
+    0.013711236056853669,
+    0.013711236056853669,
+    0.013711236056853669,
+    0.013711236056853669,
+    0.013711236056853669,
+    0.012441708827174462,
+    0.012441708827174462,
+    0.012441708827174462,
+    0.012441708827174462,
+    0.012441708827174462,
+    0.012441708827174462,
+    0.014417913024068196,
+    0.014417913024068196,
+    0.014417913024068196,
+    0.014417913024068196,
+    0.014417913024068196,
+    0.014417913024068196,
+    0.00015554321486522499,
+    0.00015554321486522499,
+    0.00015554321486522499,
+    0.0060461171304037617,
+    0.0022733070448724946,
+    0.0022733070448724946,
+    0.0022733070448724946,
+    0.003499535301642845,
+    0.003499535301642845,
+    0.003499535301642845,
+    0.0043337397926977387,
+    0.0043337397926977387,
+    0.0043337397926977387,
+    0.0049184007130868759,
+    0.0049184007130868759,
+    0.0049184007130868759,
+    0.0053315155886405645,
+    0.0053315155886405645,
+    0.0053315155886405645,
+    0.0056200314855385774,
+    0.0056200314855385774,
+    0.0056200314855385774,
+    0.0058148094313997031,
+    0.0058148094313997031,
+    0.0058148094313997031,
+    0.0059381100273669047,
+    0.0059381100273669047,
+    0.0059381100273669047,
+    0.0060076360286729731,
+    0.0060076360286729731,
+    0.0060076360286729731,
+    0.0060388280461747225,
+    0.0060388280461747225,
+    0.0060388280461747225,
+    0.0060432711758192032,
+    0.0060432711758192032,
+    0.0060432711758192032,
+    0.0060425177395542484,
+    0.0060425177395542484,
+    0.0060425177395542484,
+    0.0060518141226338388,
+    0.0060518141226338388,
+    0.0060518141226338388,
+    0.0060703934468149855,
+    0.0060703934468149855,
+    0.0060703934468149855,
+    0.0060866094656264243,
+    0.0060866094656264243,
+    0.0060866094656264243,
+    0.001608672179149967,
+    0.001608672179149967,
+    0.001608672179149967,
+    0.001608672179149967,
+    0.001608672179149967,
+    0.001608672179149967,
+    0.0023219487175783864,
+    0.0023219487175783864,
+    0.0023219487175783864,
+    0.0023219487175783864,
+    0.0023219487175783864,
+    0.0023219487175783864,
+    0.0027168607823780644,
+    0.0027168607823780644,
+    0.0027168607823780644,
+    0.0027168607823780644,
+    0.0027168607823780644,
+    0.0027168607823780644,
+    0.0029346964845145184,
+    0.0029346964845145184,
+    0.0029346964845145184,
+    0.0029346964845145184,
+    0.0029346964845145184,
+    0.0029346964845145184,
+    0.0030327465203958443,
+    0.0030327465203958443,
+    0.0030327465203958443,
+    0.0030327465203958443,
+    0.0030327465203958443,
+    0.0030327465203958443,
+    0.006030606287840596,
+    0.006030606287840596,
+    0.006030606287840596,
+    0.006030606287840596,
+    0.006030606287840596,
+    0.006030606287840596,
+    0.0059868137976425003,
+    0.0059868137976425003,
+    0.0059868137976425003,
+    0.0059868137976425003,
+    0.0059868137976425003,
+    0.0059868137976425003,
+    0.0058974109288896489,
+    0.0058974109288896489,
+    0.0058974109288896489,
+    0.0058974109288896489,
+    0.0058974109288896489,
+    0.0058974109288896489,
+    0.0057467591166055487,
+    0.0057467591166055487,
+    0.0057467591166055487,
+    0.0057467591166055487,
+    0.0057467591166055487,
+    0.0057467591166055487,
+    0.0055166524238577548,
+    0.0055166524238577548,
+    0.0055166524238577548,
+    0.0055166524238577548,
+    0.0055166524238577548,
+    0.0055166524238577548,
+    0.0051840846414343104,
+    0.0051840846414343104,
+    0.0051840846414343104,
+    0.0051840846414343104,
+    0.0051840846414343104,
+    0.0051840846414343104,
+    0.0047180471172757095,
+    0.0047180471172757095,
+    0.0047180471172757095,
+    0.0047180471172757095,
+    0.0047180471172757095,
+    0.0047180471172757095,
+    0.0040765670793978786,
+    0.0040765670793978786,
+    0.0040765670793978786,
+    0.0040765670793978786,
+    0.0040765670793978786,
+    0.0040765670793978786,
+    0.0060295251431278056,
+    0.0060295251431278056,
+    0.0060295251431278056,
+    0.0060295251431278056,
+    0.0060295251431278056,
+    0.0060295251431278056,
+    0.0059780047724600962,
+    0.0059780047724600962,
+    0.0059780047724600962,
+    0.0059780047724600962,
+    0.0059780047724600962,
+    0.0059780047724600962,
+    0.0058744137058237599,
+    0.0058744137058237599,
+    0.0058744137058237599,
+    0.0058744137058237599,
+    0.0058744137058237599,
+    0.0058744137058237599,
+    0.0057046972657419578,
+    0.0057046972657419578,
+    0.0057046972657419578,
+    0.0057046972657419578,
+    0.0057046972657419578,
+    0.0057046972657419578,
+    0.0054536176256902227,
+    0.0054536176256902227,
+    0.0054536176256902227,
+    0.0054536176256902227,
+    0.0054536176256902227,
+    0.0054536176256902227,
+    0.0051047529164832987,
+    0.0051047529164832987,
+    0.0051047529164832987,
+    0.0051047529164832987,
+    0.0051047529164832987,
+    0.0051047529164832987,
+    0.0060403051023362499,
+    0.0060403051023362499,
+    0.0060403051023362499,
+    0.0060403051023362499,
+    0.0060403051023362499,
+    0.0060403051023362499,
+    0.0059829173121158426,
+    0.0059829173121158426,
+    0.0059829173121158426,
+    0.0059829173121158426,
+    0.0059829173121158426,
+    0.0059829173121158426,
+    0.0058687349764809781,
+    0.0058687349764809781,
+    0.0058687349764809781,
+    0.0058687349764809781,
+    0.0058687349764809781,
+    0.0058687349764809781,
+    0.0056880964221264962,
+    0.0056880964221264962,
+    0.0056880964221264962,
+    0.0056880964221264962,
+    0.0056880964221264962,
+    0.0056880964221264962,
+    0.0060570911829516015,
+    0.0060570911829516015,
+    0.0060570911829516015,
+    0.0060570911829516015,
+    0.0060570911829516015,
+    0.0060570911829516015,
+    0.0059919266632633894,
+    0.0059919266632633894,
+    0.0059919266632633894,
+    0.0059919266632633894,
+    0.0059919266632633894,
+    0.0059919266632633894,
+    5.9973502997763222e-05,
+    5.9973502997763222e-05,
+    5.9973502997763222e-05,
+    0.0032622884235962843,
+    0.00094827935401653365,
+    0.00094827935401653365,
+    0.00094827935401653365,
+    0.0015307269147406006,
+    0.0015307269147406006,
+    0.0015307269147406006,
+    0.0019623092617679174,
+    0.0019623092617679174,
+    0.0019623092617679174,
+    0.0022899265466309617,
+    0.0022899265466309617,
+    0.0022899265466309617,
+    0.0025424258066058854,
+    0.0025424258066058854,
+    0.0025424258066058854,
+    0.0027383565341069522,
+    0.0027383565341069522,
+    0.0027383565341069522,
+    0.0028902324161887375,
+    0.0028902324161887375,
+    0.0028902324161887375,
+    0.0030069105838548163,
+    0.0030069105838548163,
+    0.0030069105838548163,
+    0.003094969439087963,
+    0.003094969439087963,
+    0.003094969439087963,
+    0.0031595439465519504,
+    0.0031595439465519504,
+    0.0031595439465519504,
+    0.0032048544860329249,
+    0.0032048544860329249,
+    0.0032048544860329249,
+    0.0032345537197381786,
+    0.0032345537197381786,
+    0.0032345537197381786,
+    0.0032519579966464626,
+    0.0032519579966464626,
+    0.0032519579966464626,
+    0.0032601964958505216,
+    0.0032601964958505216,
+    0.0032601964958505216,
+    0.0032611388327148526,
+    0.0032611388327148526,
+    0.0032611388327148526,
+    0.0032594246898012438,
+    0.0032594246898012438,
+    0.0032594246898012438,
+    0.0032593310048097952,
+    0.0032593310048097952,
+    0.0032593310048097952,
+    0.0032621182360569965,
+    0.0032621182360569965,
+    0.0032621182360569965,
+    0.0032676140422260242,
+    0.0032676140422260242,
+    0.0032676140422260242,
+    0.0032739747673792416,
+    0.0032739747673792416,
+    0.0032739747673792416,
+    0.0032782981497927249,
+    0.0032782981497927249,
+    0.0032782981497927249,
+    0.00069559472469801124,
+    0.00069559472469801124,
+    0.00069559472469801124,
+    0.00069559472469801124,
+    0.00069559472469801124,
+    0.00069559472469801124,
+    0.0010638464181120764,
+    0.0010638464181120764,
+    0.0010638464181120764,
+    0.0010638464181120764,
+    0.0010638464181120764,
+    0.0010638464181120764,
+    0.0012962384032686133,
+    0.0012962384032686133,
+    0.0012962384032686133,
+    0.0012962384032686133,
+    0.0012962384032686133,
+    0.0012962384032686133,
+    0.0014484783857731775,
+    0.0014484783857731775,
+    0.0014484783857731775,
+    0.0014484783857731775,
+    0.0014484783857731775,
+    0.0014484783857731775,
+    0.0015475353323042157,
+    0.0015475353323042157,
+    0.0015475353323042157,
+    0.0015475353323042157,
+    0.0015475353323042157,
+    0.0015475353323042157,
+    0.0016075646130772445,
+    0.0016075646130772445,
+    0.0016075646130772445,
+    0.0016075646130772445,
+    0.0016075646130772445,
+    0.0016075646130772445,
+    0.0016359717731933008,
+    0.0016359717731933008,
+    0.0016359717731933008,
+    0.0016359717731933008,
+    0.0016359717731933008,
+    0.0016359717731933008,
+    0.0018239260221651272,
+    0.0018239260221651272,
+    0.0018239260221651272,
+    0.0018239260221651272,
+    0.0018239260221651272,
+    0.0018239260221651272,
+    0.0021721643924631174,
+    0.0021721643924631174,
+    0.0021721643924631174,
+    0.0021721643924631174,
+    0.0021721643924631174,
+    0.0021721643924631174,
+    0.002446334317363181,
+    0.002446334317363181,
+    0.002446334317363181,
+    0.002446334317363181,
+    0.002446334317363181,
+    0.002446334317363181,
+    0.0026615304419620438,
+    0.0026615304419620438,
+    0.0026615304419620438,
+    0.0026615304419620438,
+    0.0026615304419620438,
+    0.0026615304419620438,
+    0.0028298677695120294,
+    0.0028298677695120294,
+    0.0028298677695120294,
+    0.0028298677695120294,
+    0.0028298677695120294,
+    0.0028298677695120294,
+    0.0029604540006265031,
+    0.0029604540006265031,
+    0.0029604540006265031,
+    0.0029604540006265031,
+    0.0029604540006265031,
+    0.0029604540006265031,
+    0.0030601962980712975,
+    0.0030601962980712975,
+    0.0030601962980712975,
+    0.0030601962980712975,
+    0.0030601962980712975,
+    0.0030601962980712975,
+    0.0031345001372146369,
+    0.0031345001372146369,
+    0.0031345001372146369,
+    0.0031345001372146369,
+    0.0031345001372146369,
+    0.0031345001372146369,
+    0.0031877763359500631,
+    0.0031877763359500631,
+    0.0031877763359500631,
+    0.0031877763359500631,
+    0.0031877763359500631,
+    0.0031877763359500631,
+    0.0032237968026705686,
+    0.0032237968026705686,
+    0.0032237968026705686,
+    0.0032237968026705686,
+    0.0032237968026705686,
+    0.0032237968026705686,
+    0.0032459429057253015,
+    0.0032459429057253015,
+    0.0032459429057253015,
+    0.0032459429057253015,
+    0.0032459429057253015,
+    0.0032459429057253015,
+    0.0032573754192918862,
+    0.0032573754192918862,
+    0.0032573754192918862,
+    0.0032573754192918862,
+    0.0032573754192918862,
+    0.0032573754192918862,
+    0.0023921895605312953,
+    0.0023921895605312953,
+    0.0023921895605312953,
+    0.0023921895605312953,
+    0.0023921895605312953,
+    0.0023921895605312953,
+    0.0026103613873703023,
+    0.0026103613873703023,
+    0.0026103613873703023,
+    0.0026103613873703023,
+    0.0026103613873703023,
+    0.0026103613873703023,
+    0.0027861076865939301,
+    0.0027861076865939301,
+    0.0027861076865939301,
+    0.0027861076865939301,
+    0.0027861076865939301,
+    0.0027861076865939301,
+    0.0029252773453607136,
+    0.0029252773453607136,
+    0.0029252773453607136,
+    0.0029252773453607136,
+    0.0029252773453607136,
+    0.0029252773453607136,
+    0.0030333923742353742,
+    0.0030333923742353742,
+    0.0030333923742353742,
+    0.0030333923742353742,
+    0.0030333923742353742,
+    0.0030333923742353742,
+    0.003115227560125524,
+    0.003115227560125524,
+    0.003115227560125524,
+    0.003115227560125524,
+    0.003115227560125524,
+    0.003115227560125524,
+    0.0031748801964066966,
+    0.0031748801964066966,
+    0.0031748801964066966,
+    0.0031748801964066966,
+    0.0031748801964066966,
+    0.0031748801964066966,
+    0.0032159450811360397,
+    0.0032159450811360397,
+    0.0032159450811360397,
+    0.0032159450811360397,
+    0.0032159450811360397,
+    0.0032159450811360397,
+    0.0032416870410228791,
+    0.0032416870410228791,
+    0.0032416870410228791,
+    0.0032416870410228791,
+    0.0032416870410228791,
+    0.0032416870410228791,
+    0.0032551828911527472,
+    0.0032551828911527472,
+    0.0032551828911527472,
+    0.0032551828911527472,
+    0.0032551828911527472,
+    0.0032551828911527472,
+    0.0027634202810557632,
+    0.0027634202810557632,
+    0.0027634202810557632,
+    0.0027634202810557632,
+    0.0027634202810557632,
+    0.0027634202810557632,
+    0.0029039708296063355,
+    0.0029039708296063355,
+    0.0029039708296063355,
+    0.0029039708296063355,
+    0.0029039708296063355,
+    0.0029039708296063355,
+    0.0030161497871118987,
+    0.0030161497871118987,
+    0.0030161497871118987,
+    0.0030161497871118987,
+    0.0030161497871118987,
+    0.0030161497871118987,
+    0.0031028868909555025,
+    0.0031028868909555025,
+    0.0031028868909555025,
+    0.0031028868909555025,
+    0.0031028868909555025,
+    0.0031028868909555025,
+    0.0031672522161770192,
+    0.0031672522161770192,
+    0.0031672522161770192,
+    0.0031672522161770192,
+    0.0031672522161770192,
+    0.0031672522161770192,
+    0.003212229580370856,
+    0.003212229580370856,
+    0.003212229580370856,
+    0.003212229580370856,
+    0.003212229580370856,
+    0.003212229580370856,
+    0.0032406934284917731,
+    0.0032406934284917731,
+    0.0032406934284917731,
+    0.0032406934284917731,
+    0.0032406934284917731,
+    0.0032406934284917731,
+    0.0032554561480415303,
+    0.0032554561480415303,
+    0.0032554561480415303,
+    0.0032554561480415303,
+    0.0032554561480415303,
+    0.0032554561480415303,
+    0.0030080967712502104,
+    0.0030080967712502104,
+    0.0030080967712502104,
+    0.0030080967712502104,
+    0.0030080967712502104,
+    0.0030080967712502104,
+    0.0030967756515344514,
+    0.0030967756515344514,
+    0.0030967756515344514,
+    0.0030967756515344514,
+    0.0030967756515344514,
+    0.0030967756515344514,
+    0.0031642302324272442,
+    0.0031642302324272442,
+    0.0031642302324272442,
+    0.0031642302324272442,
+    0.0031642302324272442,
+    0.0031642302324272442,
+    0.003212289529042134,
+    0.003212289529042134,
+    0.003212289529042134,
+    0.003212289529042134,
+    0.003212289529042134,
+    0.003212289529042134,
+    0.0032430695893756385,
+    0.0032430695893756385,
+    0.0032430695893756385,
+    0.0032430695893756385,
+    0.0032430695893756385,
+    0.0032430695893756385,
+    0.0032588629386392934,
+    0.0032588629386392934,
+    0.0032588629386392934,
+    0.0032588629386392934,
+    0.0032588629386392934,
+    0.0032588629386392934,
+    0.0031637027033851249,
+    0.0031637027033851249,
+    0.0031637027033851249,
+    0.0031637027033851249,
+    0.0031637027033851249,
+    0.0031637027033851249,
+    0.003214116407078024,
+    0.003214116407078024,
+    0.003214116407078024,
+    0.003214116407078024,
+    0.003214116407078024,
+    0.003214116407078024,
+    0.0032472242789210342,
+    0.0032472242789210342,
+    0.0032472242789210342,
+    0.0032472242789210342,
+    0.0032472242789210342,
+    0.0032472242789210342,
+    0.003264452647587904,
+    0.003264452647587904,
+    0.003264452647587904,
+    0.003264452647587904,
+    0.003264452647587904,
+    0.003264452647587904,
+    0.0032504150029317208,
+    0.0032504150029317208,
+    0.0032504150029317208,
+    0.0032504150029317208,
+    0.0032504150029317208,
+    0.0032504150029317208,
+    0.0032697530342397367,
+    0.0032697530342397367,
+    0.0032697530342397367,
+    0.0032697530342397367,
+    0.0032697530342397367,
+    0.0032697530342397367,
+    1.9470695892350971e-05,
+    1.9470695892350971e-05,
+    1.9470695892350971e-05,
+    0.00076303249672126684,
+    0.00076303249672126684,
+    0.00076303249672126684,
+    0.0015208476373900625,
+    0.00031411396311353698,
+    0.00031411396311353698,
+    0.00031411396311353698,
+    0.00053343243738355052,
+    0.00053343243738355052,
+    0.00053343243738355052,
+    0.00070951130520153084,
+    0.00070951130520153084,
+    0.00070951130520153084,
+    0.00085304480076709756,
+    0.00085304480076709756,
+    0.00085304480076709756,
+    0.00097160539466890233,
+    0.00097160539466890233,
+    0.00097160539466890233,
+    0.0010704437453126969,
+    0.0010704437453126969,
+    0.0010704437453126969,
+    0.0011533416189028031,
+    0.0011533416189028031,
+    0.0011533416189028031,
+    0.0012231041606612456,
+    0.0012231041606612456,
+    0.0012231041606612456,
+    0.0012818644990188874,
+    0.0012818644990188874,
+    0.0012818644990188874,
+    0.0013312821227561952,
+    0.0013312821227561952,
+    0.0013312821227561952,
+    0.0013726766832090583,
+    0.0013726766832090583,
+    0.0013726766832090583,
+    0.0014071208001064555,
+    0.0014071208001064555,
+    0.0014071208001064555,
+    0.0014355059882053887,
+    0.0014355059882053887,
+    0.0014355059882053887,
+    0.0014585904854059256,
+    0.0014585904854059256,
+    0.0014585904854059256,
+    0.0014770346023679807,
+    0.0014770346023679807,
+    0.0014770346023679807,
+    0.0014914272634584784,
+    0.0014914272634584784,
+    0.0014914272634584784,
+    0.0015023061557015312,
+    0.0015023061557015312,
+    0.0015023061557015312,
+    0.00151017305748162,
+    0.00151017305748162,
+    0.00151017305748162,
+    0.0015155053105405383,
+    0.0015155053105405383,
+    0.0015155053105405383,
+    0.0015187639196269033,
+    0.0015187639196269033,
+    0.0015187639196269033,
+    0.0015203983436622517,
+    0.0015203983436622517,
+    0.0015203983436622517,
+    0.0015205372015392735,
+    0.0015205372015392735,
+    0.0015205372015392735,
+    0.0015198700444268079,
+    0.0015198700444268079,
+    0.0015198700444268079,
+    0.0015192112905249831,
+    0.0015192112905249831,
+    0.0015192112905249831,
+    0.0015188650061640848,
+    0.0015188650061640848,
+    0.0015188650061640848,
+    0.0015190438048766021,
+    0.0015190438048766021,
+    0.0015190438048766021,
+    0.0015198348883411217,
+    0.0015198348883411217,
+    0.0015198348883411217,
+    0.0015211716438752936,
+    0.0015211716438752936,
+    0.0015211716438752936,
+    0.0015228265970076336,
+    0.0015228265970076336,
+    0.0015228265970076336,
+    0.0015244449267705822,
+    0.0015244449267705822,
+    0.0015244449267705822,
+    0.0015256297245308224,
+    0.0015256297245308224,
+    0.0015256297245308224,
+    0.00023971991376999869,
+    0.00023971991376999869,
+    0.00023971991376999869,
+    0.00023971991376999869,
+    0.00023971991376999869,
+    0.00023971991376999869,
+    0.00038996237529827904,
+    0.00038996237529827904,
+    0.00038996237529827904,
+    0.00038996237529827904,
+    0.00038996237529827904,
+    0.00038996237529827904,
+    0.00049667232183966319,
+    0.00049667232183966319,
+    0.00049667232183966319,
+    0.00049667232183966319,
+    0.00049667232183966319,
+    0.00049667232183966319,
+    0.00057505046171974405,
+    0.00057505046171974405,
+    0.00057505046171974405,
+    0.00057505046171974405,
+    0.00057505046171974405,
+    0.00057505046171974405,
+    0.00063368002191756083,
+    0.00063368002191756083,
+    0.00063368002191756083,
+    0.00063368002191756083,
+    0.00063368002191756083,
+    0.00063368002191756083,
+    0.00067777462039309759,
+    0.00067777462039309759,
+    0.00067777462039309759,
+    0.00067777462039309759,
+    0.00067777462039309759,
+    0.00067777462039309759,
+    0.00071064680560724313,
+    0.00071064680560724313,
+    0.00071064680560724313,
+    0.00071064680560724313,
+    0.00071064680560724313,
+    0.00071064680560724313,
+    0.00073445297377603064,
+    0.00073445297377603064,
+    0.00073445297377603064,
+    0.00073445297377603064,
+    0.00073445297377603064,
+    0.00073445297377603064,
+    0.00075059789083039316,
+    0.00075059789083039316,
+    0.00075059789083039316,
+    0.00075059789083039316,
+    0.00075059789083039316,
+    0.00075059789083039316,
+    0.00075996261413459278,
+    0.00075996261413459278,
+    0.00075996261413459278,
+    0.00075996261413459278,
+    0.00075996261413459278,
+    0.00075996261413459278,
+    0.00065146022566138799,
+    0.00065146022566138799,
+    0.00065146022566138799,
+    0.00065146022566138799,
+    0.00065146022566138799,
+    0.00065146022566138799,
+    0.00079990879127101833,
+    0.00079990879127101833,
+    0.00079990879127101833,
+    0.00079990879127101833,
+    0.00079990879127101833,
+    0.00079990879127101833,
+    0.0009249595224546872,
+    0.0009249595224546872,
+    0.0009249595224546872,
+    0.0009249595224546872,
+    0.0009249595224546872,
+    0.0009249595224546872,
+    0.0010301056741084105,
+    0.0010301056741084105,
+    0.0010301056741084105,
+    0.0010301056741084105,
+    0.0010301056741084105,
+    0.0010301056741084105,
+    0.0011187029146921112,
+    0.0011187029146921112,
+    0.0011187029146921112,
+    0.0011187029146921112,
+    0.0011187029146921112,
+    0.0011187029146921112,
+    0.0011935011747339127,
+    0.0011935011747339127,
+    0.0011935011747339127,
+    0.0011935011747339127,
+    0.0011935011747339127,
+    0.0011935011747339127,
+    0.0012566845433403648,
+    0.0012566845433403648,
+    0.0012566845433403648,
+    0.0012566845433403648,
+    0.0012566845433403648,
+    0.0012566845433403648,
+    0.00130998715848302,
+    0.00130998715848302,
+    0.00130998715848302,
+    0.00130998715848302,
+    0.00130998715848302,
+    0.00130998715848302,
+    0.0013548004533062744,
+    0.0013548004533062744,
+    0.0013548004533062744,
+    0.0013548004533062744,
+    0.0013548004533062744,
+    0.0013548004533062744,
+    0.0013922582155149064,
+    0.0013922582155149064,
+    0.0013922582155149064,
+    0.0013922582155149064,
+    0.0013922582155149064,
+    0.0013922582155149064,
+    0.0014233013098226368,
+    0.0014233013098226368,
+    0.0014233013098226368,
+    0.0014233013098226368,
+    0.0014233013098226368,
+    0.0014233013098226368,
+    0.0014487264870683299,
+    0.0014487264870683299,
+    0.0014487264870683299,
+    0.0014487264870683299,
+    0.0014487264870683299,
+    0.0014487264870683299,
+    0.0014692233060801521,
+    0.0014692233060801521,
+    0.0014692233060801521,
+    0.0014692233060801521,
+    0.0014692233060801521,
+    0.0014692233060801521,
+    0.0014854022734219034,
+    0.0014854022734219034,
+    0.0014854022734219034,
+    0.0014854022734219034,
+    0.0014854022734219034,
+    0.0014854022734219034,
+    0.0014978164532854659,
+    0.0014978164532854659,
+    0.0014978164532854659,
+    0.0014978164532854659,
+    0.0014978164532854659,
+    0.0014978164532854659,
+    0.0015069781164730456,
+    0.0015069781164730456,
+    0.0015069781164730456,
+    0.0015069781164730456,
+    0.0015069781164730456,
+    0.0015069781164730456,
+    0.0015133714596202376,
+    0.0015133714596202376,
+    0.0015133714596202376,
+    0.0015133714596202376,
+    0.0015133714596202376,
+    0.0015133714596202376,
+    0.0015174619843601168,
+    0.0015174619843601168,
+    0.0015174619843601168,
+    0.0015174619843601168,
+    0.0015174619843601168,
+    0.0015174619843601168,
+    0.0015197027336476224,
+    0.0015197027336476224,
+    0.0015197027336476224,
+    0.0015197027336476224,
+    0.0015197027336476224,
+    0.0015197027336476224,
+    0.00089864146320133519,
+    0.00089864146320133519,
+    0.00089864146320133519,
+    0.00089864146320133519,
+    0.00089864146320133519,
+    0.00089864146320133519,
+    0.0010029590613690215,
+    0.0010029590613690215,
+    0.0010029590613690215,
+    0.0010029590613690215,
+    0.0010029590613690215,
+    0.0010029590613690215,
+    0.0010930128941428249,
+    0.0010930128941428249,
+    0.0010930128941428249,
+    0.0010930128941428249,
+    0.0010930128941428249,
+    0.0010930128941428249,
+    0.0011701894848855344,
+    0.0011701894848855344,
+    0.0011701894848855344,
+    0.0011701894848855344,
+    0.0011701894848855344,
+    0.0011701894848855344,
+    0.0012360611733483295,
+    0.0012360611733483295,
+    0.0012360611733483295,
+    0.0012360611733483295,
+    0.0012360611733483295,
+    0.0012360611733483295,
+    0.0012920770246512053,
+    0.0012920770246512053,
+    0.0012920770246512053,
+    0.0012920770246512053,
+    0.0012920770246512053,
+    0.0012920770246512053,
+    0.0013394933117934073,
+    0.0013394933117934073,
+    0.0013394933117934073,
+    0.0013394933117934073,
+    0.0013394933117934073,
+    0.0013394933117934073,
+    0.00137938000195032,
+    0.00137938000195032,
+    0.00137938000195032,
+    0.00137938000195032,
+    0.00137938000195032,
+    0.00137938000195032,
+    0.0014126486583898306,
+    0.0014126486583898306,
+    0.0014126486583898306,
+    0.0014126486583898306,
+    0.0014126486583898306,
+    0.0014126486583898306,
+    0.0014400833008086007,
+    0.0014400833008086007,
+    0.0014400833008086007,
+    0.0014400833008086007,
+    0.0014400833008086007,
+    0.0014400833008086007,
+    0.0014623683498650271,
+    0.0014623683498650271,
+    0.0014623683498650271,
+    0.0014623683498650271,
+    0.0014623683498650271,
+    0.0014623683498650271,
+    0.0014801122405730463,
+    0.0014801122405730463,
+    0.0014801122405730463,
+    0.0014801122405730463,
+    0.0014801122405730463,
+    0.0014801122405730463,
+    0.0014938668059159505,
+    0.0014938668059159505,
+    0.0014938668059159505,
+    0.0014938668059159505,
+    0.0014938668059159505,
+    0.0014938668059159505,
+    0.001504142950910631,
+    0.001504142950910631,
+    0.001504142950910631,
+    0.001504142950910631,
+    0.001504142950910631,
+    0.001504142950910631,
+    0.0015114231405238064,
+    0.0015114231405238064,
+    0.0015114231405238064,
+    0.0015114231405238064,
+    0.0015114231405238064,
+    0.0015114231405238064,
+    0.0015161710660058767,
+    0.0015161710660058767,
+    0.0015161710660058767,
+    0.0015161710660058767,
+    0.0015161710660058767,
+    0.0015161710660058767,
+    0.001518838621917936,
+    0.001518838621917936,
+    0.001518838621917936,
+    0.001518838621917936,
+    0.001518838621917936,
+    0.001518838621917936,
+    0.0010792847487498729,
+    0.0010792847487498729,
+    0.0010792847487498729,
+    0.0010792847487498729,
+    0.0010792847487498729,
+    0.0010792847487498729,
+    0.0011552480546954608,
+    0.0011552480546954608,
+    0.0011552480546954608,
+    0.0011552480546954608,
+    0.0011552480546954608,
+    0.0011552480546954608,
+    0.0012214379127440064,
+    0.0012214379127440064,
+    0.0012214379127440064,
+    0.0012214379127440064,
+    0.0012214379127440064,
+    0.0012214379127440064,
+    0.0012785670171251793,
+    0.0012785670171251793,
+    0.0012785670171251793,
+    0.0012785670171251793,
+    0.0012785670171251793,
+    0.0012785670171251793,
+    0.0013274834948922647,
+    0.0013274834948922647,
+    0.0013274834948922647,
+    0.0013274834948922647,
+    0.0013274834948922647,
+    0.0013274834948922647,
+    0.0013690239287571522,
+    0.0013690239287571522,
+    0.0013690239287571522,
+    0.0013690239287571522,
+    0.0013690239287571522,
+    0.0013690239287571522,
+    0.0014039621804811521,
+    0.0014039621804811521,
+    0.0014039621804811521,
+    0.0014039621804811521,
+    0.0014039621804811521,
+    0.0014039621804811521,
+    0.0014329982806420233,
+    0.0014329982806420233,
+    0.0014329982806420233,
+    0.0014329982806420233,
+    0.0014329982806420233,
+    0.0014329982806420233,
+    0.0014567634407021727,
+    0.0014567634407021727,
+    0.0014567634407021727,
+    0.0014567634407021727,
+    0.0014567634407021727,
+    0.0014567634407021727,
+    0.0014758308196387592,
+    0.0014758308196387592,
+    0.0014758308196387592,
+    0.0014758308196387592,
+    0.0014758308196387592,
+    0.0014758308196387592,
+    0.001490727585364976,
+    0.001490727585364976,
+    0.001490727585364976,
+    0.001490727585364976,
+    0.001490727585364976,
+    0.001490727585364976,
+    0.0015019464070360545,
+    0.0015019464070360545,
+    0.0015019464070360545,
+    0.0015019464070360545,
+    0.0015019464070360545,
+    0.0015019464070360545,
+    0.0015099556349641855,
+    0.0015099556349641855,
+    0.0015099556349641855,
+    0.0015099556349641855,
+    0.0015099556349641855,
+    0.0015099556349641855,
+    0.001515207863500005,
+    0.001515207863500005,
+    0.001515207863500005,
+    0.001515207863500005,
+    0.001515207863500005,
+    0.001515207863500005,
+    0.0015181466760281583,
+    0.0015181466760281583,
+    0.0015181466760281583,
+    0.0015181466760281583,
+    0.0015181466760281583,
+    0.0015181466760281583,
+    0.0012138616299741225,
+    0.0012138616299741225,
+    0.0012138616299741225,
+    0.0012138616299741225,
+    0.0012138616299741225,
+    0.0012138616299741225,
+    0.0012701924459868343,
+    0.0012701924459868343,
+    0.0012701924459868343,
+    0.0012701924459868343,
+    0.0012701924459868343,
+    0.0012701924459868343,
+    0.0013192747058192774,
+    0.0013192747058192774,
+    0.0013192747058192774,
+    0.0013192747058192774,
+    0.0013192747058192774,
+    0.0013192747058192774,
+    0.0013615321729546122,
+    0.0013615321729546122,
+    0.0013615321729546122,
+    0.0013615321729546122,
+    0.0013615321729546122,
+    0.0013615321729546122,
+    0.0013974782025152519,
+    0.0013974782025152519,
+    0.0013974782025152519,
+    0.0013974782025152519,
+    0.0013974782025152519,
+    0.0013974782025152519,
+    0.0014276444096060557,
+    0.0014276444096060557,
+    0.0014276444096060557,
+    0.0014276444096060557,
+    0.0014276444096060557,
+    0.0014276444096060557,
+    0.0014525500496897392,
+    0.0014525500496897392,
+    0.0014525500496897392,
+    0.0014525500496897392,
+    0.0014525500496897392,
+    0.0014525500496897392,
+    0.0014726914965306418,
+    0.0014726914965306418,
+    0.0014726914965306418,
+    0.0014726914965306418,
+    0.0014726914965306418,
+    0.0014726914965306418,
+    0.0014885414283120047,
+    0.0014885414283120047,
+    0.0014885414283120047,
+    0.0014885414283120047,
+    0.0014885414283120047,
+    0.0014885414283120047,
+    0.0015005524669949625,
+    0.0015005524669949625,
+    0.0015005524669949625,
+    0.0015005524669949625,
+    0.0015005524669949625,
+    0.0015005524669949625,
+    0.0015091625890777799,
+    0.0015091625890777799,
+    0.0015091625890777799,
+    0.0015091625890777799,
+    0.0015091625890777799,
+    0.0015091625890777799,
+    0.0015148008986637159,
+    0.0015148008986637159,
+    0.0015148008986637159,
+    0.0015148008986637159,
+    0.0015148008986637159,
+    0.0015148008986637159,
+    0.0015178929476158945,
+    0.0015178929476158945,
+    0.0015178929476158945,
+    0.0015178929476158945,
+    0.0015178929476158945,
+    0.0015178929476158945,
+    0.0013151270521221889,
+    0.0013151270521221889,
+    0.0013151270521221889,
+    0.0013151270521221889,
+    0.0013151270521221889,
+    0.0013151270521221889,
+    0.0013570402807262143,
+    0.0013570402807262143,
+    0.0013570402807262143,
+    0.0013570402807262143,
+    0.0013570402807262143,
+    0.0013570402807262143,
+    0.0013932424830755863,
+    0.0013932424830755863,
+    0.0013932424830755863,
+    0.0013932424830755863,
+    0.0013932424830755863,
+    0.0013932424830755863,
+    0.0014240122259088737,
+    0.0014240122259088737,
+    0.0014240122259088737,
+    0.0014240122259088737,
+    0.0014240122259088737,
+    0.0014240122259088737,
+    0.0014496934296617,
+    0.0014496934296617,
+    0.0014496934296617,
+    0.0014496934296617,
+    0.0014496934296617,
+    0.0014496934296617,
+    0.0014706585264683367,
+    0.0014706585264683367,
+    0.0014706585264683367,
+    0.0014706585264683367,
+    0.0014706585264683367,
+    0.0014706585264683367,
+    0.0014872904958701896,
+    0.0014872904958701896,
+    0.0014872904958701896,
+    0.0014872904958701896,
+    0.0014872904958701896,
+    0.0014872904958701896,
+    0.0014999753761773583,
+    0.0014999753761773583,
+    0.0014999753761773583,
+    0.0014999753761773583,
+    0.0014999753761773583,
+    0.0014999753761773583,
+    0.0015091004901448611,
+    0.0015091004901448611,
+    0.0015091004901448611,
+    0.0015091004901448611,
+    0.0015091004901448611,
+    0.0015091004901448611,
+    0.0015150556606474208,
+    0.0015150556606474208,
+    0.0015150556606474208,
+    0.0015150556606474208,
+    0.0015150556606474208,
+    0.0015150556606474208,
+    0.0015182357986054133,
+    0.0015182357986054133,
+    0.0015182357986054133,
+    0.0015182357986054133,
+    0.0015182357986054133,
+    0.0015182357986054133,
+    0.001391171141267877,
+    0.001391171141267877,
+    0.001391171141267877,
+    0.001391171141267877,
+    0.001391171141267877,
+    0.001391171141267877,
+    0.0014219538878987728,
+    0.0014219538878987728,
+    0.0014219538878987728,
+    0.0014219538878987728,
+    0.0014219538878987728,
+    0.0014219538878987728,
+    0.0014480086520549751,
+    0.0014480086520549751,
+    0.0014480086520549751,
+    0.0014480086520549751,
+    0.0014480086520549751,
+    0.0014480086520549751,
+    0.0014695362545985029,
+    0.0014695362545985029,
+    0.0014695362545985029,
+    0.0014695362545985029,
+    0.0014695362545985029,
+    0.0014695362545985029,
+    0.0014867915785714623,
+    0.0014867915785714623,
+    0.0014867915785714623,
+    0.0014867915785714623,
+    0.0014867915785714623,
+    0.0014867915785714623,
+    0.0015000634739972736,
+    0.0015000634739972736,
+    0.0015000634739972736,
+    0.0015000634739972736,
+    0.0015000634739972736,
+    0.0015000634739972736,
+    0.001509664191281848,
+    0.001509664191281848,
+    0.001509664191281848,
+    0.001509664191281848,
+    0.001509664191281848,
+    0.001509664191281848,
+    0.0015159246017414578,
+    0.0015159246017414578,
+    0.0015159246017414578,
+    0.0015159246017414578,
+    0.0015159246017414578,
+    0.0015159246017414578,
+    0.0015191928489605561,
+    0.0015191928489605561,
+    0.0015191928489605561,
+    0.0015191928489605561,
+    0.0015191928489605561,
+    0.0015191928489605561,
+    0.0014472520131670328,
+    0.0014472520131670328,
+    0.0014472520131670328,
+    0.0014472520131670328,
+    0.0014472520131670328,
+    0.0014472520131670328,
+    0.0014690376972774394,
+    0.0014690376972774394,
+    0.0014690376972774394,
+    0.0014690376972774394,
+    0.0014690376972774394,
+    0.0014690376972774394,
+    0.0014867415329934952,
+    0.0014867415329934952,
+    0.0014867415329934952,
+    0.0014867415329934952,
+    0.0014867415329934952,
+    0.0014867415329934952,
+    0.0015005232809077128,
+    0.0015005232809077128,
+    0.0015005232809077128,
+    0.0015005232809077128,
+    0.0015005232809077128,
+    0.0015005232809077128,
+    0.0015105926014668022,
+    0.0015105926014668022,
+    0.0015105926014668022,
+    0.0015105926014668022,
+    0.0015105926014668022,
+    0.0015105926014668022,
+    0.0015171979070935833,
+    0.0015171979070935833,
+    0.0015171979070935833,
+    0.0015171979070935833,
+    0.0015171979070935833,
+    0.0015171979070935833,
+    0.0015206204241752968,
+    0.0015206204241752968,
+    0.0015206204241752968,
+    0.0015206204241752968,
+    0.0015206204241752968,
+    0.0015206204241752968,
+    0.0014868200331830512,
+    0.0014868200331830512,
+    0.0014868200331830512,
+    0.0014868200331830512,
+    0.0014868200331830512,
+    0.0014868200331830512,
+    0.0015009989520623579,
+    0.0015009989520623579,
+    0.0015009989520623579,
+    0.0015009989520623579,
+    0.0015009989520623579,
+    0.0015009989520623579,
+    0.0015115235512516857,
+    0.0015115235512516857,
+    0.0015115235512516857,
+    0.0015115235512516857,
+    0.0015115235512516857,
+    0.0015115235512516857,
+    0.001518534831412232,
+    0.001518534831412232,
+    0.001518534831412232,
+    0.001518534831412232,
+    0.001518534831412232,
+    0.001518534831412232,
+    0.0015222239525294176,
+    0.0015222239525294176,
+    0.0015222239525294176,
+    0.0015222239525294176,
+    0.0015222239525294176,
+    0.0015222239525294176,
+    0.0015121005133854519,
+    0.0015121005133854519,
+    0.0015121005133854519,
+    0.0015121005133854519,
+    0.0015121005133854519,
+    0.0015121005133854519,
+    0.0015195477102366009,
+    0.0015195477102366009,
+    0.0015195477102366009,
+    0.0015195477102366009,
+    0.0015195477102366009,
+    0.0015195477102366009,
+    0.0015236166854654008,
+    0.0015236166854654008,
+    0.0015236166854654008,
+    0.0015236166854654008,
+    0.0015236166854654008,
+    0.0015236166854654008,
+    0.0015244275989876504,
+    0.0015244275989876504,
+    0.0015244275989876504,
+    0.0015244275989876504,
+    0.0015244275989876504,
+    0.0015244275989876504,
+};
+
+// Select the lowest order rule accurate to about 1e-7 for a form factor
+// with largest half dimension R_max at qr = q R_max.  Sets the range of
+// points to use, returning zero if qr is beyond the highest order rule, in
+// which case the model should fall back to its Gauss-Legendre integral.
+static int
+lebedev_octant(double qr, int *start, int *end)
+{
+    for (int k=0; k < LEBEDEV_ORDERS; k++) {
+        if (qr <= LebedevQrMax[k]) {
+            *start = LebedevStart[k];
+            *end = LebedevStart[k+1];
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -112,7 +112,7 @@ Calculate_Scattering(double q, double cos_theta, double sin_theta, double radius
     double sld[8];
     //loop over random anisotropy axis with isotropic orientation gamma for Hkx and Hky
     //To be modified for textured material see also Weissmueller et al. PRB 63, 214414 (2001)
-    double total_F2 = 0.0;
+    SAS_ACC total_F2 = 0.0;
     for (int i = 0; i<GAUSS_N ;i++) {
       const double gamma = M_PI * (GAUSS_Z[i] + 1.0); // 0 .. 2 pi
       SINCOS(gamma, sin_gamma, cos_gamma);	
@@ -170,7 +170,7 @@ Iq(double q, double radius, double thickness, double nuc_sld_core, double nuc_sl
 {
   // slots to hold sincos function output of the orientation on the detector plane
   double sin_theta, cos_theta; 
-  double total_F1D = 0.0;
+  SAS_ACC total_F1D = 0.0;
   for (int j = 0; j<GAUSS_N ;j++) {
 
     const double theta = M_PI * (GAUSS_Z[j] + 1.0); // 0 .. 2 pi
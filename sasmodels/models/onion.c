@@ -1,11 +1,12 @@
-
+// Contribution at radius r from a shell with sld profile from sld_in to
+// sld_out across its thickness, at the inner (side=0) or outer (side=1)
+// edge, without the volume factor.  The trig functions and bessel term
+// depend only on qr, so they are passed in to be shared by the two shells
+// meeting at r.
 static double
-f_exp(double q, double r, double sld_in, double sld_out,
-    double thickness, double A, double side)
+f_exp(double qr, double sinqr, double cosqr, double bes, double r,
+    double sld_in, double sld_out, double thickness, double A, double side)
 {
-  const double vol = M_4PI_3 * cube(r);
-  const double qr = q * r;
-  const double bes = sas_3j1x_x(qr);
   const double alpha = A * r/thickness;
   double result;
   if (qr == 0.0) {
@@ -14,8 +15,6 @@ f_exp(double q, double r, double sld_in, double sld_out,
     const double qrsq = qr * qr;
     const double alphasq = alpha * alpha;
     const double sumsq = alphasq + qrsq;
-    double sinqr, cosqr;
-    SINCOS(qr, sinqr, cosqr);
     const double t1 = (alphasq - qrsq)*sinqr/qr - 2.0*alpha*cosqr;
     const double t2 = alpha*sinqr/qr - cosqr;
     const double fun = -3.0*(t1/sumsq - t2)/sumsq;
@@ -25,7 +24,7 @@ f_exp(double q, double r, double sld_in, double sld_out,
   } else {
     result = sld_in*bes;
   }
-  return vol * result;
+  return result;
 }
 
 static double
@@ -58,15 +57,29 @@ Fq(double q, double *F1, double *F2, double sld_core, double radius_core, double
     double A[])
 {
   int n = (int)(n_shells+0.5);
-  double r_out = radius_core;
-  double f = f_exp(q, r_out, sld_core, 0.0, 0.0, 0.0, 0.0);
-  for (int i=0; i < n; i++){
-    const double r_in = r_out;
-    r_out += thickness[i];
-    f -= f_exp(q, r_in, sld_in[i], sld_out[i], thickness[i], A[i], 0.0);
-    f += f_exp(q, r_out, sld_in[i], sld_out[i], thickness[i], A[i], 1.0);
+  double r = radius_core;
+  double f = 0.0;
+  // Boundary i is between shell i-1 (or the core) and shell i (or the
+  // solvent), so each radius needs only one sincos and bessel evaluation.
+  for (int i=0; i <= n; i++) {
+    const double qr = q * r;
+    double sinqr, cosqr;
+    SINCOS(qr, sinqr, cosqr);
+    const double bes = (fabs(qr) < SPH_J1C_CUTOFF
+        ? sas_3j1x_x(qr) : 3.0*(sinqr/qr - cosqr)/(qr*qr));
+    const double inside = (i == 0
+        ? f_exp(qr, sinqr, cosqr, bes, r, sld_core, 0.0, 0.0, 0.0, 0.0)
+        : f_exp(qr, sinqr, cosqr, bes, r, sld_in[i-1], sld_out[i-1],
+                thickness[i-1], A[i-1], 1.0));
+    const double outside = (i == n
+        ? f_exp(qr, sinqr, cosqr, bes, r, sld_solvent, 0.0, 0.0, 0.0, 0.0)
+        : f_exp(qr, sinqr, cosqr, bes, r, sld_in[i], sld_out[i],
+                thickness[i], A[i], 0.0));
+    f += M_4PI_3 * cube(r) * (inside - outside);
+    if (i < n) {
+      r += thickness[i];
+    }
   }
-  f -= f_exp(q, r_out, sld_solvent, 0.0, 0.0, 0.0, 0.0);
 
   *F1 = 1e-2 * f;
   *F2 = 1e-4 * f * f;
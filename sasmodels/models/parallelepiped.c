@@ -69,6 +69,29 @@ Fq(double q,
     double length_b,
     double length_c)
 {
+    // Multiply by contrast^2 and convert from [1e-12 A-1] to [cm-1]
+    const double V = form_volume(length_a, length_b, length_c);
+    const double contrast = (sld-solvent_sld);
+    const double s = contrast * V;
+
+    // Use the Lebedev rule on the octant when it is accurate enough.
+    const double half_max = 0.5*fmax(length_a, fmax(length_b, length_c));
+    int start, end;
+    if (lebedev_octant(q*half_max, &start, &end)) {
+        SAS_ACC total_F1 = 0.0;
+        SAS_ACC total_F2 = 0.0;
+        for (int k=start; k<end; k++) {
+            const double fq = sas_sinx_x(0.5*q*length_a*LebedevX[k])
+                * sas_sinx_x(0.5*q*length_b*LebedevY[k])
+                * sas_sinx_x(0.5*q*length_c*LebedevZ[k]);
+            total_F1 += LebedevW[k] * fq;
+            total_F2 += LebedevW[k] * fq * fq;
+        }
+        *F1 = 1.0e-2 * s * total_F1;
+        *F2 = 1.0e-4 * s * s * total_F2;
+        return;
+    }
+
     const double mu = 0.5 * q * length_b;
 
     // Scale sides by B
@@ -76,16 +99,16 @@ Fq(double q,
     const double c_scaled = length_c / length_b;
 
     // outer integral (with gauss points), integration limits = 0, 1
-    double outer_total_F1 = 0.0; //initialize integral
-    double outer_total_F2 = 0.0; //initialize integral
+    SAS_ACC outer_total_F1 = 0.0; //initialize integral
+    SAS_ACC outer_total_F2 = 0.0; //initialize integral
     for( int i=0; i<GAUSS_N; i++) {
         const double sigma = 0.5 * ( GAUSS_Z[i] + 1.0 );
         const double mu_proj = mu * sqrt(1.0-sigma*sigma);
 
         // inner integral (with gauss points), integration limits = 0, 1
         // corresponding to angles from 0 to pi/2.
-        double inner_total_F1 = 0.0;
-        double inner_total_F2 = 0.0;
+        SAS_ACC inner_total_F1 = 0.0;
+        SAS_ACC inner_total_F2 = 0.0;
         for(int j=0; j<GAUSS_N; j++) {
             const double uu = 0.5 * ( GAUSS_Z[j] + 1.0 );
             double sin_uu, cos_uu;
@@ -108,10 +131,6 @@ Fq(double q,
     outer_total_F1 *= 0.5;
     outer_total_F2 *= 0.5;
 
-    // Multiply by contrast^2 and convert from [1e-12 A-1] to [cm-1]
-    const double V = form_volume(length_a, length_b, length_c);
-    const double contrast = (sld-solvent_sld);
-    const double s = contrast * V;
     *F1 = 1.0e-2 * s * outer_total_F1;
     *F2 = 1.0e-4 * s * s * outer_total_F2;
 }
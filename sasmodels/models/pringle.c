@@ -84,7 +84,7 @@ double _integrate_psi(
     const double zm = M_PI_4;
     const double zb = M_PI_4;
 
-    double sum = 0.0;
+    SAS_ACC sum = 0.0;
     for (int i = 0; i < GAUSS_N; i++) {
         double psi = GAUSS_Z[i]*zm + zb;
         double sin_psi, cos_psi;
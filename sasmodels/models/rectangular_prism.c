@@ -56,7 +56,7 @@ Iq(double q,
     const double v2a = 0.0;
     const double v2b = M_PI_2;  //phi integration limits
 
-    double outer_sum = 0.0;
+    SAS_ACC outer_sum = 0.0;
     for(int i=0; i<GAUSS_N; i++) {
         const double theta = 0.5 * ( GAUSS_Z[i]*(v1b-v1a) + v1a + v1b );
         double sin_theta, cos_theta;
@@ -64,7 +64,7 @@ Iq(double q,
 
         const double termC = sas_sinx_x(q * c_half * cos_theta);
 
-        double inner_sum = 0.0;
+        SAS_ACC inner_sum = 0.0;
         for(int j=0; j<GAUSS_N; j++) {
             double phi = 0.5 * ( GAUSS_Z[j]*(v2b-v2a) + v2a + v2b );
             double sin_phi, cos_phi;
@@ -115,14 +115,35 @@ Fq(double q,
     const double b_half = 0.5 * length_b;
     const double c_half = 0.5 * length_c;
 
+    // Multiply by contrast and volume
+    const double s = (sld-solvent_sld) * (length_a * length_b * length_c);
+
+    // Use the Lebedev rule on the octant when it is accurate enough.
+    const double half_max = fmax(a_half, fmax(b_half, c_half));
+    int start, end;
+    if (lebedev_octant(q*half_max, &start, &end)) {
+        SAS_ACC sum_F1 = 0.0;
+        SAS_ACC sum_F2 = 0.0;
+        for (int k=start; k<end; k++) {
+            const double AP = sas_sinx_x(q * a_half * LebedevX[k])
+                * sas_sinx_x(q * b_half * LebedevY[k])
+                * sas_sinx_x(q * c_half * LebedevZ[k]);
+            sum_F1 += LebedevW[k] * AP;
+            sum_F2 += LebedevW[k] * AP * AP;
+        }
+        *F1 = 1e-2 * s * sum_F1;
+        *F2 = 1e-4 * s * s * sum_F2;
+        return;
+    }
+
    //Integration limits to use in Gaussian quadrature
     const double v1a = 0.0;
     const double v1b = M_PI_2;  //theta integration limits
     const double v2a = 0.0;
     const double v2b = M_PI_2;  //phi integration limits
 
-    double outer_sum_F1 = 0.0;
-    double outer_sum_F2 = 0.0;
+    SAS_ACC outer_sum_F1 = 0.0;
+    SAS_ACC outer_sum_F2 = 0.0;
     for(int i=0; i<GAUSS_N; i++) {
         const double theta = 0.5 * ( GAUSS_Z[i]*(v1b-v1a) + v1a + v1b );
         double sin_theta, cos_theta;
@@ -130,8 +151,8 @@ Fq(double q,
 
         const double termC = sas_sinx_x(q * c_half * cos_theta);
 
-        double inner_sum_F1 = 0.0;
-        double inner_sum_F2 = 0.0;
+        SAS_ACC inner_sum_F1 = 0.0;
+        SAS_ACC inner_sum_F2 = 0.0;
         for(int j=0; j<GAUSS_N; j++) {
             double phi = 0.5 * ( GAUSS_Z[j]*(v2b-v2a) + v2a + v2b );
             double sin_phi, cos_phi;
@@ -161,9 +182,6 @@ Fq(double q,
     outer_sum_F1 /= M_PI_2;
     outer_sum_F2 /= M_PI_2;
 
-    // Multiply by contrast and volume
-    const double s = (sld-solvent_sld) * (length_a * length_b * length_c);
-
     // Convert from [1e-12 A-1] to [cm-1]
     *F1 = 1e-2 * s * outer_sum_F1;
     *F2 = 1e-4 * s * s * outer_sum_F2;
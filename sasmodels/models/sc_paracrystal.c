@@ -52,9 +52,9 @@ Iq(double q, double dnn,
     const double theta_b = M_PI_4;
 
 
-    double outer_sum = 0.0;
+    SAS_ACC outer_sum = 0.0;
     for(int i=0; i<GAUSS_N; i++) {
-        double inner_sum = 0.0;
+        SAS_ACC inner_sum = 0.0;
         const double theta = GAUSS_Z[i]*theta_m + theta_b;
         double sin_theta, cos_theta;
         SINCOS(theta, sin_theta, cos_theta);
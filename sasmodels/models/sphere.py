@@ -74,7 +74,13 @@ parameters = [["sld", "1e-6/Ang^2", 1, [-inf, inf], "sld",
 source = ["lib/sas_3j1x_x.c", "sphere.c"]
 have_Fq = True
 radius_effective_modes = ["radius"]
+scale_invariant = "radius"
 #single = False
+
+def concentric_shells(sld, sld_solvent, radius):
+    """Interfaces for the closed form radius dispersity."""
+    return [sld - sld_solvent], [0.], [0.]
+
 def random():
     """Return a random parameter set for the model."""
     radius = 10**np.random.uniform(1.3, 4)
@@ -24,95 +24,78 @@ radius_effective(int mode, double fp_n_shells, double thickness[], double interf
     return outer_radius(fp_n_shells, thickness, interface);
 }
 
-static double blend(int shape, double nu, double z)
+// Normalization for the interface profile, which depends only on the
+// shape parameters so it is computed once per shell rather than per step.
+static double blend_norm(int shape, double nu)
 {
     if (shape==0) {
-        const double num = sas_erf(nu * M_SQRT1_2 * (2.0*z - 1.0));
-        const double denom = 2.0 * sas_erf(nu * M_SQRT1_2);
-        return num/denom + 0.5;
+        return 2.0 * sas_erf(nu * M_SQRT1_2);
+    } else if (shape==3) {
+        return expm1(-nu);
+    } else if (shape==4) {
+        return expm1(nu);
+    } else {
+        return 1.0;
+    }
+}
+
+static double blend(int shape, double nu, double norm, double z)
+{
+    if (shape==0) {
+        return sas_erf(nu * M_SQRT1_2 * (2.0*z - 1.0))/norm + 0.5;
     } else if (shape==1) {
         return pow(z, nu);
     } else if (shape==2) {
         return 1.0 - pow(1.0 - z, nu);
     } else if (shape==3) {
-        return expm1(-nu*z)/expm1(-nu);
+        return expm1(-nu*z)/norm;
     } else if (shape==4) {
-        return expm1(nu*z)/expm1(nu);
+        return expm1(nu*z)/norm;
     } else if (shape==5) {
-        return 1.0 - pow(1.0 - z*z, (0.5*nu-2.0));        
+        return 1.0 - pow(1.0 - z*z, (0.5*nu-2.0));
     } else {
         return NAN;
     }
 }
 
-static double f_linear(double q, double r, double contrast, double slope)
+// Point below which the slope term g(qr) uses the Taylor series.
+#if FLOAT_SIZE>4
+#define SPHERICAL_SLD_CUTOFF 1.0
+#else
+#define SPHERICAL_SLD_CUTOFF 1.5
+#endif
+
+// Within each sub-shell the sld is linear, contrast + slope*r, so the
+// amplitude is a sum of terms at the sub-shell boundaries.  Rather than
+// evaluating the inner and outer term of each sub-shell separately, the
+// two terms meeting at radius r are combined into one using the change
+// in contrast and slope across the boundary.
+//
+// The slope term for a boundary is 4 pi r^4 (g(qr) + 2/(qr)^4) with
+//
+//     g(x) = (2 x sin x - (x^2 - 2) cos x - 2)/x^4
+//
+// The 8 pi/q^4 parts sum to 8 pi/q^4 times the total change in slope,
+// which is zero since the core and the solvent are flat, so they are
+// dropped.  Keeping them leaves a large cancellation at low q.
+static double f_boundary(double q, double r, double d_contrast, double d_slope)
 {
     const double qr = q * r;
     const double qrsq = qr * qr;
-    const double bes = sas_3j1x_x(qr);
     double sinqr, cosqr;
     SINCOS(qr, sinqr, cosqr);
-    const double fun = 3.0*r*(2.0*qr*sinqr - (qrsq-2.0)*cosqr)/(qrsq*qrsq);
-    const double vol = M_4PI_3 * cube(r);
-    return vol*(bes*contrast + fun*slope);
-}
-
-static double Iq(
-    double q,
-    double fp_n_shells,
-    double sld_solvent,
-    double sld[],
-    double thickness[],
-    double interface[],
-    double shape[],
-    double nu[],
-    double fp_n_steps)
-{
-    // iteration for # of shells + core + solvent
-    int n_shells = (int)(fp_n_shells + 0.5);
-    int n_steps = (int)(fp_n_steps + 0.5);
-    double f=0.0;
-    double r=0.0;
-    for (int shell=0; shell<n_shells; shell++){
-        const double sld_l = sld[shell];
-
-        // uniform shell; r=0 => r^3=0 => f=0, so works for core as well.
-        f -= M_4PI_3 * cube(r) * sld_l * sas_3j1x_x(q*r);
-        r += thickness[shell];
-        f += M_4PI_3 * cube(r) * sld_l * sas_3j1x_x(q*r);
-
-        // iterate over sub_shells in the interface
-        const double dr = interface[shell]/n_steps;
-        const double delta = (shell==n_shells-1 ? sld_solvent : sld[shell+1]) - sld_l;
-        const double nu_shell = fmax(fabs(nu[shell]), 1.e-14);
-        const int shape_shell = (int)(shape[shell]);
-
-        // if there is no interface the equations don't work
-        if (dr == 0.) continue;
-
-        double sld_in = sld_l;
-        for (int step=1; step <= n_steps; step++) {
-            // find sld_i at the outer boundary of sub-shell step
-            //const double z = (double)step/(double)n_steps;
-            const double z = (double)step/(double)n_steps;
-            const double fraction = blend(shape_shell, nu_shell, z);
-            const double sld_out = fraction*delta + sld_l;
-            // calculate slope
-            const double slope = (sld_out - sld_in)/dr;
-            const double contrast = sld_in - slope*r;
-
-            // iteration for the left and right boundary of the shells
-            f -= f_linear(q, r, contrast, slope);
-            r += dr;
-            f += f_linear(q, r, contrast, slope);
-            sld_in = sld_out;
-        }
+    double bes, g;
+    if (qr < SPHERICAL_SLD_CUTOFF) {
+        bes = sas_3j1x_x(qr);
+        g = 1./4. + qrsq*(-1./36. + qrsq*(1./960. + qrsq*(-1./50400.
+            + qrsq*(1./4354560. + qrsq*(-1./558835200.
+            + qrsq*(1./99632332800. + qrsq*(-1./23538138624000.)))))));
+    } else {
+        bes = 3.0*(sinqr/qr - cosqr)/qrsq;
+        g = (2.0*qr*sinqr - (qrsq-2.0)*cosqr - 2.0)/(qrsq*qrsq);
     }
-    // add in solvent effect
-    f -= M_4PI_3 * cube(r) * sld_solvent * sas_3j1x_x(q*r);
-
-    const double f2 = f * f * 1.0e-4;
-    return f2;
+    const double vol = M_4PI_3 * cube(r);
+    return vol*(bes*d_contrast + 3.0*r*g*d_slope);
 }
 
 static void Fq(
@@ -133,19 +116,26 @@ static void Fq(
     int n_steps = (int)(fp_n_steps + 0.5);
     double f=0.0;
     double r=0.0;
+    // sld = contrast + slope*r for the sub-shell inside the current radius
+    double contrast = sld[0];
+    double slope = 0.0;
     for (int shell=0; shell<n_shells; shell++){
         const double sld_l = sld[shell];
 
-        // uniform shell; r=0 => r^3=0 => f=0, so works for core as well.
-        f -= M_4PI_3 * cube(r) * sld_l * sas_3j1x_x(q*r);
+        // uniform shell; nothing to add at r=0 for the core.
+        if (r > 0.0) {
+            f += f_boundary(q, r, contrast - sld_l, slope);
+        }
+        contrast = sld_l;
+        slope = 0.0;
         r += thickness[shell];
-        f += M_4PI_3 * cube(r) * sld_l * sas_3j1x_x(q*r);
 
         // iterate over sub_shells in the interface
         const double dr = interface[shell]/n_steps;
         const double delta = (shell==n_shells-1 ? sld_solvent : sld[shell+1]) - sld_l;
         const double nu_shell = fmax(fabs(nu[shell]), 1.e-14);
         const int shape_shell = (int)(shape[shell]);
+        const double norm = blend_norm(shape_shell, nu_shell);
 
         // if there is no interface the equations don't work
         if (dr == 0.) continue;
@@ -153,23 +143,23 @@ static void Fq(
         double sld_in = sld_l;
         for (int step=1; step <= n_steps; step++) {
             // find sld_i at the outer boundary of sub-shell step
-            //const double z = (double)step/(double)n_steps;
             const double z = (double)step/(double)n_steps;
-            const double fraction = blend(shape_shell, nu_shell, z);
+            const double fraction = blend(shape_shell, nu_shell, norm, z);
             const double sld_out = fraction*delta + sld_l;
             // calculate slope
-            const double slope = (sld_out - sld_in)/dr;
-            const double contrast = sld_in - slope*r;
+            const double slope_step = (sld_out - sld_in)/dr;
+            const double contrast_step = sld_in - slope_step*r;
 
-            // iteration for the left and right boundary of the shells
-            f -= f_linear(q, r, contrast, slope);
+            // boundary between the previous sub-shell and this one
+            f += f_boundary(q, r, contrast - contrast_step, slope - slope_step);
+            contrast = contrast_step;
+            slope = slope_step;
             r += dr;
-            f += f_linear(q, r, contrast, slope);
             sld_in = sld_out;
         }
     }
     // add in solvent effect
-    f -= M_4PI_3 * cube(r) * sld_solvent * sas_3j1x_x(q*r);
+    f += f_boundary(q, r, contrast - sld_solvent, slope);
 
     *F1 = 1e-2*f;
     *F2 = 1e-4*f*f;
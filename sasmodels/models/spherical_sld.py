@@ -268,7 +268,7 @@ parameters = [["n_shells",             "",           1,      [1, 10],        "vo
              ]
 # pylint: enable=bad-whitespace, line-too-long
 source = ["lib/polevl.c", "lib/sas_erf.c", "lib/sas_3j1x_x.c", "spherical_sld.c"]
-single = False  # TODO: fix low q behaviour
+single = True
 have_Fq = True
 radius_effective_modes = ["outer radius"]
 
@@ -341,4 +341,15 @@ tests = [
       "shape": [0]*5,
       "nu": [2.5]*5,
      }, 0.001, 750697.238],
+    # Low q limit is the square of the total excess scattering length of the
+    # profile divided by the volume, plus background.
+    [{"n_shells": 5,
+      "n_steps": 35,
+      "sld_solvent": 1.0,
+      "sld": [2.07, 4.0, 3.5, 4.0, 3.5],
+      "thickness": [50.0, 100.0, 100.0, 100.0, 100.0],
+      "interface": [50]*5,
+      "shape": [0]*5,
+      "nu": [2.5]*5,
+     }, 1e-6, 821564.6126],
 ]
@@ -46,12 +46,8 @@ stacked_disks_kernel(
     //d*cos_alpha is the projection of d onto q (in other words the component
     //of d that is parallel to q.
     double debye_arg = -0.5*square(qd_cos_alpha*sigma_dnn);
-    double sq=0.0;
-    for (int kk=1; kk<n_stacking; kk++) {
-        sq += (n_stacking-kk) * cos(qd_cos_alpha*kk) * exp(debye_arg*kk);
-    }
-    // end of loop for S(q)
-    sq = 1.0 + 2.0*sq/n_stacking;
+    // S(q) = 1 + 2/n sum_{k=1}^{n-1} (n-k) cos(k qd cos_alpha) exp(k debye_arg)
+    double sq = lattice_sum_geometric(n_stacking, debye_arg, qd_cos_alpha);
 
     return pq * sq * n_stacking;
     // volume normalization should be per disk not per stack but form_volume
@@ -75,7 +71,7 @@ stacked_disks_1d(
 /*    StackedDiscsX  :  calculates the form factor of a stacked "tactoid" of core shell disks
 like clay platelets that are not exfoliated
 */
-    double summ = 0.0;    //initialize integral
+    SAS_ACC summ = 0.0;    //initialize integral
 
     double d = 2.0*thick_layer+thick_core;
     double halfheight = 0.5*thick_core;
@@ -146,7 +146,8 @@ parameters = [
     ]
 # pylint: enable=bad-whitespace, line-too-long
 
-source = ["lib/polevl.c", "lib/sas_J1.c", "lib/gauss76.c", "stacked_disks.c"]
+source = ["lib/polevl.c", "lib/sas_J1.c", "lib/gauss76.c", "lib/lattice_sum.c",
+          "stacked_disks.c"]
 
 def random():
     """Return a random parameter set for the model."""
@@ -298,5 +299,15 @@ tests = [
       'scale': 0.01,
       'background': 0.001,
      }, ([1.3, 1.57]), [0.0010039, 0.0010038]],
+    # Large stacks, with and without spacing disorder, from the term by term
+    # sum of the layers
+    [{'radius': 100.0, 'n_stacking': 300, 'sigma_d': 3.0,
+      'scale': 1.0, 'background': 0.0,
+     }, [0.001, 0.05, 0.2094, 0.5],
+     [129600.67239, 151.76968240, 0.80834779463, 0.019462850629]],
+    [{'radius': 100.0, 'n_stacking': 300, 'sigma_d': 0.0,
+      'scale': 1.0, 'background': 0.0,
+     }, [0.001, 0.05, 0.2094, 0.5],
+     [122430.30099, 46.175546522, 38.682563061, 0.020392653449]],
     ]
 # 11Jan2017   RKH checking unit test again, note they are all 1D, no 2D
@@ -46,7 +46,7 @@ static double oriented_superball(
   const double radius = length_a / 2.0; // superball radius
   const double inverse_2p = 1.0 / (2.0 * exponent_p);
 
-  double outer_integral = 0.0; //initialize integral
+  SAS_ACC outer_integral = 0.0; //initialize integral
 
   for (int i_x = 0; i_x < GAUSS_N; i_x++)
   {
@@ -55,7 +55,7 @@ static double oriented_superball(
     const double gamma = pow(1.0 - x2p, inverse_2p);
 
     // inner integral for y
-    double inner_integral = 0.0; //initialize integral
+    SAS_ACC inner_integral = 0.0; //initialize integral
     for (int i_y = 0; i_y < GAUSS_N; i_y++)
     {
       const double y = 0.5 * gamma * (GAUSS_Z[i_y] + 1.0); // integrate 0, gamma
@@ -97,8 +97,8 @@ Fq(double q,
   const double zm = M_PI_4;
   const double zb = M_PI_4;
 
-  double orient_averaged_outer_total_F1 = 0.0; //initialize integral
-  double orient_averaged_outer_total_F2 = 0.0; //initialize integral
+  SAS_ACC orient_averaged_outer_total_F1 = 0.0; //initialize integral
+  SAS_ACC orient_averaged_outer_total_F2 = 0.0; //initialize integral
   // phi integral
   for (int i_phi = 0; i_phi < GAUSS_N; i_phi++)
   {
@@ -108,8 +108,8 @@ Fq(double q,
     double sin_phi, cos_phi;
     SINCOS(phi, sin_phi, cos_phi);
 
-    double orient_averaged_inner_total_F1 = 0.0; //initialize integral
-    double orient_averaged_inner_total_F2 = 0.0; //initialize integral
+    SAS_ACC orient_averaged_inner_total_F1 = 0.0; //initialize integral
+    SAS_ACC orient_averaged_inner_total_F2 = 0.0; //initialize integral
     // theta integral
     for (int i_theta = 0; i_theta < GAUSS_N; i_theta++)
     {
@@ -98,20 +98,43 @@ Fq(double q,
     double radius_equat_major,
     double radius_polar)
 {
+    const double volume = form_volume(radius_equat_minor, radius_equat_major, radius_polar);
+    const double contrast = (sld - sld_solvent);
+
+    // Use the Lebedev rule on the octant when it is accurate enough.
+    const double radius_max = fmax(radius_polar,
+        fmax(radius_equat_minor, radius_equat_major));
+    int start, end;
+    if (lebedev_octant(q*radius_max, &start, &end)) {
+        SAS_ACC sum_F1 = 0.0;
+        SAS_ACC sum_F2 = 0.0;
+        for (int k=start; k<end; k++) {
+            const double r = sqrt(square(radius_equat_minor*LebedevX[k])
+                                  + square(radius_equat_major*LebedevY[k])
+                                  + square(radius_polar*LebedevZ[k]));
+            const double fq = sas_3j1x_x(q*r);
+            sum_F1 += LebedevW[k] * fq;
+            sum_F2 += LebedevW[k] * fq * fq;
+        }
+        *F1 = 1.0e-2 * contrast * volume * sum_F1;
+        *F2 = 1.0e-4 * square(contrast * volume) * sum_F2;
+        return;
+    }
+
     const double pa = square(radius_equat_minor/radius_equat_major) - 1.0;
     const double pc = square(radius_polar/radius_equat_major) - 1.0;
     // translate a point in [-1,1] to a point in [0, pi/2]
     const double zm = M_PI_4;
     const double zb = M_PI_4;
-    double outer_sum_F1 = 0.0;
-    double outer_sum_F2 = 0.0;
+    SAS_ACC outer_sum_F1 = 0.0;
+    SAS_ACC outer_sum_F2 = 0.0;
     for (int i=0;i<GAUSS_N;i++) {
         //const double u = GAUSS_Z[i]*(upper-lower)/2 + (upper + lower)/2;
         const double phi = GAUSS_Z[i]*zm + zb;
         const double pa_sinsq_phi = pa*square(sin(phi));
 
-        double inner_sum_F1 = 0.0;
-        double inner_sum_F2 = 0.0;
+        SAS_ACC inner_sum_F1 = 0.0;
+        SAS_ACC inner_sum_F2 = 0.0;
         const double um = 0.5;
         const double ub = 0.5;
         for (int j=0;j<GAUSS_N;j++) {
@@ -129,8 +152,6 @@ Fq(double q,
     outer_sum_F1 *= 0.25;  // = outer*um*zm*8.0/(4.0*M_PI);
     outer_sum_F2 *= 0.25;  // = outer*um*zm*8.0/(4.0*M_PI);
 
-    const double volume = form_volume(radius_equat_minor, radius_equat_major, radius_polar);
-    const double contrast = (sld - sld_solvent);
     *F1 = 1.0e-2 * contrast * volume * outer_sum_F1;
     *F2 = 1.0e-4 * square(contrast * volume) * outer_sum_F2;
 }
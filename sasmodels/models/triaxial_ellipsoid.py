@@ -158,7 +158,8 @@ parameters = [["sld", "1e-6/Ang^2", 4, [-inf, inf], "sld",
                "rotation about polar axis"],
              ]
 
-source = ["lib/sas_3j1x_x.c", "lib/gauss76.c", "triaxial_ellipsoid.c"]
+source = ["lib/sas_3j1x_x.c", "lib/gauss76.c", "lib/lebedev.c",
+          "triaxial_ellipsoid.c"]
 # Equations do not require Ra <= Rb <= Rc so don't test for it.
 #valid = ("radius_equat_minor <= radius_equat_major"
 #         " && radius_equat_major <= radius_polar")
@@ -80,6 +80,16 @@ therefore we compute
         \sum_{l=1}^{n} \frac{\lambda^{k-1}}{k!} F^k \right\}
     \, \int I_1(q) {\rm d}q
 
+Without the cut, the series sums to a closed form
+
+.. math::
+    \sum_{k=1}^{\infty} \frac{\lambda^{k-1}}{k!} F^k
+    = \frac{e^{\lambda F} - 1}{\lambda}
+
+which is what is used unless a coverage is given.  It costs one complex
+exponential for each Fourier component rather than $n$ multiply-adds,
+and it includes all scattering orders.
+
 For speed we may use the fast fourier transform with a power of two.
 The resulting $I(q)$ will be linearly spaced and likely heavily oversampled.
 The usual pinhole or slit resolution calculation can performed from these
@@ -99,12 +109,13 @@ import argparse
 
 import numpy as np
 from numpy import pi
-from scipy.special import gamma
+from scipy.special import gamma, cosm1
 
 from sasmodels import core
 from sasmodels import compare
 from sasmodels.resolution import Resolution, bin_edges
 from sasmodels.direct_model import call_kernel
+from sasmodels import trace
 import sasmodels.kernelcl
 
 # TODO: select fast and accurate fft library
@@ -151,14 +162,16 @@ class ICalculator(object):
         """
         raise NotImplementedError()
 
-    def multiple_scattering(self, Iq, p, coverage=0.99):
+    def multiple_scattering(self, Iq, p, coverage=None):
         r"""
         Compute multiple scattering for I(q) given scattering probability p.
 
         Given a probability p of scattering with the thickness, the expected
         number of scattering events, $\lambda = -\log(1 - p)$, giving a
         Poisson weighted sum of single, double, triple, etc. scattering patterns.
-        The number of patterns used is based on coverage (default 99%).
+        By default all patterns are summed in closed form.  If coverage is
+        given (e.g., 0.99), the sum is cut at the number of patterns which
+        cover that fraction of the Poisson probability.
         """
         raise NotImplementedError()
 
@@ -184,14 +197,17 @@ class NumpyCalculator(ICalculator):
         #print("ifft time", time.time()-t0)
         return result
 
-    def multiple_scattering(self, Iq, p, coverage=0.99):
+    def multiple_scattering(self, Iq, p, coverage=None):
         #t0 = time.time()
-        coeffs = scattering_coeffs(p, coverage)
-        poly = np.asarray(coeffs[::-1], dtype=self.dtype)
         scale = np.sum(Iq)
         frame = _forward_shift(Iq/scale, dtype=self.dtype)
         fourier_frame = np.fft.fft2(frame)
-        convolved = fourier_frame * np.polyval(poly, fourier_frame)
+        if coverage is None:
+            convolved = scattering_sum(fourier_frame, p)
+        else:
+            coeffs = scattering_coeffs(p, coverage)
+            poly = np.asarray(coeffs[::-1], dtype=self.dtype)
+            convolved = fourier_frame * np.polyval(poly, fourier_frame)
         frame = np.fft.ifft2(convolved)
         result = scale * _inverse_shift(frame.real, dtype=self.dtype)
         #print("numpy multiscat time", time.time()-t0)
@@ -221,6 +237,22 @@ kernel void polyval1(
         array[index] = total * x;
     }
 }
+
+// poisson_sum(L, n, array) replaces each complex value x in array with
+// (exp(L x) - 1)/L, using expm1 so that small |L x| keep their precision.
+kernel void poisson_sum(
+    const double L,
+    const int n,
+    global double2 *array)
+{
+    int index = get_global_id(0);
+    if (index < n) {
+        const double a = L*array[index].x;
+        const double b = L*array[index].y;
+        const double s = sin(0.5*b);
+        array[index] = (double2)((expm1(a)*cos(b) - 2.0*s*s)/L, exp(a)*sin(b)/L);
+    }
+}
 """
 
 class OpenclCalculator(ICalculator):
@@ -229,6 +261,8 @@ class OpenclCalculator(ICalculator):
     """
     polyval1f = None
     polyval1d = None
+    poisson_sumf = None
+    poisson_sumd = None
     def __init__(self, dims, dtype=PRECISION):
         dtype = np.dtype(dtype)
         env = sasmodels.kernelcl.environment()
@@ -239,18 +273,22 @@ class OpenclCalculator(ICalculator):
                     context, POLYVAL1_KERNEL, dtype, fast=USE_FAST)
                 # Assume context is always the same for a given dtype
                 OpenclCalculator.polyval1f = program.polyval1
+                OpenclCalculator.poisson_sumf = program.poisson_sum
             self.dtype = dtype
             self.complex_dtype = np.dtype('F')
             self.polyval1 = OpenclCalculator.polyval1f
+            self.poisson_sum = OpenclCalculator.poisson_sumf
         else:
             if OpenclCalculator.polyval1d is None:
                 program = sasmodels.kernelcl.compile_model(
                     context, POLYVAL1_KERNEL, dtype, fast=False)
                 # Assume context is always the same for a given dtype
                 OpenclCalculator.polyval1d = program.polyval1
+                OpenclCalculator.poisson_sumd = program.poisson_sum
             self.dtype = dtype
             self.complex_type = np.dtype('D')
             self.polyval1 = OpenclCalculator.polyval1d
+            self.poisson_sum = OpenclCalculator.poisson_sumd
         self.queue = env.queue[dtype]
         self.plan = pyfft.cl.Plan(dims, queue=self.queue)
 
@@ -274,19 +312,27 @@ class OpenclCalculator(ICalculator):
         #print("ifft time", time.time()-t0)
         return result
 
-    def multiple_scattering(self, Iq, p, coverage=0.99):
+    def multiple_scattering(self, Iq, p, coverage=None):
         #t0 = time.time()
-        coeffs = scattering_coeffs(p, coverage)
         scale = np.sum(Iq)
-        poly = np.asarray(coeffs[::-1], self.dtype)
         frame = _forward_shift(Iq/scale, dtype=self.complex_dtype)
         gpu_data = cl_array.to_device(self.queue, frame)
-        gpu_poly = cl_array.to_device(self.queue, poly)
         self.plan.execute(gpu_data.data)
-        degree, data_size = poly.shape[0], frame.shape[0]*frame.shape[1]
-        self.polyval1(
-            self.queue, [data_size], None,
-            np.int32(degree), gpu_poly.data, np.int32(data_size), gpu_data.data)
+        data_size = frame.shape[0]*frame.shape[1]
+        if coverage is None:
+            L = -np.log(1-p)
+            if L > 0.:
+                self.poisson_sum(
+                    self.queue, [data_size], None,
+                    self.dtype.type(L), np.int32(data_size), gpu_data.data)
+        else:
+            coeffs = scattering_coeffs(p, coverage)
+            poly = np.asarray(coeffs[::-1], self.dtype)
+            gpu_poly = cl_array.to_device(self.queue, poly)
+            self.polyval1(
+                self.queue, [data_size], None,
+                np.int32(poly.shape[0]), gpu_poly.data, np.int32(data_size),
+                gpu_data.data)
         self.plan.execute(gpu_data.data, inverse=True)
         frame = gpu_data.get()
         #result = scale * _inverse_shift(frame.real, dtype=self.dtype)
@@ -314,6 +360,31 @@ def scattering_powers(Iq, n, dtype='f', transform=None):
               for k in range(n)]
     return powers
 
+def scattering_sum(F, p):
+    r"""
+    Return the Poisson weighted sum of the scattering powers of the Fourier
+    frame *F* for scattering probability *p*,
+
+    .. math::
+        \sum_{k=1}^\infty \frac{\lambda^{k-1}}{k!} F^k
+        = \frac{e^{\lambda F} - 1}{\lambda}
+
+    with $\lambda = -\ln(1-p)$.  The complex $e^z - 1$ is formed from
+    $\mathrm{expm1}$ and $\mathrm{cosm1}$ so components with small
+    $|\lambda F|$ keep their precision.
+    """
+    L = -np.log(1-p)
+    if L == 0.:
+        return F
+    # e^(a+ib) - 1 = (expm1(a) + 1)(cosm1(b) + 1) - 1 + i e^a sin(b)
+    a, b = L*F.real, L*F.imag
+    sin_b, cosm1_b = np.sin(b), cosm1(b)
+    expm1_a = np.expm1(a, out=a)
+    result = np.empty_like(F)
+    result.real = (expm1_a*cosm1_b + expm1_a + cosm1_b)/L
+    result.imag = (expm1_a + 1)*sin_b/L
+    return result
+
 def scattering_coeffs(p, coverage=0.99):
     r"""
     Return the coefficients of the scattering powers for transmission
@@ -378,8 +449,9 @@ class MultipleScattering(Resolution):
     events in the sample $\lambda$ as $p = 1 - e^{-\lambda}$.
 
     *coverage* determines how many scattering steps to consider.  The
-    default is 0.99, which sets $n$ such that $1 \ldots n$ covers 99%
-    of the Poisson probability mass function.
+    default is None, which sums all of them in closed form.  A value such
+    as 0.99 sets $n$ such that $1 \ldots n$ covers 99% of the Poisson
+    probability mass function.
 
     *is2d* is True then 2D scattering is used, otherwise it accepts
     and returns 1D scattering.
@@ -389,7 +461,7 @@ class MultipleScattering(Resolution):
     default values for *qmin*, *qmax* and *nq*.
     """
     def __init__(self, qmin=None, qmax=None, nq=None, window=2,
-                 probability=None, coverage=0.99,
+                 probability=None, coverage=None,
                  is2d=False, resolution=None,
                  dtype=PRECISION):
         # Infer qmin, qmax from instrument resolution calculator, if present
@@ -503,9 +575,8 @@ class MultipleScattering(Resolution):
         # CRUFT: don't need probability as a function anymore
         probability = self.probability() if callable(self.probability) else self.probability
         coverage = self.coverage
-        #t0 = time.time()
-        Iqxy = self.transform.multiple_scattering(Iq_calc, probability, coverage)
-        #print("multiple scattering calc time", time.time()-t0)
+        with trace.span("multiscat", "multiple_scattering"):
+            Iqxy = self.transform.multiple_scattering(Iq_calc, probability, coverage)
 
         # remember the intermediate result in case we want to see it later
         self.Iqxy = Iqxy
@@ -516,7 +587,8 @@ class MultipleScattering(Resolution):
             return Iqxy
         else:
             # remember the intermediate result in case we want to see it later
-            Iq = self.radial_profile(Iqxy)
+            with trace.span("multiscat", "radial_profile"):
+                Iq = self.radial_profile(Iqxy)
             self.Iq = Iq
             if self.resolution is not None:
                 q = self._q
@@ -552,7 +624,9 @@ class MultipleScattering(Resolution):
                               outfile="", background=0.):
         import pylab
         probability, coverage = self.probability, self.coverage
-        weights = scattering_coeffs(probability, coverage)
+        # The individual powers need a cut in the series.
+        weights = scattering_coeffs(
+            probability, 0.99 if coverage is None else coverage)
 
         # cribbed from MultipleScattering.apply
         if self.is2d:
@@ -614,6 +688,16 @@ class MultipleScattering(Resolution):
                 pylab.title('total scattering for p=%g' % probability)
         pylab.show()
 
+def test_scattering_sum():
+    """
+    Check the closed form sum against the series with all orders.
+    """
+    F = np.array([1., 0.5+0.3j, -0.2+0.7j, 1e-9-2e-9j, 0.])
+    for p in (0., 1e-4, 0.3, 0.95):
+        coeffs = scattering_coeffs(p, coverage=1-1e-15) if p > 0 else [1.]
+        series = F * np.polyval(coeffs[::-1], F)
+        assert np.allclose(scattering_sum(F, p), series, rtol=1e-13, atol=0)
+
 def annular_average(qxy, Iqxy, qbins):
     """
     Compute annular average of points in *Iqxy* at *qbins*.  The $q_x$, $q_y$
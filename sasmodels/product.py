@@ -111,6 +111,14 @@ The special parameters are:
     can be copied as a group after the regular P parameters.  There won't
     be any magnetic S parameters.
 
+* *fused kernel*
+    When P and S are both double precision dlls, :func:`.core.build_model`
+    compiles them into one dll using :func:`.generate.make_product_source`.
+    For 1D data without S dispersity, the form factor call then computes
+    S(q) and the combined I(q) after the dispersity loop, and the separate
+    S kernel and the combination in python are skipped.  Otherwise, and
+    for OpenCL and CUDA, P and S are computed with separate kernels.
+
 """
 from __future__ import print_function, division
 
@@ -123,6 +131,7 @@ from .modelinfo import ParameterTable, ModelInfo, parse_parameter
 from .modelinfo import NUM_MAGFIELD_PARS, NUM_MAGNETIC_PARS, NUM_COMMON_PARS
 from .kernel import KernelModel, Kernel
 from .details import make_details
+from . import trace
 
 # pylint: disable=unused-import
 try:
@@ -422,10 +431,77 @@ class ProductKernel(Kernel):
         last_mag = first_mag + (mag_pars + NUM_MAGFIELD_PARS if mag_pars else 0)
         self._magentic_slice = slice(first_mag, last_mag)
 
+        # End of the P values and magnetic values in the P data vector, and
+        # of the S values in the S data vector.
+        self._p_end = NUM_COMMON_PARS + p_npars
+        self._p_mag_end = self._p_end + (last_mag - first_mag)
+        self._s_end = NUM_COMMON_PARS + s_npars
+
+        # Form factor kernel from a fused P@S dll, which computes S(q) and
+        # I(q) along with the form factor given the P@S parameters.  It may
+        # be wrapped by the log-FFT size dispersity kernel.  See
+        # kerneldll.DllProductKernel for the parameter layout.
+        fused = getattr(p_kernel, '_kernel', p_kernel)
+        self._fused = fused if hasattr(fused, 'product_result') else None
+        self._product = np.empty(3 + s_npars, 'd')
+
+        # Details and value buffers for the last dispersity layout.
+        self._split_key = None  # type: Optional[Tuple[bytes, bytes, int, bool]]
+        self._split_cache = None  # type: Optional[Tuple[CallDetails, np.ndarray, CallDetails, np.ndarray, np.ndarray]]
+
+    def _split(self, call_details, er_from_p):
+        # type: (CallDetails, bool) -> Tuple[CallDetails, np.ndarray, CallDetails, np.ndarray, np.ndarray]
+        """
+        Return details and value buffers for P and S given the details
+        for P@S, along with the S distribution offsets.  Only the values
+        need to be filled in, so when fitting, with the same dispersity
+        mesh on every call, the previous buffers are returned.
+        """
+        nweights = call_details.num_weights
+        key = (call_details.length.tobytes(), call_details.offset.tobytes(),
+               nweights, er_from_p)
+        if key == self._split_key:
+            return self._split_cache
+
+        p_info, s_info = self.info.composition[1]
+
+        # Construct the calling parameters for P with scale=1, background=0.
+        p_length = call_details.length[self._p_detail_slice]
+        p_offset = call_details.offset[self._p_detail_slice]
+        p_details = make_details(p_info, p_length, p_offset, nweights)
+        p_size = self._p_mag_end + 2*nweights
+        p_values = np.zeros(p_size + (32 - p_size%32)%32, self.p_kernel.dtype)
+        p_values[0] = 1.
+
+        # Construct the calling parameters for S with scale=1, background=0.
+        s_length = np.array(call_details.length[self._s_detail_slice])
+        s_offset = np.array(call_details.offset[self._s_detail_slice])
+        if self._volfrac_in_p:
+            # Volfrac is in P and missing from S so insert a slot for it.  Say
+            # the distribution is length 1 and use the slot for volfraction
+            # from the P distribution.
+            s_length = np.insert(s_length, 1, 1)
+            s_offset = np.insert(s_offset, 1, p_offset[self._volfrac_index - 2])
+        if er_from_p:
+            # If effective_radius comes from P, make sure it is monodisperse.
+            # Weight is set to 1 later, after the value array is filled.
+            s_length[0] = 1
+        s_details = make_details(s_info, s_length, s_offset, nweights)
+        s_size = self._s_end + 2*nweights
+        s_values = np.zeros(s_size + (32 - s_size%32)%32, self.s_kernel.dtype)
+        s_values[0] = 1.
+
+        self._split_key = key
+        self._split_cache = p_details, p_values, s_details, s_values, s_offset
+        return self._split_cache
+
     def Iq(self, call_details, values, cutoff, magnetic):
         # type: (CallDetails, np.ndarray, float, bool) -> np.ndarray
-        p_info, s_info = self.info.composition[1]
+        with trace.span("product", self.info.id):
+            return self._Iq(call_details, values, cutoff, magnetic)
 
+    def _Iq(self, call_details, values, cutoff, magnetic):
+        # type: (CallDetails, np.ndarray, float, bool) -> np.ndarray
         # Retrieve values from the data vector
         scale, background = values[0], values[1]
         volfrac = values[self._volfrac_index]
@@ -442,78 +518,41 @@ class ProductKernel(Kernel):
         if beta_mode and self.p_kernel.dim == '2d':
             raise NotImplementedError("beta not yet supported for 2D")
 
-        # Construct the calling parameters for P.
-        p_length = call_details.length[self._p_detail_slice]
-        p_offset = call_details.offset[self._p_detail_slice]
-        p_details = make_details(p_info, p_length, p_offset, nweights)
-        p_values = [
-            [1., 0.], # scale=1, background=0,
-            values[self._p_value_slice],
-            values[self._magentic_slice],
-            weights]
-        spacer = (32 - sum(len(v) for v in p_values)%32)%32
-        p_values.append([0.]*spacer)
-        p_values = np.hstack(p_values).astype(self.p_kernel.dtype)
+        # Fill in the calling parameters for P and S.  The details and the
+        # value buffers only depend on the dispersity layout, so they are
+        # reused from the previous call when possible.
+        split = self._split(call_details, er_mode > 0)
+        p_details, p_values = split[:2]
+        p_details.dispersion = call_details.dispersion
+        p_values[NUM_COMMON_PARS:self._p_end] = values[self._p_value_slice]
+        p_values[self._p_end:self._p_mag_end] = values[self._magentic_slice]
+        p_values[self._p_mag_end:self._p_mag_end+2*nweights] = weights
+
+        # Ask a fused P@S kernel to compute S(q) and I(q) in the same call
+        # as the form factor, provided S has no active dispersity.
+        fused = self._fused
+        if fused is not None:
+            s_length = call_details.length[self._s_detail_slice]
+            if (not magnetic and self.p_kernel.dim == '1d'
+                    and (s_length[1:] == 1).all()
+                    and (er_mode > 0 or s_length[0] == 1)):
+                product = self._product
+                product[:5] = (scale, background, volfrac, beta_mode,
+                               values[self._er_index])
+                product[5:] = values[self._s_value_slice]
+                fused.product = product
+            fused.product_result = None
 
         # Call the form factor kernel to compute <F> and <F^2>.
         # If the model doesn't support Fq the returned <F> will be None.
         F, Fsq, radius_effective, shell_volume, volume_ratio \
             = self.p_kernel.Fq(p_details, p_values, cutoff, magnetic, er_mode)
         p_intermediate = getattr(self.p_kernel, 'results', None)
-
-        # TODO: async call to the GPU
-
-        # Construct the calling parameters for S.
-        s_length = call_details.length[self._s_detail_slice]
-        s_offset = call_details.offset[self._s_detail_slice]
-        if self._volfrac_in_p:
-            # Volfrac is in P and missing from S so insert a slot for it.  Say
-            # the distribution is length 1 and use the slot for volfraction
-            # from the P distribution.
-            s_length = np.insert(s_length, 1, 1)
-            s_offset = np.insert(s_offset, 1, p_offset[self._volfrac_index - 2])
-        if er_mode > 0:
-            # If effective_radius comes from P, make sure it is monodisperse.
-            # Weight is set to 1 later, after the value array is created
-            s_length[0] = 1
-        s_details = make_details(s_info, s_length, s_offset, nweights)
-        s_values = [
-            [1., # scale=1
-             0., # background=0,
-             values[self._er_index], # S.radius_effective; may be replaced by P
-             0.], # volfraction; will be replaced by volfrac * volume_ratio
-            # followed by S parameters after effective_radius and volfraction
-            values[self._s_value_slice],
-            weights,
-        ]
-        spacer = (32 - sum(len(v) for v in s_values)%32)%32
-        s_values.append([0.]*spacer)
-        s_values = np.hstack(s_values).astype(self.s_kernel.dtype)
-
-        # Plug R_eff from the form factor into structure factor parameters
-        # and scale volume fraction by form:shell volume ratio. These changes
-        # needs to be both in the initial value slot as well as the
-        # polydispersity distribution slot in the values array due to
-        # implementation details in kernel_iq.c.
-        #print("R_eff=%d:%g, volfrac=%g, volume ratio=%g"
-        #      % (radius_type, radius_effective, volfrac, volume_ratio))
-        s_dist = s_values[self._s_dist_slice]
-        if er_mode > 0:
-            # set the value to the model R_eff and set the weight to 1
-            s_values[NUM_COMMON_PARS] = s_dist[s_offset[0]] = radius_effective
-            s_dist[s_offset[0]+nweights] = 1.0
-        s_values[NUM_COMMON_PARS+1] = s_dist[s_offset[1]] = volfrac*volume_ratio
-        s_dist[s_offset[1]+nweights] = 1.0
-
-        # Call the structure factor kernel to compute S.
-        S = self.s_kernel.Iq(s_details, s_values, cutoff, False)
-        #print("P", Fsq[:10])
-        #print("S", S[:10])
-        #print(radius_effective, volfrac*volume_ratio)
-
-        # Combine form factor and structure factor
-        #print("beta", beta_mode, F, Fsq, S)
-        PS = Fsq + F**2*(S-1) if beta_mode else Fsq*S
+        # The dispersity counts for the product are those of the form factor.
+        self.stats = self.p_kernel.stats
+        product_result = None
+        if fused is not None:
+            product_result, fused.product = fused.product_result, None
 
         # Determine overall scale factor. Hollow shapes are weighted by
         # shell_volume, so that is needed for number density estimation.
@@ -524,7 +563,14 @@ class ProductKernel(Kernel):
         combined_scale = scale/shell_volume
         if not self._volfrac_in_p:
             combined_scale *= volfrac
-        final_result = combined_scale*PS + background
+
+        if product_result is not None:
+            S, final_result = product_result
+        else:
+            S, final_result = self._combine(
+                split[2:], call_details, values, cutoff, F, Fsq,
+                radius_effective, volume_ratio, combined_scale, er_mode,
+                beta_mode)
 
         # Capture intermediate values so user can see them.  These are
         # returned as a lazy evaluator since they are only needed in the
@@ -544,6 +590,67 @@ class ProductKernel(Kernel):
     Iq.__doc__ = Kernel.Iq.__doc__
     __call__ = Iq
 
+    def _combine(self, s_parts, call_details, values, cutoff, F, Fsq,
+                 radius_effective, volume_ratio, combined_scale, er_mode,
+                 beta_mode):
+        # type: (Tuple[CallDetails, np.ndarray, np.ndarray], CallDetails, np.ndarray, float, np.ndarray, np.ndarray, float, float, float, int, bool) -> Tuple[np.ndarray, np.ndarray]
+        """
+        Call the structure factor kernel and combine it with the form factor,
+        returning S(q) and I(q).  *s_parts* holds the S details, values and
+        distribution offsets from :meth:`_split`.
+        """
+        background = values[1]
+        volfrac = values[self._volfrac_index]
+        nvalues = self.info.parameters.nvalues
+        nweights = call_details.num_weights
+        weights = values[nvalues:nvalues + 2*nweights]
+        s_details, s_values, s_offset = s_parts
+
+        # TODO: async call to the GPU
+
+        # S.radius_effective may be replaced by P, and volfraction will be
+        # replaced by volfrac * volume_ratio, followed by S parameters after
+        # effective_radius and volfraction.
+        s_values[NUM_COMMON_PARS] = values[self._er_index]
+        s_values[NUM_COMMON_PARS+2:self._s_end] = values[self._s_value_slice]
+        s_values[self._s_end:self._s_end+2*nweights] = weights
+
+        # Plug R_eff from the form factor into structure factor parameters
+        # and scale volume fraction by form:shell volume ratio. These changes
+        # needs to be both in the initial value slot as well as the
+        # polydispersity distribution slot in the values array due to
+        # implementation details in kernel_iq.c.
+        #print("R_eff=%d:%g, volfrac=%g, volume ratio=%g"
+        #      % (radius_type, radius_effective, volfrac, volume_ratio))
+        s_dist = s_values[self._s_dist_slice]
+        if er_mode > 0:
+            # set the value to the model R_eff and set the weight to 1
+            s_values[NUM_COMMON_PARS] = s_dist[s_offset[0]] = radius_effective
+            s_dist[s_offset[0]+nweights] = 1.0
+        s_values[NUM_COMMON_PARS+1] = s_dist[s_offset[1]] = volfrac*volume_ratio
+        s_dist[s_offset[1]+nweights] = 1.0
+
+        # Call the structure factor kernel to compute S.
+        S = self.s_kernel.Iq(s_details, s_values, cutoff, False)
+        #print("P", Fsq[:10])
+        #print("S", S[:10])
+        #print(radius_effective, volfrac*volume_ratio)
+
+        # Combine form factor and structure factor
+        #print("beta", beta_mode, F, Fsq, S)
+        if beta_mode:
+            PS = S - 1.
+            PS *= F
+            PS *= F
+            PS += Fsq
+        else:
+            PS = Fsq*S
+
+        final_result = PS
+        final_result *= combined_scale
+        final_result += background
+        return S, final_result
+
     def release(self):
         # type: () -> None
         """Free resources associated with the kernel."""
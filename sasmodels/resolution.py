@@ -11,6 +11,8 @@ from scipy.special import erf  # type: ignore
 from numpy import sqrt, log, log10, exp, pi  # type: ignore
 import numpy as np  # type: ignore
 
+from . import trace
+
 __all__ = ["Resolution", "Perfect1D", "Pinhole1D", "Slit1D",
            "apply_resolution_matrix", "pinhole_resolution", "slit_resolution",
            "pinhole_extend_q", "slit_extend_q", "bin_edges",
@@ -104,7 +106,8 @@ class Pinhole1D(Resolution):
         self.q_calc = abs(self.q_calc)
 
     def apply(self, theory):
-        return apply_resolution_matrix(self.weight_matrix, theory)
+        with trace.span("resolution", "Pinhole1D"):
+            return apply_resolution_matrix(self.weight_matrix, theory)
 
 
 class Slit1D(Resolution):
@@ -162,7 +165,8 @@ class Slit1D(Resolution):
         self.q_calc = abs(self.q_calc)
 
     def apply(self, theory):
-        return apply_resolution_matrix(self.weight_matrix, theory)
+        with trace.span("resolution", "Slit1D"):
+            return apply_resolution_matrix(self.weight_matrix, theory)
 
 
 def apply_resolution_matrix(weight_matrix, theory):
@@ -216,6 +220,45 @@ def pinhole_resolution(q_calc, q, q_width, nsigma=PINHOLE_N_SIGMA):
     return weights
 
 
+def pinhole_resolution_banded(q_calc, q, q_width, nsigma=PINHOLE_N_SIGMA):
+    r"""
+    Compute the pinhole resolution weights of :func:`pinhole_resolution`
+    in banded form.
+
+    Returns *(index, weights)* with one row for each point *q[i]*, where
+    *weights[i, k]* is the weight of *q_calc[index[i, k]]*.  Only the
+    points within the $(-2.5, +3)\sigma$ limits of *q[i]* are stored, so
+    the size is *len(q)* times the largest number of points under one
+    resolution function rather than *len(q_calc)* times *len(q)*.  Use
+    :func:`apply_banded_resolution` to apply it.
+    """
+    try:
+        nsigma_low, nsigma_high = nsigma
+    except TypeError:
+        nsigma_low = nsigma_high = nsigma
+    edges = bin_edges(q_calc)
+    start = np.searchsorted(q_calc, q - nsigma_low*q_width, 'left')
+    stop = np.searchsorted(q_calc, q + nsigma_high*q_width, 'right')
+    band = max(np.max(stop - start), 1)
+    index = start[:, None] + np.arange(band)[None, :]
+    mask = index < stop[:, None]
+    index = np.minimum(index, len(q_calc) - 1)
+    scale = (sqrt(2.0)*q_width)[:, None]
+    cdf_low = erf((edges[index] - q[:, None]) / scale)
+    cdf_high = erf((edges[index+1] - q[:, None]) / scale)
+    weights = np.where(mask, cdf_high - cdf_low, 0.)
+    weights /= np.sum(weights, axis=1)[:, None]
+    return index, weights
+
+
+def apply_banded_resolution(index, weights, theory):
+    """
+    Apply the banded weights from :func:`pinhole_resolution_banded` to the
+    computed theory function.
+    """
+    return np.sum(theory[index]*weights, axis=1)
+
+
 def slit_resolution(q_calc, q, width, length, n_length=30):
     r"""
     Build a weight matrix to compute *I_s(q)* from *I(q_calc)*, given
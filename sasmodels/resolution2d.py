@@ -10,6 +10,7 @@ import numpy as np  # type: ignore
 from numpy import pi, cos, sin, sqrt  # type: ignore
 
 from . import resolution
+from . import trace
 from .resolution import Resolution
 
 ## Singular point
@@ -26,6 +27,11 @@ N_SLIT_PERP = {'xhigh':1000, 'high':500, 'med':200, 'low':50}
 N_SLIT_PERP_DOC = ", ".join("%s=%d"%(name, value)
                             for value, name in
                             sorted((2*v+1, k) for k, v in N_SLIT_PERP.items()))
+## Slit2D.integrate starts with about this many qy points on each side
+## and refines by halving the step
+N_SLIT_PERP_COARSE = 16
+## Relative accuracy of the qy integral in Slit2D.integrate
+SLIT_PERP_TOLERANCE = 1e-4
 
 class Pinhole2D(Resolution):
     """
@@ -161,6 +167,10 @@ class Pinhole2D(Resolution):
         return qx_res, qy_res, weight_res
 
     def apply(self, theory):
+        with trace.span("resolution", "Pinhole2D"):
+            return self._apply(theory)
+
+    def _apply(self, theory):
         if self.q_calc_weights is not None:
             # TODO: interpolate rather than recomputing all the different qx,qy
             # Resolution needs to be applied
@@ -197,12 +207,17 @@ class Slit2D(Resolution):
     *accuracy* determines the number of *q_width* points to compute for each *q*.
     The values are stored in sasmodels.resolution2d.N_SLIT_PERP.  The default
     values are: %s
+
+    *tolerance* is the relative accuracy of the qy integral in
+    :meth:`integrate`, which only evaluates the grid points it needs.
     """
     __doc__ = __doc__%N_SLIT_PERP_DOC
-    def __init__(self, q, q_length, q_width=0., q_calc=None, accuracy='low'):
+    def __init__(self, q, q_length, q_width=0., q_calc=None, accuracy='low',
+                 tolerance=SLIT_PERP_TOLERANCE):
         # Remember what q and width was used even though we won't need them
         # after the weight matrix is constructed
         self.q, self.q_length, self.q_width = q, q_length, q_width
+        self.tolerance = tolerance
 
         # Allow independent resolution on each qx point even though it is not
         # needed in practice.  Set qy_width to the maximum qy width.
@@ -226,17 +241,141 @@ class Slit2D(Resolution):
         self.nx, self.ny = len(qx_calc), len(qy_calc)
         self.dy = 2*q_width/self.ny
 
-        # Build weight matrix for resolution integration
+        # Build weight matrix for resolution integration.  Each q only sees
+        # the qx_calc points within a few q_length, so it is stored banded.
         if np.any(q_length > 0):
-            self.weights = resolution.pinhole_resolution(
+            self.weights = resolution.pinhole_resolution_banded(
                 qx_calc, q, np.maximum(q_length, resolution.MINIMUM_RESOLUTION))
+            self.columns = np.unique(self.weights[0][self.weights[1] != 0.])
         elif len(qx_calc) == len(q) and np.all(qx_calc == q):
             self.weights = None
+            self.columns = np.arange(self.nx)
         else:
             raise ValueError("Slit2D fails with q_calc != q")
 
+        # Coarse grid for integrate, every stride-th qy point including the
+        # end points, at the contributing qx columns.
+        n, stride = self.ny//2, 1
+        while 2*stride*N_SLIT_PERP_COARSE <= n:
+            stride *= 2
+        rings = np.unique(np.hstack((np.arange(0, n, stride), n)))
+        self.coarse_stride = stride
+        self.coarse_rows = np.hstack((n - rings[:0:-1], n + rings))
+        self.q_coarse = [v.flatten() for v in np.meshgrid(
+            qx_calc[self.columns], qy_calc[self.coarse_rows])]
+
     def apply(self, theory):
-        Iq = np.trapz(theory.reshape(self.ny, self.nx), axis=0, x=self.qy_calc)
+        with trace.span("resolution", "Slit2D"):
+            Iq = np.trapz(theory.reshape(self.ny, self.nx), axis=0, x=self.qy_calc)
+            return self._apply_qx(Iq)
+
+    def _apply_qx(self, Iq):
         if self.weights is not None:
-            Iq = resolution.apply_resolution_matrix(self.weights, Iq)
+            Iq = resolution.apply_banded_resolution(*self.weights, theory=Iq)
         return Iq
+
+    def integrate(self, calculate):
+        """
+        Compute the smeared theory, calling *calculate(qx, qy)* for the
+        theory at the points needed.
+
+        Rather than the full *q_calc* grid, the qy integral starts from
+        every $2^k$-th qy point, with about *N_SLIT_PERP_COARSE* points on
+        each side, and the step is halved until the integral converges to
+        within *tolerance*.  Each halving is combined with the previous
+        trapezoid rule by Richardson extrapolation, so the result is more
+        accurate than :meth:`apply` on the full grid, and usually reaches
+        it without needing every point.  Only the qx columns that
+        contribute to some *q* are evaluated, and columns stop refining as
+        they converge.  Within a column, new points are skipped where the
+        theory has decayed, with the theory interpolated instead.
+
+        The first call to *calculate* is always for the points in
+        *q_coarse*, so a kernel for them can be built ahead of time.
+
+        Returns *(Iq, theory)* where *theory* is the *(ny, nx)* grid of
+        values, interpolated at the points that were skipped.
+        """
+        center = n = self.ny//2
+        qy = self.qy_calc
+        theory = np.zeros((self.ny, self.nx))
+        filled = np.zeros(self.ny, dtype=bool)
+        columns = self.columns
+        trapezoid = np.zeros(self.nx)
+        extrapolated = np.full(self.nx, np.nan)
+        stride, rows = self.coarse_stride, self.coarse_rows
+        with trace.span("resolution", "Slit2D"):
+            # Coarse grid, including the end points
+            theory[np.ix_(rows, columns)] = np.reshape(
+                calculate(*self.q_coarse), (len(rows), len(columns)))
+            filled[rows] = True
+            trapezoid[columns] = np.trapz(
+                theory[filled][:, columns], axis=0, x=qy[filled])
+            done = []
+            while stride > 1 and len(columns):
+                stride //= 2
+                rings = np.arange(stride, n, 2*stride)
+                rows = np.hstack((center - rings, center + rings))
+                low = np.hstack((center - rings + stride, center + rings - stride))
+                high = np.hstack((center - np.minimum(rings + stride, n),
+                                  center + np.minimum(rings + stride, n)))
+                # Interpolate the new points, then evaluate those that split
+                # a trapezoid which is not negligible.
+                a = theory[np.ix_(low, columns)]
+                b = theory[np.ix_(high, columns)]
+                width = (qy[high] - qy[low])[:, None]
+                theory[np.ix_(rows, columns)] = (
+                    a + (b - a)*((qy[rows] - qy[low])[:, None]/width))
+                cutoff = self.tolerance*abs(trapezoid[columns])/len(rows)
+                need = 0.5*(abs(a) + abs(b))*abs(width) >= cutoff[None, :]
+                row_index, column_index = np.nonzero(need)
+                if len(row_index):
+                    theory[rows[row_index], columns[column_index]] = calculate(
+                        self.qx_calc[columns[column_index]], qy[rows[row_index]])
+                filled[rows] = True
+
+                previous = trapezoid[columns]
+                trapezoid[columns] = np.trapz(
+                    theory[filled][:, columns], axis=0, x=qy[filled])
+                estimate = trapezoid[columns] + (trapezoid[columns] - previous)/3
+                change = abs(estimate - extrapolated[columns])
+                extrapolated[columns] = estimate
+                converged = change < self.tolerance*abs(estimate)
+                done.append((columns[converged], filled.copy()))
+                columns = columns[~converged]
+            done.append((columns, filled))
+
+            # Fill in the points past where each column stopped refining.
+            for finished, rows in done:
+                for col in finished:
+                    theory[~rows, col] = np.interp(
+                        qy[~rows], qy[rows], theory[rows, col])
+            Iq = np.where(np.isnan(extrapolated), trapezoid, extrapolated)
+            return self._apply_qx(Iq), theory
+
+
+def test_slit2d_integrate():
+    """
+    Check the adaptive slit integral against the full grid.
+    """
+    q = np.logspace(-5, -3, 20)
+    q_length = 0.01*q + 1e-6
+    theory = lambda qx, qy: 1/(1 + (2000*qx)**2 + (3000*qy)**2)**2
+
+    # Banded qx weights match the dense pinhole matrix.
+    res = Slit2D(q, q_length, 0.1, accuracy='xhigh', tolerance=1e-6)
+    dense = resolution.pinhole_resolution(
+        res.qx_calc, q, np.maximum(q_length, resolution.MINIMUM_RESOLUTION))
+    Iq = theory(res.qx_calc, 0.)
+    assert np.allclose(res._apply_qx(Iq), np.dot(Iq, dense), rtol=1e-14)
+    target = res.apply(theory(*res.q_calc))
+
+    n = [0]
+    def calculate(qx, qy):
+        n[0] += len(qx)
+        return theory(qx, qy)
+    res = Slit2D(q, q_length, 0.1, accuracy='high')
+    Iq, grid = res.integrate(calculate)
+    assert np.allclose(Iq, target, rtol=1e-4)
+    assert n[0] < res.nx*res.ny/2
+    assert grid.shape == (res.ny, res.nx)
@@ -30,6 +30,7 @@ from . import generate
 from . import weights
 from . import modelinfo
 from .details import make_kernel_args, dispersion_mesh
+from .direct_model import Progressive2D
 
 # Hack: load in any custom distributions
 # Uses ~/.sasview/weights/*.py unless SASMODELS_WEIGHTS is set in the environ.
@@ -39,7 +40,7 @@ weights.load_weights()
 # pylint: disable=unused-import
 try:
     from typing import (Dict, Mapping, Any, Sequence, Tuple, NamedTuple,
-                        List, Optional, Union, Callable)
+                        List, Optional, Union, Callable, Iterator)
     from types import ModuleType
     from .modelinfo import ModelInfo, Parameter
     from .kernel import KernelModel
@@ -712,6 +713,25 @@ class SasviewModel(object):
         with calculation_lock:
             return self._calculate_Iq(qx, qy)
 
+    def calculate_Iq_progressive(self, qx, qy, strides=(4, 2, 1)):
+        # type: (Sequence[float], Sequence[float], Tuple[int, ...]) -> Iterator[Tuple[int, np.ndarray]]
+        """
+        Yield *(stride, Iq)* for the detector pixels *qx*, *qy*, from coarse
+        to fine, for previewing 2D models while parameters are changing.
+
+        The first passes evaluate every stride-th row and column of the
+        detector and interpolate to the remaining pixels.  The final pass,
+        with stride 1, is the same as :meth:`calculate_Iq`.  Each pass uses
+        the parameter values current when it is requested, so stop iterating
+        to cancel the remaining passes when the parameters change.  See
+        :class:`.direct_model.Progressive2D`.
+        """
+        grid = Progressive2D(qx, qy, strides)
+        def calculate(_level, qx_coarse, qy_coarse):
+            return self.calculate_Iq(qx_coarse, qy_coarse)[0]
+        full = lambda: self.calculate_Iq(qx, qy)[0]
+        return grid.passes(calculate, full)
+
     def _calculate_Iq(self, qx, qy=None):
         if self._model is None:
             # Only need one copy of the compiled kernel regardless of how many
@@ -727,7 +747,10 @@ class SasviewModel(object):
         parameters = self._model_info.parameters
         pairs = [self._get_weights(p) for p in parameters.call_parameters]
         #weights.plot_weights(self._model_info, pairs)
-        call_details, values, is_magnetic = make_kernel_args(calculator, pairs)
+        dispersion = {name: (dis['type'], dis['width'])
+                      for name, dis in self.dispersion.items()}
+        call_details, values, is_magnetic = make_kernel_args(
+            calculator, pairs, dispersion)
         #call_details.show()
         #print("================ parameters ==================")
         #for p, v in zip(parameters.call_parameters, pairs): print(p.name, v[0])
@@ -876,6 +899,18 @@ def test_cylinder():
     cylinder = Cylinder()
     return cylinder.evalDistribution([0.1, 0.1])
 
+def test_progressive():
+    """
+    Test that the progressive passes end with the full 2D calculation.
+    """
+    Cylinder = _make_standard_model('cylinder')
+    cylinder = Cylinder()
+    qx, qy = np.meshgrid(np.linspace(-0.1, 0.1, 21), np.linspace(-0.1, 0.1, 21))
+    qx, qy = qx.flatten(), qy.flatten()
+    passes = list(cylinder.calculate_Iq_progressive(qx, qy))
+    assert [stride for stride, _ in passes] == [4, 2, 1]
+    assert (passes[-1][1] == cylinder.evalDistribution([qx, qy])).all()
+
 def test_structure_factor():
     # type: () -> float
     """
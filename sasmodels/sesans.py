@@ -15,6 +15,8 @@ import numpy as np  # type: ignore
 from numpy import pi  # type: ignore
 from scipy.special import j0
 
+from . import trace
+
 
 class SesansTransform(object):
     """
@@ -52,9 +54,10 @@ class SesansTransform(object):
         """
         Apply the SESANS transform to the computed I(q).
         """
-        G0 = np.dot(self._H0, Iq)
-        G = np.dot(self._H.T, Iq)
-        P = G - G0
+        with trace.span("sesans", "hankel"):
+            G0 = np.dot(self._H0, Iq)
+            G = np.dot(self._H.T, Iq)
+            P = G - G0
         return P
 
     def _set_hankel(self, SElength, lam, zaccept, Rmax):
@@ -0,0 +1,271 @@
+"""
+Shared memory evaluation service.
+
+Parallel fitters send the fit problem to each worker process using pickle.
+For a sasmodels calculator this copies the *q* vectors and the resolution
+matrices into every worker, and for large 2-D datasets or fine slit
+resolution these can be much larger than the model itself.
+
+:class:`SharedEvaluator` instead places the arrays for a set of
+calculators in a single block of POSIX shared memory.  The worker pool
+attaches to the block when it starts, rebuilding the resolution objects
+as views onto the shared arrays without copying them, and loading the
+model for each calculator.  After that, each evaluation only sends the
+parameter values to the worker and returns the theory.
+
+Compiled models are loaded from the existing DLL rather than compiled
+again in each worker.  OpenCL and CUDA models still build the program
+in each worker since the device context cannot be shared between
+processes.
+
+For example, to evaluate a set of bumps experiments in parallel::
+
+    from sasmodels.sharedmem import SharedEvaluator
+    with SharedEvaluator(experiments) as evaluator:
+        theory = evaluator([M.model.state() for M in experiments])
+"""
+from __future__ import print_function
+
+import copy
+import multiprocessing
+from multiprocessing import shared_memory
+
+import numpy as np  # type: ignore
+
+from .data import Data1D, Data2D
+from .direct_model import DataMixin
+
+# pylint: disable=unused-import
+try:
+    from typing import Any, Dict, List, Optional, Sequence, Tuple
+except ImportError:
+    pass
+# pylint: enable=unused-import
+
+#: Byte alignment for each array within the shared memory block.
+ALIGNMENT = 64
+
+# Data objects which are packed along with the resolution.
+DATA_TYPES = (Data1D, Data2D)
+
+# Worker state, set by _attach.
+_WORKER = {}  # type: Dict[str, Any]
+
+
+class SharedArray(object):
+    """
+    Placeholder for an array stored at *offset* in the shared memory block.
+    """
+    def __init__(self, offset, shape, dtype):
+        # type: (int, Tuple[int, ...], np.dtype) -> None
+        self.offset = offset
+        self.shape = shape
+        self.dtype = dtype
+
+    def view(self, buffer):
+        # type: (memoryview) -> np.ndarray
+        """Return the array as a read-only view into *buffer*."""
+        array = np.ndarray(self.shape, dtype=self.dtype, buffer=buffer,
+                           offset=self.offset)
+        array.flags.writeable = False
+        return array
+
+
+class _Packer(object):
+    """
+    Gather the numeric arrays in an object graph, replacing them with
+    :class:`SharedArray` placeholders.
+    """
+    def __init__(self):
+        # type: () -> None
+        self.arrays = []  # type: List[Tuple[int, np.ndarray]]
+        self.size = 0
+        self._seen = {}  # type: Dict[int, SharedArray]
+
+    def _array(self, array):
+        # type: (np.ndarray) -> SharedArray
+        ref = self._seen.get(id(array), None)
+        if ref is None:
+            packed = np.ascontiguousarray(array)
+            offset = -(-self.size//ALIGNMENT)*ALIGNMENT
+            ref = SharedArray(offset, packed.shape, packed.dtype)
+            self.arrays.append((offset, packed))
+            self.size = offset + packed.nbytes
+            self._seen[id(array)] = ref
+        return ref
+
+    def value(self, value):
+        # type: (Any) -> Any
+        """Return *value* with arrays replaced by placeholders."""
+        if isinstance(value, np.ndarray) and value.dtype.kind in 'biuf':
+            return self._array(value)
+        if isinstance(value, (tuple, list)):
+            return type(value)(self.value(v) for v in value)
+        if isinstance(value, DATA_TYPES):
+            # Resolution objects may hold a reference to the data.
+            return self.object(value)
+        return value
+
+    def object(self, obj):
+        # type: (Any) -> Any
+        """Return a shallow copy of *obj* with its array attributes replaced."""
+        if not hasattr(obj, '__dict__'):
+            return obj
+        obj = copy.copy(obj)
+        for key, value in obj.__dict__.items():
+            obj.__dict__[key] = self.value(value)
+        return obj
+
+    def fill(self, buffer):
+        # type: (memoryview) -> None
+        """Copy the gathered arrays into the shared *buffer*."""
+        for offset, array in self.arrays:
+            target = np.ndarray(array.shape, dtype=array.dtype, buffer=buffer,
+                                offset=offset)
+            target[...] = array
+
+
+def _restore(value, buffer):
+    # type: (Any, memoryview) -> Any
+    if isinstance(value, SharedArray):
+        return value.view(buffer)
+    if isinstance(value, (tuple, list)):
+        return type(value)(_restore(v, buffer) for v in value)
+    if hasattr(value, '__dict__'):
+        for key, item in value.__dict__.items():
+            if isinstance(item, (SharedArray, tuple, list) + DATA_TYPES):
+                value.__dict__[key] = _restore(item, buffer)
+    return value
+
+
+class SharedTheory(DataMixin):
+    """
+    Theory calculator for one dataset in the worker.
+
+    This holds the parts of a :class:`.direct_model.DataMixin` which are
+    needed to evaluate the theory, but not the data itself.
+    """
+    def __init__(self, calculator, packer):
+        # type: (DataMixin, _Packer) -> None
+        # pylint: disable=super-init-not-called
+        self._data = None
+        self._model = calculator._model
+        self._kernel = None
+        self.data_type = calculator.data_type
+        self.cutoff = getattr(calculator, 'cutoff', 0.)
+        self.resolution = packer.object(calculator.resolution)
+        self.results = None
+
+    def attach(self, buffer):
+        # type: (memoryview) -> None
+        """Restore the shared arrays and create the kernel."""
+        self.resolution = _restore(self.resolution, buffer)
+        self._kernel = self._model.make_kernel(self._kernel_inputs())
+
+    def __call__(self, pars):
+        # type: (Dict[str, float]) -> np.ndarray
+        return self._calc_theory(pars, cutoff=self.cutoff)
+
+
+def _attach(name, calculators):
+    # type: (str, List[SharedTheory]) -> None
+    """
+    Worker initializer.  Attach to the shared memory block and build the
+    kernels for each calculator.
+    """
+    shm = shared_memory.SharedMemory(name=name)
+    for calculator in calculators:
+        calculator.attach(shm.buf)
+    _WORKER.clear()
+    _WORKER.update(shm=shm, calculators=calculators)
+
+
+def _evaluate(task):
+    # type: (Tuple[int, Dict[str, float]]) -> np.ndarray
+    index, pars = task
+    return _WORKER['calculators'][index](pars)
+
+
+class SharedEvaluator(object):
+    """
+    Evaluate the theory for a set of calculators in a pool of workers,
+    with the *q* inputs and resolution matrices in shared memory.
+
+    *calculators* is a list of :class:`.direct_model.DirectModel` or
+    :class:`.bumps_model.Experiment` objects, or anything else based on
+    :class:`.direct_model.DataMixin`.
+
+    *processes* is the number of workers, which defaults to the number
+    of CPUs.
+
+    Call the evaluator with a list of parameter dictionaries, one for each
+    calculator, to return the list of theory values.  Use *None* in place
+    of the parameters to skip a calculator.
+
+    Call :meth:`close` when done, or use the evaluator as a context
+    manager, to stop the workers and free the shared memory.
+    """
+    def __init__(self, calculators, processes=None):
+        # type: (Sequence[DataMixin], Optional[int]) -> None
+        packer = _Packer()
+        templates = [SharedTheory(calc, packer) for calc in calculators]
+        self._shm = shared_memory.SharedMemory(create=True,
+                                               size=max(packer.size, 1))
+        packer.fill(self._shm.buf)
+        #: Total size of the arrays held in shared memory.
+        self.nbytes = packer.size
+        self._pool = multiprocessing.Pool(
+            processes=processes, initializer=_attach,
+            initargs=(self._shm.name, templates))
+
+    def __call__(self, pars):
+        # type: (Sequence[Optional[Dict[str, float]]]) -> List[Optional[np.ndarray]]
+        tasks = [(k, p) for k, p in enumerate(pars) if p is not None]
+        results = self._pool.map(_evaluate, tasks, chunksize=1)
+        theory = [None]*len(pars)  # type: List[Optional[np.ndarray]]
+        for (k, _), result in zip(tasks, results):
+            theory[k] = result
+        return theory
+
+    def close(self):
+        # type: () -> None
+        """Stop the workers and release the shared memory."""
+        if self._pool is not None:
+            self._pool.close()
+            self._pool.join()
+            self._pool = None
+            self._shm.close()
+            self._shm.unlink()
+
+    def __enter__(self):
+        # type: () -> "SharedEvaluator"
+        return self
+
+    def __exit__(self, *args):
+        # type: (*Any) -> None
+        self.close()
+
+
+def test_shared_evaluator():
+    # type: () -> None
+    """Check that shared evaluation matches direct evaluation"""
+    from .core import load_model
+    from .data import empty_data1D, empty_data2D
+    from .direct_model import DirectModel
+
+    model = load_model('cylinder', dtype='double', platform='dll')
+    q = np.logspace(-3, -1, 50)
+    calculators = [
+        DirectModel(empty_data1D(q, resolution=0.05), model),
+        DirectModel(empty_data2D(q[::5], resolution=0.05), model),
+        ]
+    pars = [dict(radius=20, length=300, radius_pd=0.1, radius_pd_n=10),
+            dict(radius=30, length=100, theta=30, phi=20, background=0.1)]
+    with SharedEvaluator(calculators, processes=2) as evaluator:
+        # The 2-D data held by the resolution object is shared as well.
+        assert evaluator.nbytes > calculators[1].resolution.data.data.nbytes
+        theory = evaluator(pars)
+        skipped = evaluator([None, pars[1]])
+    for calc, p, result in zip(calculators, pars, theory):
+        assert np.allclose(result, calc(**p), rtol=1e-12, atol=0)
+    assert skipped[0] is None and np.allclose(skipped[1], theory[1])
@@ -0,0 +1,26 @@
+// Array versions of the special functions in models/lib for sasmodels/special.py.
+//
+// kerneldll.make_special_dll compiles this after kernel_header.c and the
+// library sources listed in kerneldll.SPECIAL_SOURCES.  Each function
+// evaluates n points from x into y in a single loop, so python models get
+// the C implementation without the temporaries of the numpy versions.
+
+#define SAS_ARRAY_FN(fn) \
+    kernel void fn##_array(int32_t n, const double *x, double *y) \
+    { for (int32_t i=0; i < n; i++) y[i] = fn(x[i]); }
+
+SAS_ARRAY_FN(sas_sinx_x)
+SAS_ARRAY_FN(sas_3j1x_x)
+SAS_ARRAY_FN(sas_2J1x_x)
+
+kernel void polevl_array(int32_t n, const double *x, const double *coef,
+                         int32_t N, double *y)
+{
+    for (int32_t i=0; i < n; i++) y[i] = polevl(x[i], coef, N);
+}
+
+kernel void p1evl_array(int32_t n, const double *x, const double *coef,
+                        int32_t N, double *y)
+{
+    for (int32_t i=0; i < n; i++) y[i] = p1evl(x[i], coef, N);
+}
@@ -208,6 +208,8 @@ file in the order given, otherwise these functions will not be available.
 """
 # pylint: disable=unused-import
 
+import logging
+
 import numpy as np
 
 # Functions to add to our standard set
@@ -254,8 +256,55 @@ def cube(x):
     """return x^3"""
     return x*x*x
 
+# Array arguments are evaluated by the C functions from models/lib, compiled
+# on first use by kerneldll.make_special_dll.  Set USE_COMPILED to False to
+# use the numpy versions instead.  Scalars always use numpy since the ctypes
+# call costs more than the function.
+USE_COMPILED = True
+_compiled_functions = None
+
+def _compiled(name):
+    """return the compiled array function *name*, or None if unavailable"""
+    global _compiled_functions
+    if not USE_COMPILED:
+        return None
+    if _compiled_functions is None:
+        try:
+            import ctypes as ct
+            from . import kerneldll
+            dll = ct.CDLL(kerneldll.make_special_dll())
+            x_y = [ct.c_int32, ct.c_void_p, ct.c_void_p]
+            x_c_n_y = [ct.c_int32, ct.c_void_p, ct.c_void_p, ct.c_int32,
+                       ct.c_void_p]
+            argtypes = {
+                "sas_sinx_x_array": x_y,
+                "sas_3j1x_x_array": x_y,
+                "sas_2J1x_x_array": x_y,
+                "polevl_array": x_c_n_y,
+                "p1evl_array": x_c_n_y,
+            }
+            # Note: dll[name] returns a new function object on each call.
+            _compiled_functions = {}
+            for fn, types in argtypes.items():
+                _compiled_functions[fn] = dll[fn]
+                _compiled_functions[fn].argtypes = types
+        except Exception as exc:
+            logging.warning("using numpy special functions: %s", exc)
+            _compiled_functions = {}
+    return _compiled_functions.get(name, None)
+
+def _call_compiled(fn, x, *args):
+    """evaluate the compiled function *fn* at each point of the array *x*"""
+    x = np.require(x, dtype=np.float64, requirements='C')
+    y = np.empty_like(x)
+    fn(x.size, x.ctypes.data, *args, y.ctypes.data)
+    return y
+
 def sas_sinx_x(x):
     """return sin(x)/x"""
+    fn = None if np.isscalar(x) else _compiled("sas_sinx_x_array")
+    if fn is not None:
+        return _call_compiled(fn, x)
     from numpy import sinc as _sinc
     return _sinc(x/M_PI)
 
@@ -269,12 +318,26 @@ def pown(x, n):
 FLOAT_SIZE = 8
 
 def polevl(x, c, n):
-    """return p(x) for polynomial p of degree n-1 with coefficients c"""
-    return np.polyval(c[:n], x)
+    """return p(x) for polynomial p of degree n with coefficients c"""
+    if len(c) < n+1:
+        raise ValueError("polevl needs %d coefficients but got %d"
+                         % (n+1, len(c)))
+    fn = None if np.isscalar(x) else _compiled("polevl_array")
+    if fn is not None:
+        c = np.require(c[:n+1], dtype=np.float64, requirements='C')
+        return _call_compiled(fn, x, c.ctypes.data, n)
+    return np.polyval(c[:n+1], x)
 
 def p1evl(x, c, n):
     """return x^n + p(x) for polynomial p of degree n-1 with coefficients c"""
-    return np.polyval(np.hstack(([1.], c))[:n], x)
+    if len(c) < n:
+        raise ValueError("p1evl needs %d coefficients but got %d"
+                         % (n, len(c)))
+    fn = None if np.isscalar(x) else _compiled("p1evl_array")
+    if fn is not None:
+        c = np.require(c[:n], dtype=np.float64, requirements='C')
+        return _call_compiled(fn, x, c.ctypes.data, n)
+    return np.polyval(np.hstack(([1.], c[:n])), x)
 
 def sas_Si(x):
     """return Si(x)"""
@@ -293,7 +356,10 @@ def sas_j1(x):
 
 def sas_3j1x_x(x):
     """return 3*j1(x)/x"""
-    if np.isscalar(x):
+    fn = None if np.isscalar(x) else _compiled("sas_3j1x_x_array")
+    if fn is not None:
+        retvalue = _call_compiled(fn, x)
+    elif np.isscalar(x):
         retvalue = 3*(sin(x) - x*cos(x))/x**3 if x != 0. else 1.
     else:
         with np.errstate(all='ignore'):
@@ -303,7 +369,10 @@ def sas_3j1x_x(x):
 
 def sas_2J1x_x(x):
     """return 2*J1(x)/x"""
-    if np.isscalar(x):
+    fn = None if np.isscalar(x) else _compiled("sas_2J1x_x_array")
+    if fn is not None:
+        retvalue = _call_compiled(fn, x)
+    elif np.isscalar(x):
         retvalue = 2*sas_J1(x)/x if x != 0 else 1.
     else:
         with np.errstate(all='ignore'):
@@ -832,3 +901,39 @@ gauss150 = Gauss(
         0.0003276086705538
     ])
 )
+
+
+def test_compiled():
+    """check the compiled special functions against the numpy versions"""
+    global USE_COMPILED
+    x = np.hstack((0., np.linspace(0.5, 100., 200)))
+    c = np.array([1.5, -2., 3., 0.25])
+    functions = (sas_sinx_x, sas_3j1x_x, sas_2J1x_x,
+                 lambda x: polevl(x, c, 3), lambda x: p1evl(x, c, 3))
+    try:
+        USE_COMPILED = True
+        compiled = [f(x) for f in functions]
+        USE_COMPILED = False
+        target = [f(x) for f in functions]
+    finally:
+        USE_COMPILED = True
+    for actual, expected in zip(compiled, target):
+        assert np.allclose(actual, expected, rtol=1e-12, atol=1e-14)
+    assert polevl(2., c, 3) == 10.25 and p1evl(2., c, 3) == 13.
+    # Too few coefficients for the degree is an error on both paths.
+    try:
+        for USE_COMPILED in (True, False):
+            for f, args in ((polevl, (x, c, 4)), (p1evl, (x, c, 5)),
+                            (polevl, (2., c, 4))):
+                try:
+                    f(*args)
+                except ValueError:
+                    pass
+                else:
+                    raise AssertionError("%s accepted %d coefficients for n=%d"
+                                         % (f.__name__, len(c), args[2]))
+    finally:
+        USE_COMPILED = True
+    assert sas_3j1x_x(np.ones((2, 3))).shape == (2, 3)
+    # The series avoids the cancellation in the numpy version at small x.
+    assert abs(sas_3j1x_x(np.array([1e-4]))[0] - (1 - 1e-9)) < 1e-15
@@ -0,0 +1,229 @@
+"""
+Stage level tracing for the evaluation pipeline.
+
+The evaluation of a model for a dataset is split into stages, such as
+building the dispersity mesh, calling the kernel and applying the
+resolution function.  Each stage is wrapped in a :func:`span`::
+
+    from . import trace
+    with trace.span("resolution", type(res).__name__):
+        result = res.apply(Iq_calc)
+
+When tracing is disabled, :func:`span` returns a shared do-nothing context
+manager, so the cost is a function call per stage.  Arguments which need
+to be computed, such as the number of points, should be passed as a
+*details* function so they are only evaluated when tracing is enabled::
+
+    with trace.span("kernel", model_id, details=lambda: {'nq': len(q)}):
+        ...
+
+When tracing is enabled, the start time and duration of each span are
+recorded using the monotonic performance counter, along with the process
+and thread ids.
+
+Use :func:`enable` to start recording and :func:`save` to write the events
+in the Chrome trace event format, which can be viewed with Chrome at
+*chrome://tracing* or with `Perfetto <https://ui.perfetto.dev>`_.  For
+example::
+
+    from sasmodels import trace
+    trace.enable()
+    ... run fit ...
+    trace.save("fit_trace.json")
+    print(trace.summary())
+
+Alternatively, set the environment variable *SAS_TRACE=fit_trace.json*
+before starting the program to record all evaluations and save the trace
+when the program exits.
+"""
+from __future__ import print_function
+
+import os
+import json
+import atexit
+import threading
+from time import perf_counter
+
+# pylint: disable=unused-import
+try:
+    from typing import Any, Callable, Dict, List, Optional, Tuple
+except ImportError:
+    pass
+# pylint: enable=unused-import
+
+# Recorded events as (name, category, start, duration, pid, tid, args).
+_EVENTS = []  # type: List[Tuple[str, str, float, float, int, int, Dict[str, Any]]]
+_ENABLED = False
+
+
+class _NullSpan(object):
+    """Span returned when tracing is disabled."""
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        return False
+
+_NULL_SPAN = _NullSpan()
+
+
+class Span(object):
+    """
+    Record the time spent within a *with* block as a trace event.
+    """
+    __slots__ = ('name', 'category', 'args', 'start')
+
+    def __init__(self, category, name, args):
+        # type: (str, str, Dict[str, Any]) -> None
+        self.category = category
+        self.name = name
+        self.args = args
+        self.start = 0.
+
+    def __enter__(self):
+        # type: () -> "Span"
+        self.start = perf_counter()
+        return self
+
+    def __exit__(self, *args):
+        # type: (*Any) -> bool
+        duration = perf_counter() - self.start
+        _EVENTS.append((self.name, self.category, self.start, duration,
+                        os.getpid(), threading.get_ident(), self.args))
+        return False
+
+
+def span(category, name=None, details=None, **args):
+    # type: (str, Optional[str], Optional[Callable[[], Dict[str, Any]]], **Any) -> Any
+    """
+    Return a context manager which records the time spent in the block.
+
+    *category* is the pipeline stage, such as "kernel" or "resolution".
+    *name* further identifies the event, such as the model or resolution
+    type, and defaults to the category.  Any keyword arguments are stored
+    with the event and shown by the trace viewer.  *details*, if given, is
+    called only when tracing is enabled and returns additional arguments.
+    """
+    if not _ENABLED:
+        return _NULL_SPAN
+    if details is not None:
+        args.update(details())
+    return Span(category, category if name is None else name, args)
+
+
+def enable():
+    # type: () -> None
+    """Start recording trace events."""
+    global _ENABLED
+    _ENABLED = True
+
+
+def disable():
+    # type: () -> None
+    """Stop recording trace events.  Recorded events are kept."""
+    global _ENABLED
+    _ENABLED = False
+
+
+def is_enabled():
+    # type: () -> bool
+    """Return True if trace events are being recorded."""
+    return _ENABLED
+
+
+def clear():
+    # type: () -> None
+    """Discard the recorded events."""
+    del _EVENTS[:]
+
+
+def chrome_events():
+    # type: () -> List[Dict[str, Any]]
+    """
+    Return the recorded events as a list of Chrome trace "complete" events,
+    with times in microseconds.
+    """
+    return [{
+        'name': name, 'cat': category, 'ph': 'X',
+        'ts': 1e6*start, 'dur': 1e6*duration,
+        'pid': pid, 'tid': tid, 'args': args,
+    } for name, category, start, duration, pid, tid, args in _EVENTS]
+
+
+def save(path):
+    # type: (str) -> None
+    """Save the recorded events to *path* in Chrome trace JSON format."""
+    with open(path, 'w') as fid:
+        json.dump({'traceEvents': chrome_events(),
+                   'displayTimeUnit': 'ms'}, fid)
+
+
+def summary():
+    # type: () -> str
+    """
+    Return a table with the number of calls and total time for each
+    category, sorted by total time.
+
+    Spans may be nested, such as the kernel call within the product model
+    evaluation, so the times do not sum to the total run time.
+    """
+    totals = {}  # type: Dict[str, List[float]]
+    for _, category, _, duration, _, _, _ in _EVENTS:
+        entry = totals.setdefault(category, [0, 0.])
+        entry[0] += 1
+        entry[1] += duration
+    lines = ["%-20s %8s %12s" % ("stage", "calls", "time (ms)")]
+    for category, (calls, total) in sorted(
+            totals.items(), key=lambda item: -item[1][1]):
+        lines.append("%-20s %8d %12.3f" % (category, calls, 1e3*total))
+    return "\n".join(lines)
+
+
+def _save_at_exit(path):
+    # type: (str) -> None
+    if _EVENTS:
+        save(path)
+
+if os.environ.get('SAS_TRACE', ''):
+    enable()
+    atexit.register(_save_at_exit, os.environ['SAS_TRACE'])
+
+
+def test_trace():
+    # type: () -> None
+    """Check that spans are recorded only when tracing is enabled"""
+    import tempfile
+    from .core import load_model
+    from .data import empty_data1D
+    from .direct_model import DirectModel
+
+    model = load_model('cylinder@hardsphere', dtype='double', platform='dll')
+    calculator = DirectModel(empty_data1D([0.01, 0.1], resolution=0.1), model)
+    saved = _ENABLED, _EVENTS[:]
+    try:
+        disable()
+        clear()
+        calculator(radius=20, length=100)
+        assert not _EVENTS
+        enable()
+        calculator(radius=20, length=100)
+        categories = set(event['cat'] for event in chrome_events())
+        assert {'mesh', 'kernel', 'product', 'resolution'} <= categories
+        kernel = [event for event in chrome_events() if event['cat'] == 'kernel']
+        assert kernel[0]['args']['nq'] > 0
+        fid, path = tempfile.mkstemp(suffix='.json')
+        os.close(fid)
+        try:
+            save(path)
+            with open(path) as fid:
+                events = json.load(fid)['traceEvents']
+        finally:
+            os.unlink(path)
+        assert len(events) == len(_EVENTS)
+        assert all(event['dur'] >= 0 for event in events)
+        assert 'kernel' in summary()
+    finally:
+        if not saved[0]:
+            disable()
+        clear()
+        _EVENTS.extend(saved[1])
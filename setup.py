@@ -66,7 +66,7 @@ setup(
     ],
     package_data={
         'sasmodels.models': ['*.c', 'lib/*.c', 'lib/*.h'],
-        'sasmodels': ['*.c', '*.cl'],
+        'sasmodels': ['*.c', '*.h', '*.cl'],
     },
     install_requires=install_requires,
     extras_require={